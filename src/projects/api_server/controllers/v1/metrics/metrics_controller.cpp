@@ -0,0 +1,31 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "metrics_controller.h"
+
+namespace api
+{
+	namespace v1
+	{
+		void MetricsController::PrepareHandlers()
+		{
+			// The response is not a JSON, so the handler is registered without ApiResponse
+			Register(http::Method::Get, R"()", &MetricsController::OnGetMetrics);
+		}
+
+		void MetricsController::OnGetMetrics(const std::shared_ptr<http::svr::HttpExchange> &client)
+		{
+			auto snapshot = MonitorInstance->GetPrometheusExporter().GetSnapshot();
+			const auto &response = client->GetResponse();
+
+			response->SetStatusCode(http::StatusCode::OK);
+			response->SetHeader("Content-Type", PROMETHEUS_EXPORTER_CONTENT_TYPE);
+			response->AppendString(*snapshot);
+		}
+	}  // namespace v1
+}  // namespace api
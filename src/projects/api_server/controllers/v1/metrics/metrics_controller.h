@@ -0,0 +1,27 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../controller.h"
+
+namespace api
+{
+	namespace v1
+	{
+		// Exposes the metrics in the Prometheus text format
+		class MetricsController : public Controller<MetricsController>
+		{
+		public:
+			void PrepareHandlers() override;
+
+		protected:
+			void OnGetMetrics(const std::shared_ptr<http::svr::HttpExchange> &client);
+		};
+	}  // namespace v1
+}  // namespace api
@@ -25,7 +25,7 @@ namespace api
 													   const std::shared_ptr<mon::StreamMetrics> &stream,
 													   const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
 			{
-				return ::serdes::JsonFromMetrics(stream);
+				return ::serdes::JsonFromStreamMetrics(stream);
 			}
 		}  // namespace stats
 	}	   // namespace v1
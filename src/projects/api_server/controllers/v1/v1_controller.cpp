@@ -8,6 +8,7 @@
 //==============================================================================
 #include "v1_controller.h"
 
+#include "metrics/metrics_controller.h"
 #include "stats/stats_controller.h"
 #include "vhosts/vhosts_controller.h"
 
@@ -20,6 +21,8 @@ namespace api
 			CreateSubController<VHostsController>(R"(\/vhosts)");
 			
 			CreateSubController<stats::StatsController>(R"(\/stats)");
+
+			CreateSubController<MetricsController>(R"(\/metrics)");
 		};
 	}  // namespace v1
 }  // namespace api
\ No newline at end of file
@@ -29,6 +29,11 @@ namespace info
 		_record_total_bytes = 0;
 		_record_total_time = 0;
 
+		_write_backlog_bytes = 0;
+		_write_backlog_packets = 0;
+		_max_write_backlog_bytes = 0;
+		_write_dropped_packets = 0;
+
 		_sequence = 0;
 		_interval = 0;
 		_schedule = "";
@@ -279,6 +284,44 @@ namespace info
 	{
 		_record_bytes += bytes;
 	}
+	void Record::UpdateWriteBacklog(uint64_t bytes, uint64_t packets)
+	{
+		_write_backlog_bytes = bytes;
+		_write_backlog_packets = packets;
+
+		if (bytes > _max_write_backlog_bytes)
+		{
+			_max_write_backlog_bytes = bytes;
+		}
+	}
+	uint64_t Record::GetWriteBacklogBytes()
+	{
+		return _write_backlog_bytes;
+	}
+	uint64_t Record::GetWriteBacklogPackets()
+	{
+		return _write_backlog_packets;
+	}
+	uint64_t Record::GetMaxWriteBacklogBytes()
+	{
+		return _max_write_backlog_bytes;
+	}
+	void Record::SetMaxWriteBacklogBytes(uint64_t bytes)
+	{
+		_max_write_backlog_bytes = bytes;
+	}
+	void Record::IncreaseWriteDroppedPackets()
+	{
+		_write_dropped_packets++;
+	}
+	uint64_t Record::GetWriteDroppedPackets()
+	{
+		return _write_dropped_packets;
+	}
+	void Record::SetWriteDroppedPackets(uint64_t packets)
+	{
+		_write_dropped_packets = packets;
+	}
 	void Record::UpdateRecordTime()
 	{
 		_record_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - _record_start_time).count();
@@ -103,6 +103,16 @@ namespace info
 		void SetRecordBytes(uint64_t bytes);
 		void SetRecordTotalBytes(uint64_t bytes);
 
+		// Status of the write-behind queue of the file writer
+		void UpdateWriteBacklog(uint64_t bytes, uint64_t packets);
+		uint64_t GetWriteBacklogBytes();
+		uint64_t GetWriteBacklogPackets();
+		uint64_t GetMaxWriteBacklogBytes();
+		void SetMaxWriteBacklogBytes(uint64_t bytes);
+		void IncreaseWriteDroppedPackets();
+		uint64_t GetWriteDroppedPackets();
+		void SetWriteDroppedPackets(uint64_t packets);
+
 		void UpdateRecordTime();
 		uint64_t GetRecordTime();
 		uint64_t GetRecordTotalTime();
@@ -209,6 +219,13 @@ namespace info
 		uint64_t _record_bytes;
 		uint64_t _record_total_bytes;
 
+		// Data waiting to be written to the disk
+		uint64_t _write_backlog_bytes;
+		uint64_t _write_backlog_packets;
+		uint64_t _max_write_backlog_bytes;
+		// Packets dropped because the disk could not keep up with the stream
+		uint64_t _write_dropped_packets;
+
 		// Recorded (Accumulated) Time
 		uint64_t _record_time;
 		uint64_t _record_total_time;
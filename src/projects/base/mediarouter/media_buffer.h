@@ -12,7 +12,10 @@
 #include <base/common_types.h>
 
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <vector>
 
 #include "media_type.h"
 
@@ -40,6 +43,10 @@ static ov::String GetMediaPacketFlagString(const MediaPacketFlag flag)
 class MediaPacket
 {
 public:
+	// data: Data of the packet
+	// length_list: Lengths of the frames in the converted data (can be nullptr)
+	using DataConverter = std::function<std::shared_ptr<ov::Data>(const std::shared_ptr<const ov::Data> &data, std::vector<size_t> *length_list)>;
+
 	// Provider must inform the bitstream format so that MediaRouter can handle it.
 	// This constructor is usually used by the Provider to send media packets to the MediaRouter.
 	MediaPacket(uint32_t msid, cmn::MediaType media_type, int32_t track_id, const std::shared_ptr<ov::Data> &data, int64_t pts, int64_t dts, cmn::BitstreamFormat bitstream_format, cmn::PacketType packet_type)
@@ -118,6 +125,7 @@ public:
 	void SetData(std::shared_ptr<ov::Data> &data)
 	{
 		_data = data;
+		_converted_data_cache.Clear();
 	}
 
 	const std::shared_ptr<const ov::Data> GetData() const noexcept
@@ -207,6 +215,7 @@ public:
 	void SetBitstreamFormat(cmn::BitstreamFormat format)
 	{
 		_bitstream_format = format;
+		_converted_data_cache.Clear();
 	}
 
 	void SetPacketType(cmn::PacketType type)
@@ -229,6 +238,36 @@ public:
 		return &_frag_hdr;
 	}
 
+	// Wall clock time (microseconds since epoch) when the packet was received by the provider.
+	// 0 if the latency tracing is disabled
+	int64_t GetIngestTime() const noexcept
+	{
+		return _ingest_time_us;
+	}
+
+	void SetIngestTime(int64_t ingest_time_us)
+	{
+		_ingest_time_us = ingest_time_us;
+	}
+
+	// Returns the data converted to the format.
+	// The packet is shared by all publishers, so the conversion is performed by the converter only once for the packet
+	// and the other callers get the cached result. (The cache is dropped when the data is replaced by SetData())
+	std::shared_ptr<const ov::Data> GetConvertedData(cmn::BitstreamFormat format, const DataConverter &converter, std::vector<size_t> *length_list = nullptr) const
+	{
+		if (format == _bitstream_format)
+		{
+			if (length_list != nullptr)
+			{
+				length_list->push_back(_data->GetLength());
+			}
+
+			return _data;
+		}
+
+		return _converted_data_cache.Get(format, _data, converter, length_list);
+	}
+
 	std::shared_ptr<MediaPacket> ClonePacket() const
 	{
 		auto packet = std::make_shared<MediaPacket>(
@@ -244,6 +283,7 @@ public:
 			GetPacketType());
 
 		packet->_frag_hdr = _frag_hdr;
+		packet->_ingest_time_us = _ingest_time_us;
 
 		return packet;
 	}
@@ -265,6 +305,75 @@ public:
 	}
 
 protected:
+	class ConvertedDataCache
+	{
+	public:
+		ConvertedDataCache() = default;
+
+		// The copied packet may have different data, so the cache is not copied
+		ConvertedDataCache(const ConvertedDataCache &other)
+		{
+		}
+
+		ConvertedDataCache &operator=(const ConvertedDataCache &other)
+		{
+			Clear();
+			return *this;
+		}
+
+		std::shared_ptr<const ov::Data> Get(cmn::BitstreamFormat format, const std::shared_ptr<const ov::Data> &data, const DataConverter &converter, std::vector<size_t> *length_list)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			// A packet is converted to one or two formats at most, so a linear search is enough
+			for (const auto &item : _items)
+			{
+				if (item.format == format)
+				{
+					if (length_list != nullptr)
+					{
+						length_list->insert(length_list->end(), item.length_list.begin(), item.length_list.end());
+					}
+
+					return item.data;
+				}
+			}
+
+			// The lock is held while converting so that the concurrent callers wait for the result instead of converting it again
+			Item item;
+			item.format = format;
+			item.data = converter(data, &item.length_list);
+
+			if (length_list != nullptr)
+			{
+				length_list->insert(length_list->end(), item.length_list.begin(), item.length_list.end());
+			}
+
+			// The failure is also cached, so the conversion is not repeated
+			_items.push_back(item);
+
+			return item.data;
+		}
+
+		void Clear()
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			_items.clear();
+		}
+
+	protected:
+		struct Item
+		{
+			cmn::BitstreamFormat format = cmn::BitstreamFormat::Unknown;
+			std::shared_ptr<const ov::Data> data;
+			std::vector<size_t> length_list;
+		};
+
+		std::mutex _mutex;
+		std::vector<Item> _items;
+	};
+
 	uint32_t _msid = 0;
 	cmn::MediaType _media_type = cmn::MediaType::Unknown;
 	int32_t _track_id = -1;
@@ -278,5 +387,8 @@ protected:
 	cmn::BitstreamFormat _bitstream_format = cmn::BitstreamFormat::Unknown;
 	cmn::PacketType _packet_type = cmn::PacketType::Unknown;
 	FragmentationHeader _frag_hdr;
+	int64_t _ingest_time_us = 0;
+
+	mutable ConvertedDataCache _converted_data_cache;
 };
 
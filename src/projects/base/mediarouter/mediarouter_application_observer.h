@@ -34,6 +34,20 @@ public:
 	// Delivery encoded video/audio frame
 	virtual bool OnSendFrame(const std::shared_ptr<info::Stream> &info, const std::shared_ptr<MediaPacket> &packet) = 0;
 
+	// Delivery the frames of a stream that were ready at the same time.
+	// Override this to handle the frames at once (e.g. to find the stream only once)
+	virtual bool OnSendFrames(const std::shared_ptr<info::Stream> &info, const std::vector<std::shared_ptr<MediaPacket>> &packets)
+	{
+		bool result = true;
+
+		for (const auto &packet : packets)
+		{
+			result = OnSendFrame(info, packet) && result;
+		}
+
+		return result;
+	}
+
 	virtual ObserverType GetObserverType()
 	{
 		return ObserverType::Publisher;
@@ -8,6 +8,7 @@
 //==============================================================================
 #include "./json.h"
 
+#include "./json_writer.h"
 #include "./ovlibrary_private.h"
 
 namespace ov
@@ -24,13 +25,16 @@ namespace ov
 
 	ov::String Json::Stringify(const ::Json::Value &value, bool prettify)
 	{
-		::Json::StreamWriterBuilder builder;
-
 		if (prettify == false)
 		{
-			builder["indentation"] = "";
+			// Written without ::Json::StreamWriter and std::ostringstream
+			JsonWriter writer;
+			writer.Value(value);
+			return writer.GetString();
 		}
 
+		::Json::StreamWriterBuilder builder;
+
 		std::unique_ptr<::Json::StreamWriter> const writer(builder.newStreamWriter());
 
 		std::ostringstream stream;
@@ -0,0 +1,436 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./json_writer.h"
+
+#include <charconv>
+#include <cmath>
+
+#include "./assert.h"
+#include "./ovlibrary_private.h"
+
+namespace ov
+{
+	// Decodes a character in the same way as jsoncpp (it is not strict about the continuation bytes),
+	// and returns U+FFFD for invalid sequences
+	static uint32_t DecodeUtf8(const char *&current, const char *end)
+	{
+		constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+		auto data = reinterpret_cast<const uint8_t *>(current);
+		uint32_t first_byte = data[0];
+
+		if (first_byte < 0x80)
+		{
+			return first_byte;
+		}
+
+		if (first_byte < 0xE0)
+		{
+			if ((end - current) < 2)
+			{
+				return REPLACEMENT_CHARACTER;
+			}
+
+			uint32_t code_point = ((first_byte & 0x1F) << 6) | (data[1] & 0x3F);
+			current += 1;
+
+			// Overlong encoding
+			return (code_point < 0x80) ? REPLACEMENT_CHARACTER : code_point;
+		}
+
+		if (first_byte < 0xF0)
+		{
+			if ((end - current) < 3)
+			{
+				return REPLACEMENT_CHARACTER;
+			}
+
+			uint32_t code_point = ((first_byte & 0x0F) << 12) | ((data[1] & 0x3F) << 6) | (data[2] & 0x3F);
+			current += 2;
+
+			// Surrogates are not valid code points
+			if ((code_point >= 0xD800) && (code_point <= 0xDFFF))
+			{
+				return REPLACEMENT_CHARACTER;
+			}
+
+			return (code_point < 0x800) ? REPLACEMENT_CHARACTER : code_point;
+		}
+
+		if (first_byte < 0xF8)
+		{
+			if ((end - current) < 4)
+			{
+				return REPLACEMENT_CHARACTER;
+			}
+
+			uint32_t code_point = ((first_byte & 0x07) << 18) | ((data[1] & 0x3F) << 12) | ((data[2] & 0x3F) << 6) | (data[3] & 0x3F);
+			current += 3;
+
+			return (code_point < 0x10000) ? REPLACEMENT_CHARACTER : code_point;
+		}
+
+		return REPLACEMENT_CHARACTER;
+	}
+
+	JsonWriter::JsonWriter(size_t capacity)
+	{
+		_string.SetCapacity(capacity);
+		_has_value_stack.reserve(16);
+	}
+
+	void JsonWriter::BeginValue()
+	{
+		if (_key_written)
+		{
+			// The value of the member
+			_key_written = false;
+			return;
+		}
+
+		if (_has_value_stack.empty())
+		{
+			return;
+		}
+
+		if (_has_value_stack.back())
+		{
+			_string.Append(',');
+		}
+		else
+		{
+			_has_value_stack.back() = true;
+		}
+	}
+
+	JsonWriter &JsonWriter::BeginObject()
+	{
+		BeginValue();
+		_string.Append('{');
+		_has_value_stack.push_back(false);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::EndObject()
+	{
+		OV_ASSERT2(_has_value_stack.empty() == false);
+
+		_string.Append('}');
+		_has_value_stack.pop_back();
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::BeginArray()
+	{
+		BeginValue();
+		_string.Append('[');
+		_has_value_stack.push_back(false);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::EndArray()
+	{
+		OV_ASSERT2(_has_value_stack.empty() == false);
+
+		_string.Append(']');
+		_has_value_stack.pop_back();
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Key(const char *key)
+	{
+		BeginValue();
+		WriteString(key, ::strlen(key));
+		_string.Append(':');
+		_key_written = true;
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Key(const ov::String &key)
+	{
+		BeginValue();
+		WriteString(key.CStr(), key.GetLength());
+		_string.Append(':');
+		_key_written = true;
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(const char *value)
+	{
+		if (value == nullptr)
+		{
+			return Null();
+		}
+
+		BeginValue();
+		WriteString(value, ::strlen(value));
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(const ov::String &value)
+	{
+		BeginValue();
+		WriteString(value.CStr(), value.GetLength());
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(bool value)
+	{
+		BeginValue();
+		_string.Append(value ? "true" : "false");
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(int32_t value)
+	{
+		return Value(static_cast<int64_t>(value));
+	}
+
+	JsonWriter &JsonWriter::Value(uint32_t value)
+	{
+		return Value(static_cast<uint64_t>(value));
+	}
+
+	JsonWriter &JsonWriter::Value(int64_t value)
+	{
+		char buffer[24];
+		auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+		BeginValue();
+		_string.Append(buffer, result.ptr - buffer);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(uint64_t value)
+	{
+		char buffer[24];
+		auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+		BeginValue();
+		_string.Append(buffer, result.ptr - buffer);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(double value)
+	{
+		if (std::isfinite(value) == false)
+		{
+			// JSON cannot represent NaN and Infinity, so the same values as jsoncpp are written
+			// (NaN: null, Infinity: a number that overflows to Infinity when it is parsed)
+			if (std::isnan(value))
+			{
+				return Null();
+			}
+
+			BeginValue();
+			_string.Append((value < 0) ? "-1e+9999" : "1e+9999");
+
+			return *this;
+		}
+
+		// Same precision as the default of jsoncpp (17 significant digits)
+		char buffer[32];
+		auto length = ::snprintf(buffer, sizeof(buffer), "%.17g", value);
+
+		BeginValue();
+		_string.Append(buffer, length);
+
+		if (::strpbrk(buffer, ".eE") == nullptr)
+		{
+			// Keep the value as a real number
+			_string.Append(".0");
+		}
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(const ::Json::Value &value)
+	{
+		switch (value.type())
+		{
+			case ::Json::ValueType::nullValue:
+				return Null();
+
+			case ::Json::ValueType::intValue:
+				return Value(static_cast<int64_t>(value.asInt64()));
+
+			case ::Json::ValueType::uintValue:
+				return Value(static_cast<uint64_t>(value.asUInt64()));
+
+			case ::Json::ValueType::realValue:
+				return Value(value.asDouble());
+
+			case ::Json::ValueType::stringValue: {
+				const char *begin = nullptr;
+				const char *end = nullptr;
+
+				BeginValue();
+
+				if (value.getString(&begin, &end))
+				{
+					WriteString(begin, end - begin);
+				}
+				else
+				{
+					_string.Append("\"\"");
+				}
+
+				return *this;
+			}
+
+			case ::Json::ValueType::booleanValue:
+				return Value(value.asBool());
+
+			case ::Json::ValueType::arrayValue: {
+				BeginArray();
+
+				for (::Json::ArrayIndex index = 0; index < value.size(); index++)
+				{
+					Value(value[index]);
+				}
+
+				return EndArray();
+			}
+
+			case ::Json::ValueType::objectValue: {
+				BeginObject();
+
+				for (auto member = value.begin(); member != value.end(); ++member)
+				{
+					const char *end = nullptr;
+					auto name = member.memberName(&end);
+
+					BeginValue();
+					WriteString(name, end - name);
+					_string.Append(':');
+					_key_written = true;
+
+					Value(*member);
+				}
+
+				return EndObject();
+			}
+		}
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Null()
+	{
+		BeginValue();
+		_string.Append("null");
+
+		return *this;
+	}
+
+	const ov::String &JsonWriter::GetString() const
+	{
+		return _string;
+	}
+
+	void JsonWriter::AppendEscapedCodePoint(uint32_t code_point)
+	{
+		static const char HEX[] = "0123456789abcdef";
+
+		char escaped[] = {
+			'\\', 'u',
+			HEX[(code_point >> 12) & 0x0F], HEX[(code_point >> 8) & 0x0F],
+			HEX[(code_point >> 4) & 0x0F], HEX[code_point & 0x0F]};
+
+		_string.Append(escaped, sizeof(escaped));
+	}
+
+	void JsonWriter::WriteString(const char *value, size_t length)
+	{
+		_string.Append('"');
+
+		// Characters that don't need to be escaped are appended at once
+		size_t start = 0;
+		const char *end = value + length;
+
+		for (size_t index = 0; index < length; index++)
+		{
+			auto c = static_cast<uint8_t>(value[index]);
+
+			if ((c >= 0x20) && (c < 0x80) && (c != '"') && (c != '\\'))
+			{
+				continue;
+			}
+
+			_string.Append(value + start, index - start);
+
+			if (c >= 0x80)
+			{
+				// Non-ASCII characters are escaped as \uXXXX like jsoncpp (emitUTF8 is false by default)
+				const char *current = value + index;
+				auto code_point = DecodeUtf8(current, end);
+
+				if (code_point < 0x10000)
+				{
+					AppendEscapedCodePoint(code_point);
+				}
+				else
+				{
+					// Surrogate pair
+					code_point -= 0x10000;
+					AppendEscapedCodePoint(0xD800 + ((code_point >> 10) & 0x3FF));
+					AppendEscapedCodePoint(0xDC00 + (code_point & 0x3FF));
+				}
+
+				index = current - value;
+				start = index + 1;
+				continue;
+			}
+
+			start = index + 1;
+
+			switch (c)
+			{
+				case '"':
+					_string.Append("\\\"");
+					break;
+				case '\\':
+					_string.Append("\\\\");
+					break;
+				case '\b':
+					_string.Append("\\b");
+					break;
+				case '\f':
+					_string.Append("\\f");
+					break;
+				case '\n':
+					_string.Append("\\n");
+					break;
+				case '\r':
+					_string.Append("\\r");
+					break;
+				case '\t':
+					_string.Append("\\t");
+					break;
+				default:
+					AppendEscapedCodePoint(c);
+					break;
+			}
+		}
+
+		_string.Append(value + start, length - start);
+		_string.Append('"');
+	}
+}  // namespace ov
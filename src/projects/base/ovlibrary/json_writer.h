@@ -0,0 +1,72 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <jsoncpp-1.9.3/json/json.h>
+
+#include "./string.h"
+
+namespace ov
+{
+	// Writes JSON text directly into a string without building ::Json::Value trees.
+	// The output is compact (no whitespace), same as ov::Json::Stringify().
+	//
+	// ov::JsonWriter writer;
+	// writer.BeginObject();
+	// writer.Member("name", "stream").Member("bytes", 1024LL);
+	// writer.Key("tracks").BeginArray().Value(1).Value(2).EndArray();
+	// writer.EndObject();
+	// writer.GetString(); // {"name":"stream","bytes":1024,"tracks":[1,2]}
+	class JsonWriter
+	{
+	public:
+		explicit JsonWriter(size_t capacity = 1024);
+
+		JsonWriter &BeginObject();
+		JsonWriter &EndObject();
+		JsonWriter &BeginArray();
+		JsonWriter &EndArray();
+
+		// Writes the name of the next value of the object
+		JsonWriter &Key(const char *key);
+		JsonWriter &Key(const ov::String &key);
+
+		JsonWriter &Value(const char *value);
+		JsonWriter &Value(const ov::String &value);
+		JsonWriter &Value(bool value);
+		JsonWriter &Value(int32_t value);
+		JsonWriter &Value(uint32_t value);
+		JsonWriter &Value(int64_t value);
+		JsonWriter &Value(uint64_t value);
+		JsonWriter &Value(double value);
+		// The tree is written in the same way as ov::Json::Stringify()
+		JsonWriter &Value(const ::Json::Value &value);
+		JsonWriter &Null();
+
+		template <typename T>
+		JsonWriter &Member(const char *key, const T &value)
+		{
+			return Key(key).Value(value);
+		}
+
+		const ov::String &GetString() const;
+
+	private:
+		// Writes a comma if the value is not the first one of the container
+		void BeginValue();
+		void WriteString(const char *value, size_t length);
+		void AppendEscapedCodePoint(uint32_t code_point);
+
+		ov::String _string;
+
+		// Whether a value has been written in each nested container
+		std::vector<bool> _has_value_stack;
+		bool _key_written = false;
+	};
+}  // namespace ov
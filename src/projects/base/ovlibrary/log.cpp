@@ -63,6 +63,16 @@ void ov_log_set_path(const char *log_path)
     g_log_internal.SetLogPath(log_path);
 }
 
+void ov_log_set_async(bool is_async, size_t buffer_size)
+{
+	g_log_internal.SetAsync(is_async, buffer_size);
+}
+
+uint64_t ov_log_get_dropped_count()
+{
+	return g_log_internal.GetDroppedCount();
+}
+
 void ov_stat_log_internal(StatLogType type, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...)
 {
 	// Getroot : Now, disable the temporarily created stat_log. (21-07-16)
@@ -8,6 +8,9 @@
 //==============================================================================
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -126,6 +129,17 @@ bool ov_log_get_enabled(const char *tag, OVLogLevel level);
 void ov_log_internal(OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
 void ov_log_set_path(const char *log_path);
 
+/// Writes the logs in a background thread, so the threads that write the logs don't wait for the console/file I/O
+///
+/// @param is_async Whether to write the logs asynchronously
+/// @param buffer_size Maximum number of the log messages buffered per thread (0: default)
+///
+/// @remarks If the buffer of a thread is full, the logs of the thread are dropped until the background thread writes the buffer.
+///          Critical logs are always written immediately.
+void ov_log_set_async(bool is_async, size_t buffer_size);
+/// @returns The number of the logs dropped because the buffer was full
+uint64_t ov_log_get_dropped_count();
+
 void ov_stat_log_internal(StatLogType type, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
 void ov_stat_log_set_path(StatLogType type, const char *log_path);
 
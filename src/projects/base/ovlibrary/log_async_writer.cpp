@@ -0,0 +1,293 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "log_async_writer.h"
+
+#include <pthread.h>
+
+#include <algorithm>
+
+namespace ov
+{
+	namespace
+	{
+		struct ThreadBufferItem
+		{
+			uint64_t instance_id;
+			std::shared_ptr<void> buffer;
+		};
+
+		// Trivially destructible, so it can be read while the thread is terminating
+		thread_local bool tls_thread_buffers_destroyed = false;
+
+		struct ThreadBuffers
+		{
+			~ThreadBuffers()
+			{
+				tls_thread_buffers_destroyed = true;
+			}
+
+			// A thread usually writes to only one or two writers, so a linear search is enough
+			std::vector<ThreadBufferItem> items;
+		};
+
+		thread_local ThreadBuffers tls_thread_buffers;
+	}  // namespace
+
+	LogAsyncWriter::ThreadBuffer::ThreadBuffer(size_t capacity)
+		// One slot is always empty to distinguish the full buffer from the empty buffer
+		: _entries(capacity + 1)
+	{
+	}
+
+	bool LogAsyncWriter::ThreadBuffer::Push(Entry &&entry)
+	{
+		auto tail = _tail.load(std::memory_order_relaxed);
+		auto next = (tail + 1) % _entries.size();
+
+		if (next == _head.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		_entries[tail] = std::move(entry);
+		_tail.store(next, std::memory_order_release);
+
+		return true;
+	}
+
+	bool LogAsyncWriter::ThreadBuffer::Pop(Entry *entry)
+	{
+		auto head = _head.load(std::memory_order_relaxed);
+
+		if (head == _tail.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		*entry = std::move(_entries[head]);
+		_head.store((head + 1) % _entries.size(), std::memory_order_release);
+
+		return true;
+	}
+
+	bool LogAsyncWriter::ThreadBuffer::IsEmpty() const
+	{
+		return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+	}
+
+	LogAsyncWriter::LogAsyncWriter(const char *thread_name, Sink sink)
+		: _thread_name(thread_name),
+		  _sink(std::move(sink))
+	{
+	}
+
+	LogAsyncWriter::~LogAsyncWriter()
+	{
+		Stop();
+	}
+
+	bool LogAsyncWriter::Start(size_t buffer_size)
+	{
+		static std::atomic<uint64_t> last_instance_id{0};
+
+		if (_is_running || (buffer_size == 0))
+		{
+			return false;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_buffers_mutex);
+
+			// The buffers of the previous run are not used anymore
+			_buffers.clear();
+			_instance_id = ++last_instance_id;
+			_buffer_size = buffer_size;
+		}
+
+		_is_running = true;
+
+		try
+		{
+			_flush_thread = std::thread(&LogAsyncWriter::FlushThread, this);
+			::pthread_setname_np(_flush_thread.native_handle(), _thread_name.CStr());
+		}
+		catch (const std::system_error &e)
+		{
+			_is_running = false;
+			return false;
+		}
+
+		return true;
+	}
+
+	void LogAsyncWriter::Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_flush_mutex);
+
+			if (_is_running == false)
+			{
+				return;
+			}
+
+			_is_running = false;
+		}
+
+		_flush_condition.notify_all();
+
+		if (_flush_thread.joinable())
+		{
+			_flush_thread.join();
+		}
+
+		// Write the logs pushed while the thread is stopping
+		Flush();
+	}
+
+	LogAsyncWriter::PushResult LogAsyncWriter::Push(OVLogLevel level, std::time_t time, ov::String &&message)
+	{
+		if (_is_running == false)
+		{
+			return PushResult::NotAvailable;
+		}
+
+		auto buffer = GetThreadBuffer();
+
+		if (buffer == nullptr)
+		{
+			return PushResult::NotAvailable;
+		}
+
+		Entry entry;
+
+		entry.sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
+		entry.level = level;
+		entry.time = time;
+		entry.message = std::move(message);
+
+		if (buffer->Push(std::move(entry)) == false)
+		{
+			// Give the message back so the caller can write it in another way
+			message = std::move(entry.message);
+
+			_dropped_count++;
+			return PushResult::Dropped;
+		}
+
+		return PushResult::Pushed;
+	}
+
+	std::shared_ptr<LogAsyncWriter::ThreadBuffer> LogAsyncWriter::GetThreadBuffer()
+	{
+		if (tls_thread_buffers_destroyed)
+		{
+			// Logs written by the destructors of the other thread local objects
+			return nullptr;
+		}
+
+		auto instance_id = _instance_id;
+
+		for (auto &item : tls_thread_buffers.items)
+		{
+			if (item.instance_id == instance_id)
+			{
+				return std::static_pointer_cast<ThreadBuffer>(item.buffer);
+			}
+		}
+
+		// This thread writes to this writer for the first time
+		std::shared_ptr<ThreadBuffer> buffer;
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_buffers_mutex);
+
+			if (_is_running == false)
+			{
+				return nullptr;
+			}
+
+			buffer = std::make_shared<ThreadBuffer>(_buffer_size);
+			_buffers.push_back(buffer);
+		}
+
+		tls_thread_buffers.items.push_back({instance_id, buffer});
+
+		return buffer;
+	}
+
+	void LogAsyncWriter::FlushThread()
+	{
+		while (true)
+		{
+			if (Flush() > 0)
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(_flush_mutex);
+
+			if (_is_running == false)
+			{
+				break;
+			}
+
+			// Producers don't wake this thread up to keep the logging lock-free, so the buffers are polled
+			_flush_condition.wait_for(lock, std::chrono::milliseconds(OV_LOG_ASYNC_FLUSH_INTERVAL_MSEC));
+		}
+	}
+
+	size_t LogAsyncWriter::Flush()
+	{
+		_pending_entries.clear();
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_buffers_mutex);
+
+			Entry entry;
+
+			for (auto buffer = _buffers.begin(); buffer != _buffers.end();)
+			{
+				auto &thread_buffer = *buffer;
+
+				while (thread_buffer->Pop(&entry))
+				{
+					_pending_entries.push_back(std::move(entry));
+				}
+
+				// If only this writer has the buffer, the thread that owned the buffer has been terminated
+				if ((thread_buffer.use_count() == 1) && thread_buffer->IsEmpty())
+				{
+					buffer = _buffers.erase(buffer);
+				}
+				else
+				{
+					++buffer;
+				}
+			}
+		}
+
+		// Restore the order of the logs written by the different threads
+		std::stable_sort(_pending_entries.begin(), _pending_entries.end(), [](const Entry &entry1, const Entry &entry2) -> bool {
+			return entry1.sequence < entry2.sequence;
+		});
+
+		auto dropped_count = _dropped_count.load();
+		auto newly_dropped_count = dropped_count - _reported_dropped_count;
+		_reported_dropped_count = dropped_count;
+
+		if (_pending_entries.empty() && (newly_dropped_count == 0))
+		{
+			return 0;
+		}
+
+		_sink(_pending_entries, newly_dropped_count);
+
+		return _pending_entries.size();
+	}
+}  // namespace ov
@@ -0,0 +1,123 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./log.h"
+#include "./string.h"
+
+// Interval to write the buffered logs when there are few logs
+#define OV_LOG_ASYNC_FLUSH_INTERVAL_MSEC (10)
+// Default number of the log messages buffered per thread
+#define OV_LOG_ASYNC_DEFAULT_BUFFER_SIZE (8192)
+
+namespace ov
+{
+	// Collects the log messages in the per-thread lock-free buffers and writes them in a background thread,
+	// so the threads that write the logs don't wait for the I/O or for each other
+	class LogAsyncWriter
+	{
+	public:
+		struct Entry
+		{
+			// Used to restore the order of the logs written by different threads
+			uint64_t sequence = 0;
+			OVLogLevel level = OVLogLevelInformation;
+			std::time_t time = 0;
+			ov::String message;
+		};
+
+		// Called by the background thread with the entries in the order they were written,
+		// and the number of the messages dropped since the last call
+		using Sink = std::function<void(const std::vector<Entry> &entries, uint64_t dropped_count)>;
+
+		LogAsyncWriter(const char *thread_name, Sink sink);
+		~LogAsyncWriter();
+
+		// buffer_size: Maximum number of the log messages buffered per thread
+		bool Start(size_t buffer_size);
+		// Writes all the buffered logs and stops the background thread
+		void Stop();
+
+		bool IsRunning() const
+		{
+			return _is_running;
+		}
+
+		enum class PushResult
+		{
+			Pushed,
+			// The buffer of the calling thread is full
+			Dropped,
+			// The writer is not running (or the calling thread is terminating), so the caller must write the message
+			NotAvailable
+		};
+
+		// The message is moved only if the result is Pushed
+		PushResult Push(OVLogLevel level, std::time_t time, ov::String &&message);
+
+		uint64_t GetDroppedCount() const
+		{
+			return _dropped_count;
+		}
+
+	protected:
+		// Single-producer (the thread that owns the buffer), single-consumer (the background thread) ring buffer
+		class ThreadBuffer
+		{
+		public:
+			explicit ThreadBuffer(size_t capacity);
+
+			bool Push(Entry &&entry);
+			bool Pop(Entry *entry);
+			bool IsEmpty() const;
+
+		protected:
+			std::vector<Entry> _entries;
+
+			std::atomic<size_t> _head{0};
+			std::atomic<size_t> _tail{0};
+		};
+
+		std::shared_ptr<ThreadBuffer> GetThreadBuffer();
+
+		void FlushThread();
+		// Returns the number of the written entries
+		size_t Flush();
+
+		ov::String _thread_name;
+		Sink _sink;
+
+		// Identifies the buffers that are created for this instance (changed whenever the writer is started)
+		uint64_t _instance_id = 0;
+		size_t _buffer_size = 0;
+
+		std::atomic<bool> _is_running{false};
+		std::thread _flush_thread;
+		std::mutex _flush_mutex;
+		std::condition_variable _flush_condition;
+
+		std::mutex _buffers_mutex;
+		std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+
+		// Used only by the background thread
+		std::vector<Entry> _pending_entries;
+
+		std::atomic<uint64_t> _sequence{0};
+		std::atomic<uint64_t> _dropped_count{0};
+		uint64_t _reported_dropped_count = 0;
+	};
+}  // namespace ov
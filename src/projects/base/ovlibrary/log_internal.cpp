@@ -8,6 +8,7 @@
 //==============================================================================
 #include "log_internal.h"
 
+#include <cinttypes>
 #include <thread>
 
 #include "platform.h"
@@ -50,16 +51,53 @@
 #define OV_LOG_COLOR_BG_BR_CYAN "\x1B[106m"
 #define OV_LOG_COLOR_BG_BR_WHITE "\x1B[107m"
 
+// Maximum number of the tags cached by each thread
+#define OV_LOG_MAX_CACHED_TAGS (1024)
+
 namespace ov
 {
+	namespace
+	{
+		struct CachedEnableItem
+		{
+			const LogInternal *owner;
+			uint64_t generation;
+			// Tags are usually string literals, so the item is found by the address of the tag, and then the content is compared
+			std::string tag;
+			OVLogLevel level;
+			bool is_enabled;
+		};
+
+		// Trivially destructible, so it can be read while the thread is terminating
+		thread_local bool tls_enable_cache_destroyed = false;
+
+		struct EnableCache
+		{
+			~EnableCache()
+			{
+				tls_enable_cache_destroyed = true;
+			}
+
+			std::unordered_map<const char *, CachedEnableItem> items;
+		};
+
+		thread_local EnableCache tls_enable_cache;
+	}  // namespace
+
 	LogInternal::LogInternal(std::string log_file_name) noexcept
 		: _level(OVLogLevelDebug),
-		  _log_file(log_file_name)
+		  _log_file(log_file_name),
+		  _async_writer("LogWriter", [this](const std::vector<LogAsyncWriter::Entry> &entries, uint64_t dropped_count) {
+			  OnAsyncLogs(entries, dropped_count);
+		  })
 	{
 	}
 
 	LogInternal::~LogInternal()
 	{
+		// Write the buffered logs before the file is released
+		_async_writer.Stop();
+
 		_released = true;
 	}
 
@@ -79,6 +117,55 @@ namespace ov
 
 		_enable_map.clear();
 		_enable_list.clear();
+		_enable_generation++;
+	}
+
+	bool LogInternal::FindCachedEnableItem(const char *tag, OVLogLevel *level, bool *is_enabled)
+	{
+		if (tls_enable_cache_destroyed)
+		{
+			return false;
+		}
+
+		auto item = tls_enable_cache.items.find(tag);
+
+		if (item == tls_enable_cache.items.end())
+		{
+			return false;
+		}
+
+		auto &cached_item = item->second;
+
+		if ((cached_item.owner != this) ||
+			(cached_item.generation != _enable_generation.load(std::memory_order_acquire)) ||
+			(cached_item.tag != tag))
+		{
+			return false;
+		}
+
+		*level = cached_item.level;
+		*is_enabled = cached_item.is_enabled;
+
+		return true;
+	}
+
+	void LogInternal::CacheEnableItem(const char *tag, uint64_t generation, OVLogLevel level, bool is_enabled)
+	{
+		if (tls_enable_cache_destroyed)
+		{
+			// Logs written by the destructors of the other thread local objects
+			return;
+		}
+
+		auto &items = tls_enable_cache.items;
+
+		if (items.size() >= OV_LOG_MAX_CACHED_TAGS)
+		{
+			// Too many tags are made dynamically
+			items.clear();
+		}
+
+		items[tag] = {this, generation, tag, level, is_enabled};
 	}
 
 	bool LogInternal::IsEnabled(const char *tag, OVLogLevel level)
@@ -88,8 +175,41 @@ namespace ov
 			return false;
 		}
 
-		std::lock_guard<std::mutex> lock(_mutex);
+		OVLogLevel enabled_level;
+		bool is_enabled;
 
+		// Most logs are filtered here without locking the mutex
+		if (FindCachedEnableItem(tag, &enabled_level, &is_enabled) == false)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			auto item = FindEnableItem(tag);
+
+			if (item == nullptr)
+			{
+				// Item must be added
+				OV_ASSERT2(false);
+				return false;
+			}
+
+			enabled_level = item->level;
+			is_enabled = item->is_enabled;
+
+			CacheEnableItem(tag, _enable_generation, enabled_level, is_enabled);
+		}
+
+		if (level >= enabled_level)
+		{
+			// Returns whether the log level for the tag is activated
+			return is_enabled;
+		}
+
+		// Levels below level behave as opposed to being activated
+		return (is_enabled == false);
+	}
+
+	const LogInternal::EnableItem *LogInternal::FindEnableItem(const char *tag)
+	{
 		auto item = _enable_map.find(tag);
 
 		if (item == _enable_map.cend())
@@ -117,23 +237,9 @@ namespace ov
 			}
 
 			item = _enable_map.find(tag);
-
-			if (item == _enable_map.cend())
-			{
-				// Item must be added
-				OV_ASSERT2(false);
-				return false;
-			}
 		}
 
-		if (level >= item->second.level)
-		{
-			// Returns whether the log level for the tag is activated
-			return item->second.is_enabled;
-		}
-
-		// Levels below level behave as opposed to being activated
-		return (item->second.is_enabled == false);
+		return (item != _enable_map.cend()) ? &(item->second) : nullptr;
 	}
 
 	bool LogInternal::SetEnable(const char *tag_regex, OVLogLevel level, bool is_enabled)
@@ -146,6 +252,7 @@ namespace ov
 		std::lock_guard<std::mutex> lock(_mutex);
 
 		_enable_map.clear();
+		_enable_generation++;
 
 		try
 		{
@@ -202,6 +309,25 @@ namespace ov
 			return;
 		}
 
+		ov::String log = show_format ? MakePrefix(level, tag, file, line, method) : ov::String();
+
+		// Append messages
+		log.AppendVFormat(format, arg_list);
+
+		// Critical logs are written immediately because the process may be terminated right after
+		if (show_format && (level < OVLogLevelCritical))
+		{
+			if (_async_writer.Push(level, std::time(nullptr), std::move(log)) != LogAsyncWriter::PushResult::NotAvailable)
+			{
+				return;
+			}
+		}
+
+		WriteLog(show_format, level, log, 0, true);
+	}
+
+	ov::String LogInternal::MakePrefix(OVLogLevel level, const char *tag, const char *file, int line, const char *method)
+	{
 		constexpr const char *log_level[] = {
 			"D",
 			"I",
@@ -209,20 +335,6 @@ namespace ov
 			"E",
 			"C"};
 
-		constexpr const char *color_prefix[] = {
-			OV_LOG_COLOR_FG_CYAN,
-			OV_LOG_COLOR_FG_WHITE,
-			OV_LOG_COLOR_FG_YELLOW,
-			OV_LOG_COLOR_FG_BR_RED,
-			OV_LOG_COLOR_FG_BR_WHITE OV_LOG_COLOR_BG_RED};
-
-		constexpr const char *color_suffix[] = {
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET};
-
 		// Obtain current time in milliseconds
 		auto current = std::chrono::system_clock::now();
 		auto mseconds = std::chrono::duration_cast<std::chrono::milliseconds>(current.time_since_epoch()).count() % 1000;
@@ -267,7 +379,6 @@ namespace ov
 		}
 #endif	// OV_LOG_SHOW_FUNCTION_NAME
 
-		if (show_format)
 		{
 			auto tid = ov::Platform::GetThreadId();
 			auto name = ov::Platform::GetThreadName();
@@ -330,23 +441,71 @@ namespace ov
 			);
 		}
 
-		// Append messages
-		log.AppendVFormat(format, arg_list);
+		return log;
+	}
+
+	void LogInternal::WriteLog(bool show_format, OVLogLevel level, const ov::String &log, std::time_t time, bool flush)
+	{
+		constexpr const char *color_prefix[] = {
+			OV_LOG_COLOR_FG_CYAN,
+			OV_LOG_COLOR_FG_WHITE,
+			OV_LOG_COLOR_FG_YELLOW,
+			OV_LOG_COLOR_FG_BR_RED,
+			OV_LOG_COLOR_FG_BR_WHITE OV_LOG_COLOR_BG_RED};
+
+		constexpr const char *color_suffix[] = {
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET};
+
 		if (show_format)
 		{
 			if (level < OVLogLevelWarning)
 			{
 				fprintf(stdout, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				fflush(stdout);
+
+				if (flush)
+				{
+					fflush(stdout);
+				}
 			}
 			else
 			{
 				fprintf(stderr, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				fflush(stderr);
+
+				if (flush)
+				{
+					fflush(stderr);
+				}
 			}
 		}
 
-		_log_file.Write(log.CStr());
+		_log_file.Write(log.CStr(), time, flush);
+	}
+
+	void LogInternal::OnAsyncLogs(const std::vector<LogAsyncWriter::Entry> &entries, uint64_t dropped_count)
+	{
+		for (const auto &entry : entries)
+		{
+			WriteLog(true, entry.level, entry.message, entry.time, false);
+		}
+
+		if (dropped_count > 0)
+		{
+			auto log = MakePrefix(OVLogLevelWarning, "Log", __FILE__, __LINE__, __PRETTY_FUNCTION__);
+
+			log.AppendFormat("%" PRIu64 " log messages were dropped because the log buffer was full (total: %" PRIu64 ")",
+							 dropped_count, _async_writer.GetDroppedCount());
+
+			WriteLog(true, OVLogLevelWarning, log, 0, false);
+		}
+
+		// Flush once for all the entries
+		fflush(stdout);
+		fflush(stderr);
+		_log_file.Flush();
 	}
 
 	void LogInternal::SetLogPath(const char *log_path)
@@ -358,4 +517,38 @@ namespace ov
 
 		_log_file.SetLogPath(log_path);
 	}
+
+	void LogInternal::SetAsync(bool is_async, size_t buffer_size)
+	{
+		if (_released)
+		{
+			return;
+		}
+
+		if (is_async && (buffer_size == 0))
+		{
+			buffer_size = OV_LOG_ASYNC_DEFAULT_BUFFER_SIZE;
+		}
+
+		if (_async_writer.IsRunning())
+		{
+			if (is_async && (buffer_size == _async_buffer_size))
+			{
+				return;
+			}
+
+			_async_writer.Stop();
+		}
+
+		if (is_async)
+		{
+			_async_buffer_size = buffer_size;
+			_async_writer.Start(buffer_size);
+		}
+	}
+
+	uint64_t LogInternal::GetDroppedCount() const
+	{
+		return _async_writer.GetDroppedCount();
+	}
 }  // namespace ov
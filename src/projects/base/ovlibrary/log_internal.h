@@ -21,6 +21,7 @@
 
 #include "./assert.h"
 #include "./log.h"
+#include "./log_async_writer.h"
 #include "./log_write.h"
 #include "./string.h"
 
@@ -67,7 +68,35 @@ namespace ov
 
 		void SetLogPath(const char *log_path);
 
+		/// Writes the logs in a background thread (except for the critical logs)
+		///
+		/// @param is_async Whether to write the logs asynchronously
+		/// @param buffer_size Maximum number of the log messages buffered per thread
+		void SetAsync(bool is_async, size_t buffer_size);
+		uint64_t GetDroppedCount() const;
+
 	protected:
+		struct EnableItem
+		{
+			std::shared_ptr<std::regex> regex;
+			OVLogLevel level;
+			bool is_enabled;
+			ov::String regex_string;
+		};
+
+		// Finds the item that matches the tag, and caches it in _enable_map (_mutex must be locked)
+		const EnableItem *FindEnableItem(const char *tag);
+
+		// Returns the enable item of the tag cached by the calling thread
+		bool FindCachedEnableItem(const char *tag, OVLogLevel *level, bool *is_enabled);
+		void CacheEnableItem(const char *tag, uint64_t generation, OVLogLevel level, bool is_enabled);
+
+		ov::String MakePrefix(OVLogLevel level, const char *tag, const char *file, int line, const char *method);
+		void WriteLog(bool show_format, OVLogLevel level, const ov::String &log, std::time_t time, bool flush);
+
+		// Called by the background thread of _async_writer
+		void OnAsyncLogs(const std::vector<LogAsyncWriter::Entry> &entries, uint64_t dropped_count);
+
 		// This variable is used to avoid the problem of referencing incorrect heap if the log is written after LogInternal instance is released.
 		// This situation occurs when the LogInternal instance declared static is disabled just before the OME is terminated and then logs are written by another module.
 		bool _released = false;
@@ -78,19 +107,17 @@ namespace ov
 
 		LogWrite _log_file;
 
-		struct EnableItem
-		{
-			std::shared_ptr<std::regex> regex;
-			OVLogLevel level;
-			bool is_enabled;
-			ov::String regex_string;
-		};
-
 		std::vector<EnableItem> _enable_list;
 
 		// This map used for cache (It reduces regex matching cost)
 		// key: tag
 		// value: is_enabled
 		std::unordered_map<ov::String, EnableItem> _enable_map;
+
+		// Increased whenever the rules are changed to invalidate the caches of the threads
+		std::atomic<uint64_t> _enable_generation{0};
+
+		size_t _async_buffer_size = 0;
+		LogAsyncWriter _async_writer;
 	};
 }  // namespace ov
\ No newline at end of file
@@ -21,7 +21,9 @@ namespace ov
     public:
         LogWrite(std::string log_file_name, bool include_date_in_filename = false);
         virtual ~LogWrite() = default;
-        void Write(const char* log, std::time_t time = 0);
+        // flush: If false, the log may stay in the stream buffer until Flush() is called
+        void Write(const char* log, std::time_t time = 0, bool flush = true);
+        void Flush();
         void SetLogPath(const char* log_path);
 
         static void SetAsService(bool start_service);
@@ -22,6 +22,7 @@
 #include "./enable_shared_from_this.h"
 #include "./error.h"
 #include "./json.h"
+#include "./json_writer.h"
 #include "./log.h"
 #include "./memory_utilities.h"
 #include "./ovdata_structure.h"
@@ -32,6 +33,7 @@
 #include "./random.h"
 #include "./regex.h"
 #include "./semaphore.h"
+#include "./sharded_map.h"
 #include "./singleton.h"
 #include "./stack_trace.h"
 #include "./stop_watch.h"
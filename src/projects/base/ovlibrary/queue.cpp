@@ -8,7 +8,50 @@
 //==============================================================================
 #include "./queue.h"
 
+#include <unordered_set>
+
 namespace ov
 {
-    
-}
\ No newline at end of file
+	namespace
+	{
+		struct QueueRegistryItems
+		{
+			std::mutex mutex;
+			std::unordered_set<const QueueInterface *> queues;
+		};
+
+		// Created on the first use, so the queues that are created during the static initialization can be registered
+		QueueRegistryItems &GetQueueRegistryItems()
+		{
+			static QueueRegistryItems items;
+			return items;
+		}
+	}  // namespace
+
+	void QueueRegistry::Register(const QueueInterface *queue)
+	{
+		auto &items = GetQueueRegistryItems();
+		auto lock_guard = std::lock_guard(items.mutex);
+
+		items.queues.insert(queue);
+	}
+
+	void QueueRegistry::Unregister(const QueueInterface *queue)
+	{
+		auto &items = GetQueueRegistryItems();
+		auto lock_guard = std::lock_guard(items.mutex);
+
+		items.queues.erase(queue);
+	}
+
+	void QueueRegistry::ForEach(const std::function<void(const QueueInterface &queue)> &callback)
+	{
+		auto &items = GetQueueRegistryItems();
+		auto lock_guard = std::lock_guard(items.mutex);
+
+		for (auto queue : items.queues)
+		{
+			callback(*queue);
+		}
+	}
+}  // namespace ov
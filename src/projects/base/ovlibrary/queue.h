@@ -9,6 +9,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <functional>
 #include <optional>
 #include <queue>
 #include <shared_mutex>
@@ -21,8 +22,31 @@
 
 namespace ov
 {
+	// Provides the status of the queue regardless of the type of the items
+	class QueueInterface
+	{
+	public:
+		virtual ~QueueInterface() = default;
+
+		virtual String GetAlias() const = 0;
+		virtual size_t Size() const = 0;
+		virtual size_t GetPeak() const = 0;
+		virtual size_t GetThreshold() const = 0;
+	};
+
+	// Keeps track of the live queues so their depths can be exported (e.g. to the metrics endpoint)
+	class QueueRegistry
+	{
+	public:
+		static void Register(const QueueInterface *queue);
+		static void Unregister(const QueueInterface *queue);
+
+		// The queue can't be destroyed while the callback is called
+		static void ForEach(const std::function<void(const QueueInterface &queue)> &callback);
+	};
+
 	template <typename T>
-	class Queue
+	class Queue : public QueueInterface
 	{
 	public:
 		Queue()
@@ -38,17 +62,21 @@ namespace ov
 
 			_last_log_time.Start();
 
+			QueueRegistry::Register(this);
+
 			auto shared_lock = std::shared_lock(_name_mutex);
 			logd("ov.Queue", "[%p] %s is created with threshold: %zu, interval: %d", this, _queue_name.CStr(), threshold, log_interval_in_msec);
 		}
 
-		~Queue()
+		~Queue() override
 		{
+			QueueRegistry::Unregister(this);
+
 			auto shared_lock = std::shared_lock(_name_mutex);
 			logd("ov.Queue", "[%p] %s is destroyed", this, _queue_name.CStr());
 		}
 
-		String GetAlias() const
+		String GetAlias() const override
 		{
 			auto shared_lock = std::shared_lock(_name_mutex);
 			return _queue_name;
@@ -232,13 +260,27 @@ namespace ov
 			_queue = {};
 		}
 
-		size_t Size() const
+		size_t Size() const override
 		{
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return _queue.size();
 		}
 
+		size_t GetPeak() const override
+		{
+			auto lock_guard = std::lock_guard(_mutex);
+
+			return _peak;
+		}
+
+		size_t GetThreshold() const override
+		{
+			auto shared_lock = std::shared_lock(_name_mutex);
+
+			return _threshold;
+		}
+
 		bool IsStopped() const
 		{
 			return _stop;
@@ -273,7 +315,7 @@ namespace ov
 	private:
 		StopWatch _last_log_time;
 
-		std::shared_mutex _name_mutex;
+		mutable std::shared_mutex _name_mutex;
 		String _queue_name;
 
 		size_t _threshold = 0;
@@ -0,0 +1,121 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <array>
+#include <functional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace ov
+{
+	// A hash map split into shards, each protected by its own shared_mutex.
+	// Lookups from many threads only contend when they hit the same shard, and readers never block each other.
+	template <typename Tkey, typename Tvalue, typename Thash = std::hash<Tkey>, size_t SHARD_COUNT = 64>
+	class ShardedMap
+	{
+	public:
+		bool Find(const Tkey &key, Tvalue *value) const
+		{
+			auto &shard = GetShard(key);
+			auto lock_guard = std::shared_lock(shard.mutex);
+
+			auto item = shard.map.find(key);
+			if (item == shard.map.end())
+			{
+				return false;
+			}
+
+			if (value != nullptr)
+			{
+				*value = item->second;
+			}
+
+			return true;
+		}
+
+		bool Contains(const Tkey &key) const
+		{
+			return Find(key, nullptr);
+		}
+
+		// Insert or replace the value
+		void Set(const Tkey &key, const Tvalue &value)
+		{
+			auto &shard = GetShard(key);
+			auto lock_guard = std::lock_guard(shard.mutex);
+
+			shard.map[key] = value;
+		}
+
+		bool Erase(const Tkey &key)
+		{
+			auto &shard = GetShard(key);
+			auto lock_guard = std::lock_guard(shard.mutex);
+
+			return shard.map.erase(key) > 0;
+		}
+
+		void Clear()
+		{
+			for (auto &shard : _shards)
+			{
+				auto lock_guard = std::lock_guard(shard.mutex);
+				shard.map.clear();
+			}
+		}
+
+		size_t GetSize() const
+		{
+			size_t size = 0;
+
+			for (auto &shard : _shards)
+			{
+				auto lock_guard = std::shared_lock(shard.mutex);
+				size += shard.map.size();
+			}
+
+			return size;
+		}
+
+		// The callback is called while holding the lock of the shard, so it must not access this map
+		void ForEach(const std::function<void(const Tkey &key, const Tvalue &value)> &callback) const
+		{
+			for (auto &shard : _shards)
+			{
+				auto lock_guard = std::shared_lock(shard.mutex);
+
+				for (const auto &item : shard.map)
+				{
+					callback(item.first, item.second);
+				}
+			}
+		}
+
+	protected:
+		struct Shard
+		{
+			mutable std::shared_mutex mutex;
+			std::unordered_map<Tkey, Tvalue, Thash> map;
+		};
+
+		Shard &GetShard(const Tkey &key)
+		{
+			return _shards[_hasher(key) % SHARD_COUNT];
+		}
+
+		const Shard &GetShard(const Tkey &key) const
+		{
+			return _shards[_hasher(key) % SHARD_COUNT];
+		}
+
+		Thash _hasher;
+		std::array<Shard, SHARD_COUNT> _shards;
+	};
+}  // namespace ov
@@ -12,6 +12,7 @@
 #include <errno.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <algorithm>
@@ -279,6 +280,7 @@ namespace ov
 			return false;
 		}
 
+		_dispatch_queue_bytes += command.GetDataLength();
 		_dispatch_queue.push_back(std::move(command));
 
 		return true;
@@ -361,6 +363,20 @@ namespace ov
 		return MakeNonBlockingInternal(std::move(callback), true);
 	}
 
+	bool Socket::SetAsyncInterface(std::shared_ptr<SocketAsyncInterface> callback)
+	{
+		if (_blocking_mode != BlockingMode::NonBlocking)
+		{
+			logae("The callback can only be changed in non-blocking mode");
+			return false;
+		}
+
+		// The callback may be changed while the epoll thread is calling it (e.g. when an idle connection is pooled)
+		std::atomic_store(&_callback, std::move(callback));
+
+		return true;
+	}
+
 	bool Socket::MakeNonBlockingInternal(std::shared_ptr<SocketAsyncInterface> callback, bool need_to_wait_first_epoll_event)
 	{
 		if (_blocking_mode == BlockingMode::NonBlocking)
@@ -853,7 +869,7 @@ namespace ov
 				return DispatchResult::Error;
 
 			case DispatchCommand::Type::Send:
-				sent_bytes = SendInternal(data);
+				sent_bytes = SendInternal(command.header, data);
 				break;
 
 			case DispatchCommand::Type::SendTo:
@@ -885,7 +901,7 @@ namespace ov
 			}
 		}
 
-		if (sent_bytes == static_cast<ssize_t>(command.data->GetLength()))
+		if (sent_bytes == static_cast<ssize_t>(command.GetDataLength()))
 		{
 			return DispatchResult::Dispatched;
 		}
@@ -899,7 +915,7 @@ namespace ov
 		{
 			// Since some data has been sent, the time needs to be updated.
 			command.UpdateTime();
-			data = data->Subdata(sent_bytes);
+			command.Consume(sent_bytes);
 
 			logad("Part of the data has been sent: %ld bytes, left: %ld bytes (%s)", sent_bytes, data->GetLength(), command.ToString().CStr());
 		}
@@ -911,6 +927,88 @@ namespace ov
 		return DispatchResult::PartialDispatched;
 	}
 
+	Socket::DispatchResult Socket::DispatchSendCommandsInternal()
+	{
+		// This function must be called while holding _dispatch_queue_lock
+		struct iovec iov[OV_SOCKET_MAX_IOV_COUNT];
+		size_t iov_count = 0;
+		size_t command_count = 0;
+		size_t total_length = 0;
+
+		for (auto &command : _dispatch_queue)
+		{
+			if (command.type != DispatchCommand::Type::Send)
+			{
+				break;
+			}
+
+			auto length = command.GetDataLength();
+
+			// The first command is always included, even if it is larger than the budget
+			if ((command_count > 0) &&
+				(((iov_count + 2) > OV_SOCKET_MAX_IOV_COUNT) || ((total_length + length) > OV_SOCKET_MAX_BYTES_PER_SENDMSG)))
+			{
+				break;
+			}
+
+			if ((command.header != nullptr) && (command.header->IsEmpty() == false))
+			{
+				iov[iov_count].iov_base = const_cast<void *>(command.header->GetData());
+				iov[iov_count].iov_len = command.header->GetLength();
+				iov_count++;
+			}
+
+			if ((command.data != nullptr) && (command.data->IsEmpty() == false))
+			{
+				iov[iov_count].iov_base = const_cast<void *>(command.data->GetData());
+				iov[iov_count].iov_len = command.data->GetLength();
+				iov_count++;
+			}
+
+			total_length += length;
+			command_count++;
+		}
+
+		logap("Dispatching %zu send commands (%zu bytes, %zu buffers)...", command_count, total_length, iov_count);
+
+		auto sent_bytes = (iov_count > 0) ? SendVectorInternal(iov, iov_count) : 0L;
+
+		if (sent_bytes == -1L)
+		{
+			return DispatchResult::Error;
+		}
+
+		_dispatch_queue_bytes -= sent_bytes;
+
+		// Remove the commands that have been sent completely
+		size_t remained = sent_bytes;
+
+		for (size_t index = 0; index < command_count; index++)
+		{
+			auto &front = _dispatch_queue.front();
+			auto length = front.GetDataLength();
+
+			if (remained < length)
+			{
+				if (remained > 0)
+				{
+					// Since some data has been sent, the time needs to be updated.
+					front.UpdateTime();
+					front.Consume(remained);
+
+					logad("Part of the data has been sent: %zu bytes, left: %zu bytes (%s)", remained, front.GetDataLength(), front.ToString().CStr());
+				}
+
+				return DispatchResult::PartialDispatched;
+			}
+
+			remained -= length;
+			_dispatch_queue.pop_front();
+		}
+
+		return DispatchResult::Dispatched;
+	}
+
 	Socket::DispatchResult Socket::DispatchEventsInternal()
 	{
 		SOCKET_PROFILER_INIT();
@@ -937,8 +1035,25 @@ namespace ov
 
 				while (_dispatch_queue.empty() == false)
 				{
+					if ((GetType() == SocketType::Tcp) &&
+						(_dispatch_queue.front().type == DispatchCommand::Type::Send) &&
+						(GetState() != SocketState::Closed))
+					{
+						// Send the pending data with as few system calls as possible
+						result = DispatchSendCommandsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							continue;
+						}
+
+						// The rest of the data remains in the queue (PartialDispatched), or an error occurred
+						break;
+					}
+
 					auto front = _dispatch_queue.front();
 					_dispatch_queue.pop_front();
+					_dispatch_queue_bytes -= front.GetDataLength();
 
 					bool is_close_command = front.IsCloseCommand();
 
@@ -954,6 +1069,7 @@ namespace ov
 #endif	// DEBUG
 
 						_dispatch_queue.clear();
+						_dispatch_queue_bytes = 0;
 
 						result = DispatchResult::Dispatched;
 						break;
@@ -970,6 +1086,7 @@ namespace ov
 					{
 						// The data is not fully processed and will not be removed from queue
 
+						_dispatch_queue_bytes += front.GetDataLength();
 						_dispatch_queue.emplace_front(front);
 
 						// Close-related commands will be processed when we receive the event from epoll later
@@ -1080,6 +1197,9 @@ namespace ov
 					OV_ASSERT2(static_cast<ssize_t>(remained) >= sent);
 
 					STATS_COUNTER_INCREASE_PPS();
+					STATS_COUNTER_INCREASE_BUFFERS(1);
+					_send_call_count++;
+					_sent_buffer_count++;
 
 					remained -= sent;
 					total_sent += sent;
@@ -1154,6 +1274,120 @@ namespace ov
 		return total_sent;
 	}
 
+	ssize_t Socket::SendInternal(const std::shared_ptr<const Data> &header, const std::shared_ptr<const Data> &data)
+	{
+		if ((header == nullptr) || header->IsEmpty())
+		{
+			return SendInternal(data);
+		}
+
+		if (GetType() != SocketType::Tcp)
+		{
+			// A datagram/SRT message must be sent at once, so the header and data are concatenated
+			auto concatenated_data = std::make_shared<Data>(header->GetLength() + data->GetLength());
+			concatenated_data->Append(header);
+			concatenated_data->Append(data);
+
+			return SendInternal(concatenated_data);
+		}
+
+		struct iovec iov[2];
+		iov[0].iov_base = const_cast<void *>(header->GetData());
+		iov[0].iov_len = header->GetLength();
+		iov[1].iov_base = const_cast<void *>(data->GetData());
+		iov[1].iov_len = data->GetLength();
+
+		return SendVectorInternal(iov, OV_COUNTOF(iov));
+	}
+
+	ssize_t Socket::SendVectorInternal(struct iovec *iov, size_t iov_count)
+	{
+		if (GetState() == SocketState::Closed)
+		{
+			return -1L;
+		}
+
+		size_t iov_index = 0;
+		size_t remained = 0L;
+		size_t total_sent = 0L;
+
+		for (size_t index = 0; index < iov_count; index++)
+		{
+			remained += iov[index].iov_len;
+		}
+
+		logap("Trying to send data %zu bytes (%zu buffers)...", remained, iov_count);
+
+		while ((remained > 0L) && (_force_stop == false))
+		{
+			struct msghdr message = {};
+			message.msg_iov = &iov[iov_index];
+			message.msg_iovlen = iov_count - iov_index;
+
+			ssize_t sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent < 0L)
+			{
+				auto error = Error::CreateErrorFromErrno();
+
+				switch (error->GetCode())
+				{
+					// Errors that can occur under normal circumstances do not output
+					case EAGAIN:
+						// Socket buffer is full - retry later
+						STATS_COUNTER_INCREASE_RETRY();
+						return total_sent;
+
+					case EBADF:
+					case EPIPE:
+					case ECONNRESET:
+						// The socket is closed or the peer is disconnected
+						break;
+
+					default:
+						logaw("Could not send data: %zd (%s), %s", sent, error->What(), ToString().CStr());
+						break;
+				}
+
+				STATS_COUNTER_INCREASE_ERROR();
+
+				return sent;
+			}
+
+			OV_ASSERT2(static_cast<ssize_t>(remained) >= sent);
+
+			STATS_COUNTER_INCREASE_PPS();
+			STATS_COUNTER_INCREASE_BUFFERS(iov_count - iov_index);
+			_send_call_count++;
+			_sent_buffer_count += (iov_count - iov_index);
+
+			remained -= sent;
+			total_sent += sent;
+
+			// Skip the bytes that have been sent
+			size_t to_skip = sent;
+			while ((to_skip > 0) && (iov_index < iov_count))
+			{
+				auto &item = iov[iov_index];
+
+				if (to_skip < item.iov_len)
+				{
+					item.iov_base = static_cast<uint8_t *>(item.iov_base) + to_skip;
+					item.iov_len -= to_skip;
+					break;
+				}
+
+				to_skip -= item.iov_len;
+				iov_index++;
+			}
+
+			UpdateLastSentTime();
+		}
+
+		logap("%zu bytes sent", total_sent);
+		return total_sent;
+	}
+
 	ssize_t Socket::SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 	{
 		OV_ASSERT2(address.AddressForIPv4()->sin_addr.s_addr != 0);
@@ -1255,13 +1489,21 @@ namespace ov
 	{
 		logad("Socket is ready to read");
 
-		if (_callback != nullptr)
+		// Keep the callback alive while it is called, even if it is replaced by SetAsyncInterface()
+		auto callback = std::atomic_load(&_callback);
+
+		if (callback != nullptr)
 		{
-			_callback->OnReadable();
+			callback->OnReadable();
 		}
 	}
 
 	bool Socket::Send(const std::shared_ptr<const Data> &data)
+	{
+		return Send(nullptr, data);
+	}
+
+	bool Socket::Send(const std::shared_ptr<const Data> &header, const std::shared_ptr<const Data> &data)
 	{
 		switch (GetState())
 		{
@@ -1283,17 +1525,56 @@ namespace ov
 			return false;
 		}
 
+		auto total_length = ((header != nullptr) ? header->GetLength() : 0) + data->GetLength();
+
 		switch (_blocking_mode)
 		{
 			case BlockingMode::Blocking:
-				return (SendInternal(data) == static_cast<ssize_t>(data->GetLength()));
+				return (SendInternal(header, data) == static_cast<ssize_t>(total_length));
 
 			case BlockingMode::NonBlocking:
 				if (GetType() != SocketType::Udp)
 				{
 					CHECK_STATE(== SocketState::Connected, false);
 
-					if (AppendCommand({data->Clone()}))
+					{
+						std::lock_guard lock_guard(_dispatch_queue_lock);
+
+						if (_has_close_command)
+						{
+							// Socket was closed
+							return false;
+						}
+
+						if (_dispatch_queue.empty())
+						{
+							// Nothing is waiting to be sent, so the data is sent directly without putting it into the queue
+							auto sent = SendInternal(header, data);
+
+							if (sent == static_cast<ssize_t>(total_length))
+							{
+								return true;
+							}
+
+							if (sent < 0L)
+							{
+								return false;
+							}
+
+							// Only the rest of the data is queued. Since the caller may modify the data after this function returns,
+							// a COW copy of the data is kept.
+							DispatchCommand command((header != nullptr) ? header->Clone() : nullptr, data->Clone());
+							command.Consume(sent);
+							_dispatch_queue_bytes += command.GetDataLength();
+							_dispatch_queue.push_back(std::move(command));
+
+							_worker->EnqueueToDispatchLater(GetSharedPtr());
+
+							return true;
+						}
+					}
+
+					if (AppendCommand({(header != nullptr) ? header->Clone() : nullptr, data->Clone()}))
 					{
 						// Need to send later
 						switch (DispatchEvents())
@@ -1329,9 +1610,9 @@ namespace ov
 					}
 
 					// Send the data directly
-					auto sent = SendInternal(data);
+					auto sent = SendInternal(header, data);
 
-					if (sent == static_cast<ssize_t>(data->GetLength()))
+					if (sent == static_cast<ssize_t>(total_length))
 					{
 						// The data has been sent
 						return true;
@@ -1339,7 +1620,7 @@ namespace ov
 					else if (sent == 0L)
 					{
 						// Need to send later
-						return AppendCommand({data->Clone()});
+						return AppendCommand({(header != nullptr) ? header->Clone() : nullptr, data->Clone()});
 					}
 
 					// An error occurred
@@ -1709,6 +1990,21 @@ namespace ov
 		return _last_sent_time;
 	}
 
+	size_t Socket::GetDispatchQueueBytes() const
+	{
+		return _dispatch_queue_bytes;
+	}
+
+	uint64_t Socket::GetSendCallCount() const
+	{
+		return _send_call_count;
+	}
+
+	uint64_t Socket::GetSentBufferCount() const
+	{
+		return _sent_buffer_count;
+	}
+
 	void Socket::UpdateLastRecvTime()
 	{
 		_last_recv_time = std::chrono::high_resolution_clock::now();
@@ -1994,6 +2290,7 @@ namespace ov
 			}
 
 			_dispatch_queue.clear();
+			_dispatch_queue_bytes = 0;
 
 			logad("Socket is closed successfully");
 
@@ -20,6 +20,7 @@
 #endif	// !IS_MACOS
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 
 #include <functional>
 #include <map>
@@ -30,6 +31,10 @@
 // For example, it can occur when EAGAIN continues to occur for a period of time, or when the peer's TCP window is full and no longer receives data.
 #define OV_SOCKET_EXPIRE_TIMEOUT (10 * 1000)
 
+// When flushing the dispatch queue of a TCP socket, the pending data is sent with a single sendmsg() up to these limits
+#define OV_SOCKET_MAX_IOV_COUNT 64
+#define OV_SOCKET_MAX_BYTES_PER_SENDMSG (1024 * 1024)
+
 namespace ov
 {
 	// Forward declaration
@@ -96,6 +101,9 @@ namespace ov
 
 		bool MakeBlocking();
 		bool MakeNonBlocking(std::shared_ptr<SocketAsyncInterface> callback);
+		// Replaces the callback of a non-blocking socket that is already running
+		// (Used to hand over a connected socket to another owner, such as a keep-alive connection pool)
+		bool SetAsyncInterface(std::shared_ptr<SocketAsyncInterface> callback);
 
 		bool Bind(const SocketAddress &address);
 		bool Listen(int backlog = SOMAXCONN);
@@ -165,7 +173,7 @@ namespace ov
 		SocketType GetType() const;
 		std::shared_ptr<SocketAsyncInterface> GetAsyncInterface()
 		{
-			return _callback;
+			return std::atomic_load(&_callback);
 		}
 
 		// only available for SRT socket
@@ -173,6 +181,9 @@ namespace ov
 
 		bool Send(const std::shared_ptr<const Data> &data);
 		bool Send(const void *data, size_t length);
+		// Sends the header followed by the payload without concatenating them (TCP uses sendmsg() with two iovecs).
+		// Since the payload is never modified, the same payload can be sent to many sockets without copying.
+		bool Send(const std::shared_ptr<const Data> &header, const std::shared_ptr<const Data> &payload);
 
 		bool SendTo(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		bool SendTo(const SocketAddress &address, const void *data, size_t length);
@@ -195,6 +206,15 @@ namespace ov
 		std::chrono::system_clock::time_point GetLastRecvTime() const;
 		std::chrono::system_clock::time_point GetLastSentTime() const;
 
+		// Bytes of the data waiting to be sent in the dispatch queue (non-blocking mode)
+		// Publishers can use this to detect slow consumers
+		size_t GetDispatchQueueBytes() const;
+
+		// Number of send()/sendmsg() calls that sent data, and number of buffers sent by them
+		// (GetSentBufferCount() / GetSendCallCount() is the average number of buffers coalesced per system call)
+		uint64_t GetSendCallCount() const;
+		uint64_t GetSentBufferCount() const;
+
 		// Dispatches as many command as possible
 		DispatchResult DispatchEvents();
 
@@ -298,6 +318,14 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const std::shared_ptr<const Data> &header, const std::shared_ptr<const Data> &data)
+				: type(Type::Send),
+				  header(header),
+				  data(data),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 				: type(Type::SendTo),
 				  address(address),
@@ -324,6 +352,7 @@ namespace ov
 				: type(another_command.type),
 				  new_state(another_command.new_state),
 				  address(another_command.address),
+				  header(another_command.header),
 				  data(another_command.data),
 				  enqueued_time(another_command.enqueued_time)
 			{
@@ -335,6 +364,7 @@ namespace ov
 				std::swap(type, another_command.type);
 				std::swap(new_state, another_command.new_state);
 				std::swap(address, another_command.address);
+				std::swap(header, another_command.header);
 				std::swap(data, another_command.data);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
@@ -344,6 +374,29 @@ namespace ov
 				return OV_CHECK_FLAG(static_cast<uint8_t>(type), CLOSE_TYPE_MASK);
 			}
 
+			size_t GetDataLength() const
+			{
+				return ((header != nullptr) ? header->GetLength() : 0) + ((data != nullptr) ? data->GetLength() : 0);
+			}
+
+			// Drops the bytes that have been sent from the front of header/data
+			void Consume(size_t bytes)
+			{
+				if (header != nullptr)
+				{
+					if (bytes < header->GetLength())
+					{
+						header = header->Subdata(bytes);
+						return;
+					}
+
+					bytes -= header->GetLength();
+					header = nullptr;
+				}
+
+				data = data->Subdata(bytes);
+			}
+
 			void UpdateTime()
 			{
 				enqueued_time = std::chrono::system_clock::now();
@@ -369,6 +422,11 @@ namespace ov
 					description.AppendFormat(", address: %s", address.ToString(false).CStr());
 				}
 
+				if (header != nullptr)
+				{
+					description.AppendFormat(", header: %zu bytes", header->GetLength());
+				}
+
 				if (data != nullptr)
 				{
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
@@ -382,6 +440,8 @@ namespace ov
 			Type type = Type::Close;
 			SocketState new_state = SocketState::Closed;
 			SocketAddress address;
+			// Optional: sent in front of the data (Used to send per-socket header with the shared data)
+			std::shared_ptr<const Data> header;
 			std::shared_ptr<const Data> data;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
@@ -404,8 +464,13 @@ namespace ov
 		void OnDataAvailableEvent() override;
 
 		DispatchResult DispatchEventInternal(DispatchCommand &command);
+		// Sends the consecutive Send commands at the front of the queue together (TCP only)
+		DispatchResult DispatchSendCommandsInternal();
 
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
+		ssize_t SendInternal(const std::shared_ptr<const Data> &header, const std::shared_ptr<const Data> &data);
+		// Sends the buffers using sendmsg() (TCP only) until all of them are sent or EAGAIN occurs
+		ssize_t SendVectorInternal(struct iovec *iov, size_t iov_count);
 		ssize_t SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 
 		std::shared_ptr<SocketError> RecvInternal(void *data, size_t length, size_t *received_length);
@@ -487,6 +552,7 @@ namespace ov
 
 		mutable std::recursive_mutex _dispatch_queue_lock;
 		std::deque<DispatchCommand> _dispatch_queue;
+		std::atomic<size_t> _dispatch_queue_bytes{0};
 		bool _has_close_command = false;
 
 		std::atomic<bool> _connection_event_fired{false};
@@ -506,5 +572,8 @@ namespace ov
 
 		std::chrono::system_clock::time_point	_last_recv_time = std::chrono::system_clock::now();
 		std::chrono::system_clock::time_point	_last_sent_time = std::chrono::system_clock::now();
+
+		std::atomic<uint64_t> _send_call_count{0};
+		std::atomic<uint64_t> _sent_buffer_count{0};
 	};
 }  // namespace ov
@@ -432,6 +432,29 @@ namespace ov
 		}
 	}
 
+	std::size_t SocketAddress::Hash() const noexcept
+	{
+		// Only the fields compared by operator==() are meaningful for each family
+		std::string_view key;
+
+		switch (_address_storage.ss_family)
+		{
+			case AF_INET:
+				key = std::string_view(reinterpret_cast<const char *>(&_address_storage), sizeof(sockaddr_in));
+				break;
+
+			case AF_INET6:
+				key = std::string_view(reinterpret_cast<const char *>(&_address_storage), sizeof(sockaddr_in6));
+				break;
+
+			default:
+				key = std::string_view(reinterpret_cast<const char *>(&_address_storage), sizeof(_address_storage));
+				break;
+		}
+
+		return std::hash<std::string_view>{}(key);
+	}
+
 	ov::String SocketAddress::ToString(bool ignore_privacy_protect_config) const noexcept
 	{
 		auto server_config = cfg::ConfigManager::GetInstance()->GetServer();
@@ -106,6 +106,9 @@ namespace ov
 
 		ov::String ToString(bool ignore_privacy_protect_config = true) const noexcept;
 
+		// Hash of family, ip and port (for std::unordered_map)
+		std::size_t Hash() const noexcept;
+
 	protected:
 		sockaddr_storage _address_storage{};
 		// _address_storage내 데이터를 가리키는 포인터 (실제로 메모리가 할당되어 있거나 하지는 않음)
@@ -116,4 +119,16 @@ namespace ov
 		ov::String _ip_address;
 		uint16_t _port = 0;
 	};
-}  // namespace ov
\ No newline at end of file
+}  // namespace ov
+
+namespace std
+{
+	template <>
+	struct hash<ov::SocketAddress>
+	{
+		std::size_t operator()(ov::SocketAddress const &address) const
+		{
+			return address.Hash();
+		}
+	};
+}  // namespace std
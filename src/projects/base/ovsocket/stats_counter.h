@@ -16,6 +16,7 @@ namespace ov
 #	define STATS_COUNTER_INCREASE_PPS() stats_counter.IncreasePps()
 #	define STATS_COUNTER_INCREASE_RETRY() stats_counter.IncreaseRetry()
 #	define STATS_COUNTER_INCREASE_ERROR() stats_counter.IncreaseError()
+#	define STATS_COUNTER_INCREASE_BUFFERS(count) stats_counter.IncreaseBuffers(count)
 
 	class StatsCounter
 	{
@@ -53,6 +54,12 @@ namespace ov
 			_total_error_count++;
 		}
 
+		// Number of buffers sent by a send call (more than 1 if the buffers are coalesced)
+		void IncreaseBuffers(int64_t count)
+		{
+			_total_buffer_count += count;
+		}
+
 		void StartTracking()
 		{
 			_stop = false;
@@ -96,6 +103,7 @@ namespace ov
 							int64_t average = _total_count / ((loop_count == 0) ? 1 : loop_count);
 							int64_t retry_average = _total_retry_count / ((loop_count == 0) ? 1 : loop_count);
 							int64_t error_average = _total_error_count / ((loop_count == 0) ? 1 : loop_count);
+							double buffers_per_call = static_cast<double>(_total_buffer_count) / ((_total_count == 0) ? 1 : _total_count);
 
 							logi("SockStat",
 								 "[Stats Counter] Total sampling count: %ld\n"
@@ -105,11 +113,13 @@ namespace ov
 								 "| PPS   | %7ld | %7ld | %7ld | %7ld | %12ld |\n"
 								 "| Retry | %7ld | %7ld | %7ld | %7ld | %12ld |\n"
 								 "| Error | %7ld | %7ld | %7ld | %7ld | %12ld |\n"
-								 "+-------+---------+---------+---------+---------+--------------+\n",
+								 "+-------+---------+---------+---------+---------+--------------+\n"
+								 "Buffers per send call: %.2f\n",
 								 loop_count,
 								 count, max, min, average, static_cast<int64_t>(_total_count),
 								 retry_count, retry_max, retry_min, retry_average, static_cast<int64_t>(_total_retry_count),
-								 error_count, error_max, error_min, error_average, static_cast<int64_t>(_total_error_count));
+								 error_count, error_max, error_min, error_average, static_cast<int64_t>(_total_error_count),
+								 buffers_per_call);
 						}
 
 						sleep(1);
@@ -129,6 +139,8 @@ namespace ov
 		std::atomic<int64_t> _error_count{0};
 		std::atomic<int64_t> _total_error_count{0};
 
+		std::atomic<int64_t> _total_buffer_count{0};
+
 		std::thread _tracking_thread;
 		volatile bool _stop = true;
 	};
@@ -142,5 +154,6 @@ namespace ov
 #	define STATS_COUNTER_INCREASE_PPS() STATS_COUNTER_NOOP()
 #	define STATS_COUNTER_INCREASE_RETRY() STATS_COUNTER_NOOP()
 #	define STATS_COUNTER_INCREASE_ERROR() STATS_COUNTER_NOOP()
+#	define STATS_COUNTER_INCREASE_BUFFERS(count) STATS_COUNTER_NOOP()
 #endif	// USE_STATS_COUNTER
 }  // namespace ov
@@ -123,6 +123,12 @@ namespace pvd
 		// Statistics
 		MonitorInstance->IncreaseBytesIn(*GetSharedPtrAs<info::Stream>(), packet->GetData()->GetLength());
 
+		if (MonitorInstance->IsLatencyTracingOn() && (packet->GetIngestTime() == 0))
+		{
+			// The latency of the following stages is measured from this time
+			packet->SetIngestTime(ov::Clock::NowUSec());
+		}
+
 		_last_pkt_received_time = std::chrono::system_clock::now();
 
 		return _application->SendFrame(GetSharedPtr(), packet);
@@ -317,6 +317,26 @@ namespace pub
 		return application_worker->PushMediaPacket(GetStream(stream->GetId()), media_packet);
 	}
 
+	bool Application::OnSendFrames(const std::shared_ptr<info::Stream> &stream,
+								   const std::vector<std::shared_ptr<MediaPacket>> &media_packets)
+	{
+		auto application_worker = GetWorkerByStreamID(stream->GetId());
+		if (application_worker == nullptr)
+		{
+			return false;
+		}
+
+		// Find the stream only once for the packets
+		auto publisher_stream = GetStream(stream->GetId());
+
+		for (const auto &media_packet : media_packets)
+		{
+			application_worker->PushMediaPacket(publisher_stream, media_packet);
+		}
+
+		return true;
+	}
+
 	uint32_t Application::GetStreamCount()
 	{
 		return _streams.size();
@@ -81,6 +81,8 @@ namespace pub
 		// Put data in ApplicationWorker's queue.
 		bool OnSendFrame(const std::shared_ptr<info::Stream> &stream,
 							  const std::shared_ptr<MediaPacket> &media_packet) override;
+		bool OnSendFrames(const std::shared_ptr<info::Stream> &stream,
+						  const std::vector<std::shared_ptr<MediaPacket>> &media_packets) override;
 
 		uint32_t GetStreamCount();
 		std::shared_ptr<Stream> GetStream(uint32_t stream_id);
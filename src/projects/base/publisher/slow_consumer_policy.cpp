@@ -0,0 +1,119 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "slow_consumer_policy.h"
+
+#include <modules/bitstream/h264/h264_parser.h>
+#include <modules/bitstream/h265/h265_parser.h>
+
+namespace pub
+{
+	SlowConsumerPolicy::FrameInfo SlowConsumerPolicy::GetFrameInfo(const std::shared_ptr<const MediaPacket> &media_packet)
+	{
+		FrameInfo frame_info;
+		auto data = media_packet->GetData();
+
+		frame_info.media_type = media_packet->GetMediaType();
+		frame_info.is_key_frame = (media_packet->GetFlag() == MediaPacketFlag::Key);
+		frame_info.length = data->GetLength();
+
+		if ((frame_info.media_type == cmn::MediaType::Video) && (frame_info.is_key_frame == false))
+		{
+			switch (media_packet->GetBitstreamFormat())
+			{
+				case cmn::BitstreamFormat::H264_ANNEXB:
+					frame_info.is_non_reference = H264Parser::CheckAnnexBNonReferenceFrame(data->GetDataAs<uint8_t>(), data->GetLength());
+					break;
+
+				case cmn::BitstreamFormat::H265_ANNEXB:
+					frame_info.is_non_reference = H265Parser::CheckNonReferenceFrame(data->GetDataAs<uint8_t>(), data->GetLength());
+					break;
+
+				default:
+					// Cannot know whether the frame is referenced by other frames
+					break;
+			}
+		}
+
+		return frame_info;
+	}
+
+	SlowConsumerPolicy::SlowConsumerPolicy(size_t max_buffered_bytes)
+		: _max_buffered_bytes(max_buffered_bytes)
+	{
+	}
+
+	void SlowConsumerPolicy::SetMaxBufferedBytes(size_t max_buffered_bytes)
+	{
+		_max_buffered_bytes = max_buffered_bytes;
+	}
+
+	bool SlowConsumerPolicy::IsEnabled() const
+	{
+		return _max_buffered_bytes > 0;
+	}
+
+	bool SlowConsumerPolicy::ShouldSend(const FrameInfo &frame_info, size_t buffered_bytes)
+	{
+		if (IsEnabled() == false)
+		{
+			return true;
+		}
+
+		if (buffered_bytes > _max_buffered_bytes)
+		{
+			// The client can't keep up, so stop sending until the client drains the buffer
+			if (frame_info.media_type == cmn::MediaType::Video)
+			{
+				_wait_for_key_frame = true;
+			}
+
+			Drop(frame_info);
+			return false;
+		}
+
+		if (frame_info.media_type == cmn::MediaType::Video)
+		{
+			if (_wait_for_key_frame)
+			{
+				// Video frames can't be decoded until the next key frame
+				if (frame_info.is_key_frame == false)
+				{
+					Drop(frame_info);
+					return false;
+				}
+
+				_wait_for_key_frame = false;
+			}
+			else if (frame_info.is_non_reference && (buffered_bytes > (_max_buffered_bytes / 2)))
+			{
+				// No other frame refers to this frame, so it can be dropped without breaking the decoding
+				Drop(frame_info);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	uint64_t SlowConsumerPolicy::GetDroppedFrameCount() const
+	{
+		return _dropped_frame_count;
+	}
+
+	uint64_t SlowConsumerPolicy::GetDroppedBytes() const
+	{
+		return _dropped_bytes;
+	}
+
+	void SlowConsumerPolicy::Drop(const FrameInfo &frame_info)
+	{
+		_dropped_frame_count++;
+		_dropped_bytes += frame_info.length;
+	}
+}  // namespace pub
@@ -0,0 +1,58 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_buffer.h>
+
+#include <atomic>
+
+namespace pub
+{
+	// Decides which frames are sent to a client that cannot receive the data as fast as the stream produces it.
+	// The amount of data waiting to be sent (e.g. ov::Socket::GetDispatchQueueBytes()) is compared with the budget.
+	//
+	// - Less than half of the budget: All frames are sent
+	// - More than half of the budget: Non-reference video frames are dropped
+	// - More than the budget: All frames are dropped, and video is resumed from the next key frame
+	class SlowConsumerPolicy
+	{
+	public:
+		// The frame attributes used to make a decision, which can be evaluated once per frame and shared by sessions
+		struct FrameInfo
+		{
+			cmn::MediaType media_type = cmn::MediaType::Unknown;
+			bool is_key_frame = false;
+			bool is_non_reference = false;
+			size_t length = 0;
+		};
+
+		static FrameInfo GetFrameInfo(const std::shared_ptr<const MediaPacket> &media_packet);
+
+		// max_buffered_bytes == 0 means that the policy is disabled
+		explicit SlowConsumerPolicy(size_t max_buffered_bytes = 0);
+
+		void SetMaxBufferedBytes(size_t max_buffered_bytes);
+		bool IsEnabled() const;
+
+		// Returns true if the frame should be sent
+		bool ShouldSend(const FrameInfo &frame_info, size_t buffered_bytes);
+
+		uint64_t GetDroppedFrameCount() const;
+		uint64_t GetDroppedBytes() const;
+
+	private:
+		void Drop(const FrameInfo &frame_info);
+
+		size_t _max_buffered_bytes = 0;
+		bool _wait_for_key_frame = false;
+
+		std::atomic<uint64_t> _dropped_frame_count{0};
+		std::atomic<uint64_t> _dropped_bytes{0};
+	};
+}  // namespace pub
@@ -2,6 +2,8 @@
 #include "application.h"
 #include "publisher_private.h"
 
+#include "monitoring/monitoring.h"
+
 namespace pub
 {
 	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream)
@@ -114,9 +116,9 @@ namespace pub
 		return _sessions[id];
 	}
 
-	void StreamWorker::SendPacket(const std::any &packet)
+	void StreamWorker::SendPacket(const std::any &packet, int64_t ingest_time_us)
 	{
-		_packet_queue.Enqueue(packet);
+		_packet_queue.Enqueue({packet, ingest_time_us});
 		_queue_event.Notify();
 	}
 
@@ -127,7 +129,7 @@ namespace pub
 		_queue_event.Notify();
 	}
 
-	std::optional<std::any> StreamWorker::PopStreamPacket()
+	std::optional<StreamWorker::StreamPacket> StreamWorker::PopStreamPacket()
 	{
 		if (_packet_queue.IsEmpty())
 		{
@@ -170,13 +172,17 @@ namespace pub
 			auto packet = PopStreamPacket();
 			if (packet.has_value())
 			{		
+				auto &stream_packet = packet.value();
+
 				session_lock.lock();
 				for (auto const &x : _sessions)
 				{
 					auto session = x.second;
-					session->SendOutgoingData(packet.value());
+					session->SendOutgoingData(stream_packet.packet);
 				}
 				session_lock.unlock();
+
+				MonitorInstance->RecordLatency(*_parent, mon::LatencyStage::SessionSend, stream_packet.ingest_time_us);
 			}
 		}
 	}
@@ -381,24 +387,28 @@ namespace pub
 		return _sessions.size();
 	}
 
-	bool Stream::BroadcastPacket(const std::any &packet)
+	bool Stream::BroadcastPacket(const std::any &packet, int64_t ingest_time_us)
 	{
 		if(_worker_count > 0)
 		{
 			std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
 			for (uint32_t i = 0; i < _stream_workers.size(); i++)
 			{
-				_stream_workers[i]->SendPacket(packet);
+				_stream_workers[i]->SendPacket(packet, ingest_time_us);
 			}
 		}
 		else
 		{
-			std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
-			for (auto const &x : _sessions)
 			{
-				auto session = std::static_pointer_cast<Session>(x.second);
-				session->SendOutgoingData(packet);
+				std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+				for (auto const &x : _sessions)
+				{
+					auto session = std::static_pointer_cast<Session>(x.second);
+					session->SendOutgoingData(packet);
+				}
 			}
+
+			MonitorInstance->RecordLatency(*this, mon::LatencyStage::SessionSend, ingest_time_us);
 		}
 	
 		return true;
@@ -27,9 +27,16 @@ namespace pub
 		void SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
 		// Send to all sessions
-		void SendPacket(const std::any &packet);
+		// ingest_time_us: Used to record the latency when the packet is sent (0 if unknown)
+		void SendPacket(const std::any &packet, int64_t ingest_time_us = 0);
 
 	private:
+		struct StreamPacket
+		{
+			std::any packet;
+			int64_t ingest_time_us = 0;
+		};
+
 		void WorkerThread();
 
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
@@ -37,8 +44,8 @@ namespace pub
 		
 		ov::Semaphore _queue_event;
 
-		std::optional<std::any> PopStreamPacket();
-		ov::Queue<std::any> _packet_queue;
+		std::optional<StreamPacket> PopStreamPacket();
+		ov::Queue<StreamPacket> _packet_queue;
 
 		struct SessionMessage
 		{
@@ -83,7 +90,9 @@ namespace pub
 		uint32_t GetSessionCount();
 
 		// A child call this function to delivery packet to all sessions
-		bool BroadcastPacket(const std::any &packet);
+		// ingest_time_us: Ingest time of the media packet that the packet is made from (see MediaPacket::GetIngestTime()).
+		// If it is not 0, the latency is recorded when the packet is sent to the sessions
+		bool BroadcastPacket(const std::any &packet, int64_t ingest_time_us = 0);
 
 		bool SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
@@ -54,10 +54,19 @@ namespace cfg
 				_tags.push_back(tag_info);
 			}
 
-			tag_node = tag_node.next_sibling();
+			tag_node = tag_node.next_sibling("Tag");
 		}
 
 		_log_path = logger_node.child_value("Path");
+
+		// <Async bufferSize="8192">true</Async>
+		pugi::xml_node async_node = logger_node.child("Async");
+		if (async_node.empty() == false)
+		{
+			_is_async = (ov::String(async_node.child_value()).LowerCaseString() == "true");
+			_async_buffer_size = async_node.attribute("bufferSize").as_uint(0);
+		}
+
 		_version = logger_node.attribute("version").value();
 	}
 
@@ -83,6 +92,16 @@ namespace cfg
 		return _version;
 	}
 
+	bool ConfigLoggerLoader::IsAsync() const noexcept
+	{
+		return _is_async;
+	}
+
+	size_t ConfigLoggerLoader::GetAsyncBufferSize() const noexcept
+	{
+		return _async_buffer_size;
+	}
+
 	std::shared_ptr<LoggerTagInfo> ParseTag(pugi::xml_node tag_node)
 	{
 		std::shared_ptr<LoggerTagInfo> tag_info = std::make_shared<LoggerTagInfo>();
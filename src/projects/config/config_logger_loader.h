@@ -29,10 +29,14 @@ namespace cfg
 		std::vector<std::shared_ptr<LoggerTagInfo>> GetTags() const noexcept;
 		ov::String GetLogPath() const noexcept;
 		ov::String GetVersion() const noexcept;
+		bool IsAsync() const noexcept;
+		size_t GetAsyncBufferSize() const noexcept;
 
 	private:
 		std::vector<std::shared_ptr<LoggerTagInfo>> _tags;
 		ov::String _log_path;
+		bool _is_async = false;
+		size_t _async_buffer_size = 0;
 		ov::String _version = "1.0";
 	};
 }  // namespace cfg
\ No newline at end of file
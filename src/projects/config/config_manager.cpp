@@ -227,6 +227,9 @@ namespace cfg
 		// For event logger
 		MonitorInstance->SetLogPath(log_path.CStr());
 
+		::ov_log_set_async(logger_loader->IsAsync(), logger_loader->GetAsyncBufferSize());
+		MonitorInstance->SetLogAsync(logger_loader->IsAsync(), logger_loader->GetAsyncBufferSize());
+
 		// Init stat log
 		//TODO(Getroot): This is temporary code for testing. This will change to more elegant code in the future.
 		::ov_stat_log_set_path(STAT_LOG_WEBRTC_EDGE_SESSION, log_path.CStr());
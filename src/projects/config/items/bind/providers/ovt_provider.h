@@ -0,0 +1,42 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "./provider.h"
+
+namespace cfg
+{
+	namespace bind
+	{
+		namespace pvd
+		{
+			struct OvtProvider : public Provider<cmn::SingularPort>
+			{
+			protected:
+				// If true, the streams pulled from the same origin share persistent connections
+				bool _multiplex = false;
+				// Number of persistent connections per origin (host:port) when multiplexing is enabled
+				int _connections_per_origin = 1;
+
+			public:
+				CFG_DECLARE_CONST_REF_GETTER_OF(IsMultiplexEnabled, _multiplex);
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetConnectionsPerOrigin, _connections_per_origin);
+
+			protected:
+				void MakeList() override
+				{
+					Provider::MakeList();
+
+					Register<Optional>("Multiplex", &_multiplex);
+					Register<Optional>("ConnectionsPerOrigin", &_connections_per_origin);
+				};
+			};
+		}  // namespace pvd
+	}	   // namespace bind
+}  // namespace cfg
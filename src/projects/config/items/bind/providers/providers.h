@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "./ovt_provider.h"
 #include "./provider.h"
 #include "../common/webrtc/webrtc.h"
 
@@ -21,7 +22,7 @@ namespace cfg
 			{
 			protected:
 				// PULL Providers (Client)
-				Provider<cmn::SingularPort> _ovt{};
+				OvtProvider _ovt{};
 				Provider<cmn::SingularPort> _rtspc{};
 
 				// PUSH Providers (Server)
@@ -0,0 +1,30 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Stamps the ingest time on the packets and records the latency histograms of each stage
+		struct LatencyTracing : public ModuleTemplate
+		{
+		protected:
+			void MakeList() override
+			{
+				// Disabled by default because it adds a few clock reads and metric lookups for every packet
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "http2.h"
+#include "latency_tracing.h"
 #include "ll_hls.h"
 #include "p2p.h"
 
@@ -22,11 +23,13 @@ namespace cfg
 			HTTP2 _http2;
 			LLHls _ll_hls;
 			P2P _p2p;
+			LatencyTracing _latency_tracing;
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetHttp2, _http2)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetLLHls, _ll_hls)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetP2P, _p2p)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetLatencyTracing, _latency_tracing)
 
 		protected:
 			void MakeList() override
@@ -34,6 +37,7 @@ namespace cfg
 				Register<Optional>("HTTP2", &_http2);
 				Register<Optional>("LLHLS", &_ll_hls);
 				Register<Optional>({"P2P", "p2p"}, &_p2p);
+				Register<Optional>("LatencyTracing", &_latency_tracing);
 			}
 		};
 	}  // namespace bind
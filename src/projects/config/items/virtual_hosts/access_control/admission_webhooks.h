@@ -22,6 +22,8 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetControlServerUrl, _control_server_url)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetSecretKey, _secret_key)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetTimeoutMsec, _timeout_msec)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetCacheTTLMsec, _cache_ttl_msec)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetCacheTokenKey, _cache_token_key)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledProviders, _enables.GetProviders().GetValue())
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledPublishers, _enables.GetPublishers().GetValue())
 
@@ -43,12 +45,19 @@ namespace cfg
 					Register("ControlServerUrl", &_control_server_url);
 					Register("SecretKey", &_secret_key);
 					Register("Timeout", &_timeout_msec);
+					Register<Optional>("CacheTTL", &_cache_ttl_msec);
+					Register<Optional>("CacheTokenKey", &_cache_token_key);
 					Register("Enables", &_enables);
 				}
 
 				ov::String _control_server_url;
 				ov::String _secret_key;
 				int _timeout_msec = 3000;
+				// How long the decision for the playback of the same URL and client is reused (0: disabled)
+				int _cache_ttl_msec = 0;
+				// Name of the query parameter that identifies the viewer (e.g. token).
+				// If it is present, the decision is shared by the clients that have the same token regardless of their addresses
+				ov::String _cache_token_key;
 
 				Enables _enables;
 			};
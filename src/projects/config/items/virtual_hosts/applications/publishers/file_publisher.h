@@ -28,6 +28,10 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetFilePath, _file_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetInfoPath, _info_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetRootPath, _root_path)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetWriteQueueSize, _write_queue_size)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetWriteBufferSize, _write_buffer_size)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetFlushInterval, _flush_interval)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetFsync, _fsync)
 
 				protected:
 					void MakeList() override
@@ -37,6 +41,10 @@ namespace cfg
 						Register<Optional>("RootPath", &_root_path);
 						Register<Optional>("FilePath", &_file_path);
 						Register<Optional>("InfoPath", &_info_path);
+						Register<Optional>("WriteQueueSize", &_write_queue_size);
+						Register<Optional>("WriteBufferSize", &_write_buffer_size);
+						Register<Optional>("FlushInterval", &_flush_interval);
+						Register<Optional>("Fsync", &_fsync);
 
 						//@deprecated
 						Register<Optional>("FileInfoPath", &_info_path);
@@ -45,6 +53,16 @@ namespace cfg
 					ov::String _root_path = "";
 					ov::String _file_path = "";
 					ov::String _info_path = "";
+
+					// Maximum bytes of the packets waiting to be written by the writer thread
+					// (0: packets are written by the stream thread)
+					int _write_queue_size = 64 * 1024 * 1024;
+					// Size of the buffer that gathers the small writes of the muxer
+					int _write_buffer_size = 1024 * 1024;
+					// Interval to flush the buffer to the file in milliseconds (0: flush only when the buffer is full)
+					int _flush_interval = 1000;
+					// none: never, close: when the file is closed, flush: whenever the buffer is flushed
+					ov::String _fsync = "none";
 				};
 			}  // namespace pub
 		}	   // namespace app
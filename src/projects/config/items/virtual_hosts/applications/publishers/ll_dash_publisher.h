@@ -28,6 +28,9 @@ namespace cfg
 
 					cmn::UtcTiming _utc_timing;
 
+					// Maximum bytes waiting to be sent to a player before the player is disconnected (0: unlimited)
+					int _max_send_buffer_size = 0;
+
 				public:
 					PublisherType GetType() const override
 					{
@@ -39,6 +42,8 @@ namespace cfg
 
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetUtcTiming, _utc_timing)
 
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxSendBufferSize, _max_send_buffer_size)
+
 				protected:
 					void MakeList() override
 					{
@@ -49,6 +54,8 @@ namespace cfg
 
 						Register<Optional>("UTCTiming", &_utc_timing);
 
+						Register<Optional>("MaxSendBufferSize", &_max_send_buffer_size);
+
 						Register<Optional>("CrossDomains", &_cross_domains);
 					}
 				};
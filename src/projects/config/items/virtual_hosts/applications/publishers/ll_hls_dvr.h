@@ -0,0 +1,47 @@
+//=============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				struct LLHlsDvr : public Item
+				{
+				protected:
+					bool _enabled = false;
+					// Segments pushed out of the live window are stored in this directory
+					ov::String _temp_storage_path = "/tmp/ome_dvr/";
+					// seconds
+					int _max_duration = 3600;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enabled)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetTempStoragePath, _temp_storage_path)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxDuration, _max_duration)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Enable", &_enabled);
+						Register<Optional>("TempStoragePath", &_temp_storage_path);
+						Register<Optional>("MaxDuration", &_max_duration, nullptr,
+										   [=]() -> std::shared_ptr<ConfigError> {
+											   return (_max_duration > 0) ? nullptr : CreateConfigErrorPtr("MaxDuration must be greater than 0");
+										   });
+					}
+				};
+			}  // namespace pub
+		} // namespace app
+	} // namespace vhost
+}  // namespace cfg
@@ -11,6 +11,7 @@
 #include "../../../common/cross_domain_support.h"
 #include "dumps/dumps.h"
 #include "ll_hls_cache_control.h"
+#include "ll_hls_dvr.h"
 #include "publisher.h"
 
 namespace cfg
@@ -30,8 +31,11 @@ namespace cfg
 					double _chunk_duration = 0.5;
 					double _part_hold_back = 0; // it will be set to 3 * chunk_duration automatically
 					int _segment_duration = 6;
+					// Push the partial segment of EXT-X-PRELOAD-HINT with the blocking chunklist response (HTTP/2 only)
+					bool _preload_hint_push = false;
 					Dumps _dumps;
 					LLHlsCacheControl _cache_control;
+					LLHlsDvr _dvr;
 
 				public:
 					PublisherType GetType() const override
@@ -44,8 +48,10 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetChunkDuration, _chunk_duration)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPartHoldBack, _part_hold_back)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetSegmentCount, _segment_count)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsPreloadHintPushEnabled, _preload_hint_push)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetDumps, _dumps)
 					CFG_DECLARE_REF_GETTER_OF(GetCacheControl, _cache_control)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetDvr, _dvr)
 
 				protected:
 					void MakeList() override
@@ -57,9 +63,11 @@ namespace cfg
 						Register<Optional>("PartHoldBack", &_part_hold_back);
 						Register<Optional>("SegmentDuration", &_segment_duration);
 						Register<Optional>("SegmentCount", &_segment_count);
+						Register<Optional>("PreloadHintPush", &_preload_hint_push);
 						Register<Optional>("CrossDomains", &_cross_domains);
 						Register<Optional>("Dumps", &_dumps);
 						Register<Optional>("CacheControl", &_cache_control);
+						Register<Optional>("DVR", &_dvr);
 					}
 				};
 			}  // namespace pub
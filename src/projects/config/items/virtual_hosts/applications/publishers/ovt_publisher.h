@@ -20,10 +20,25 @@ namespace cfg
 			{
 				struct OvtPublisher : public Publisher
 				{
+				protected:
+					// Maximum bytes waiting to be sent to an edge before frames are dropped (0: unlimited)
+					int _max_send_buffer_size = 0;
+
+				public:
 					PublisherType GetType() const override
 					{
 						return PublisherType::Ovt;
 					}
+
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxSendBufferSize, _max_send_buffer_size)
+
+				protected:
+					void MakeList() override
+					{
+						Publisher::MakeList();
+
+						Register<Optional>("MaxSendBufferSize", &_max_send_buffer_size);
+					}
 				};
 			}  // namespace pub
 		}	   // namespace app
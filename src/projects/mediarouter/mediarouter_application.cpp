@@ -146,7 +146,13 @@ bool MediaRouteApplication::Stop()
 	_outbound_threads.clear();
 
 	_connectors.clear();
-	_observers.clear();
+
+	{
+		std::lock_guard<std::shared_mutex> lock(_observers_lock);
+
+		_observers.clear();
+		UpdateObserversSnapshot();
+	}
 
 	logtd("[%s(%u)] Mediarouter application has been stopped", _application_info.GetName().CStr(), _application_info.GetId());
 
@@ -205,6 +211,7 @@ bool MediaRouteApplication::RegisterObserverApp(std::shared_ptr<MediaRouteApplic
 	}
 
 	_observers.push_back(observer);
+	UpdateObserversSnapshot();
 
 	logtd("Registered observer. app(%s) type(%d)", _application_info.GetName().CStr(), observer->GetObserverType());
 
@@ -227,12 +234,18 @@ bool MediaRouteApplication::UnregisterObserverApp(std::shared_ptr<MediaRouteAppl
 	}
 
 	_observers.erase(position);
+	UpdateObserversSnapshot();
 
 	logti("Unregistered observer. app(%s) type(%d)", _application_info.GetName().CStr(), observer->GetObserverType());
 
 	return true;
 }
 
+void MediaRouteApplication::UpdateObserversSnapshot()
+{
+	std::atomic_store(&_observers_snapshot, std::shared_ptr<const ObserverList>(std::make_shared<ObserverList>(_observers)));
+}
+
 // OnStreamCreated is called from Provider, Transcoder
 bool MediaRouteApplication::OnStreamCreated(const std::shared_ptr<MediaRouteApplicationConnector> &app_conn, const std::shared_ptr<info::Stream> &stream_info)
 {
@@ -642,7 +655,7 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouteApp
 
 		stream->Push(packet);
 
-		_inbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		ScheduleStream(_inbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())], stream);
 	}
 	// Provider(relay), Transcoder => Outbound Stream
 	else if ((IS_CONNECTOR_PROVIDER(connector_type) && IS_REPRENT_RELAY(representation_type)) ||
@@ -656,7 +669,7 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouteApp
 
 		stream->Push(packet);
 
-		_outbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		ScheduleStream(_outbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())], stream);
 	}
 	else
 	{
@@ -746,13 +759,59 @@ uint32_t MediaRouteApplication::GetWorkerIDByStreamID(info::stream_id_t stream_i
 	return stream_id % _max_worker_thread_count;
 }
 
+void MediaRouteApplication::ScheduleStream(const std::shared_ptr<ov::Queue<std::shared_ptr<MediaRouteStream>>> &indicator, const std::shared_ptr<MediaRouteStream> &stream)
+{
+	// If the stream is already waiting for the worker, the worker will take this packet together
+	if (stream->TrySchedule())
+	{
+		indicator->Enqueue(stream);
+	}
+}
+
+void MediaRouteApplication::PopPackets(std::shared_ptr<MediaRouteStream> &stream, const std::shared_ptr<ov::Queue<std::shared_ptr<MediaRouteStream>>> &indicator, std::vector<std::shared_ptr<MediaPacket>> &media_packets)
+{
+	media_packets.clear();
+
+	stream->Unschedule();
+
+	for (size_t pop_count = 0; (pop_count < MEDIAROUTER_WORKER_MAX_BATCH_SIZE) && (stream->IsPacketQueueEmpty() == false); pop_count++)
+	{
+		// StreamDeliver media packet to Publiser(observer) of Transcoder(observer)
+		auto media_packet = stream->Pop();
+		if (media_packet == nullptr)
+		{
+			continue;
+		}
+
+		// When the stream is finished parsing track information,
+		// Notify the Observer that the stream is parsed
+		if (stream->IsStreamPrepared() == false && stream->AreAllTracksParsed() == true)
+		{
+			logti("[%s/%s(%u)] Stream has been created %s", _application_info.GetName().CStr(), stream->GetStream()->GetName().CStr(), stream->GetStream()->GetId(), stream->GetStream()->GetInfoString().CStr());
+
+			NotifyStreamPrepared(stream);
+		}
+
+		media_packets.push_back(std::move(media_packet));
+	}
+
+	if (stream->IsPacketQueueEmpty() == false)
+	{
+		// Process the remaining packets after the other streams of this worker
+		ScheduleStream(indicator, stream);
+	}
+}
+
 void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 {
 	logtd("Created Inbound worker thread #%d", worker_id);
 
+	auto &indicator = _inbound_stream_indicator[worker_id];
+	std::vector<std::shared_ptr<MediaPacket>> media_packets;
+
 	while (!_kill_flag)
 	{
-		auto msg = _inbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
+		auto msg = indicator->Dequeue(ov::Infinite);
 		if (msg.has_value() == false)
 		{
 			// It may be called due to a normal stop signal.
@@ -765,34 +824,25 @@ void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// StreamDeliver media packet to Publiser(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
+		PopPackets(stream, indicator, media_packets);
+		if (media_packets.empty())
 		{
 			continue;
 		}
 
-		// When the inbound stream is finished parsing track information,
-		// Notify the Observer that the stream is parsed
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksParsed() == true)
+		auto stream_info = stream->GetStream();
+
+		for (const auto &media_packet : media_packets)
 		{
-			logti("[%s/%s(%u)] Stream has been created %s", _application_info.GetName().CStr(), stream->GetStream()->GetName().CStr(), stream->GetStream()->GetId(), stream->GetStream()->GetInfoString().CStr());
-			
-			NotifyStreamPrepared(stream);
+			MonitorInstance->RecordLatency(*stream_info, mon::LatencyStage::MediaRouterInbound, media_packet->GetIngestTime());
 		}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
+		auto observers = std::atomic_load(&_observers_snapshot);
+		for (const auto &observer : *observers)
 		{
-			auto observer_type = observer->GetObserverType();
-
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder)
+			if (observer->GetObserverType() == MediaRouteApplicationObserver::ObserverType::Transcoder)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
-
-				// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
-				observer->OnSendFrame(stream_info, media_packet);
+				observer->OnSendFrames(stream_info, media_packets);
 			}
 		}
 	}
@@ -804,9 +854,12 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 {
 	logtd("Created outbound worker thread #%d", worker_id);
 
+	auto &indicator = _outbound_stream_indicator[worker_id];
+	std::vector<std::shared_ptr<MediaPacket>> media_packets;
+
 	while (!_kill_flag)
 	{
-		auto msg = _outbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
+		auto msg = indicator->Dequeue(ov::Infinite);
 		if (msg.has_value() == false)
 		{
 			// It may be called due to a normal stop signal.
@@ -819,31 +872,25 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// StreamDeliver media packet to Publiser(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
+		PopPackets(stream, indicator, media_packets);
+		if (media_packets.empty())
 		{
 			continue;
 		}
 
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksParsed() == true)
-		{
-			logti("[%s/%s(%u)] Stream has been created %s", _application_info.GetName().CStr(), stream->GetStream()->GetName().CStr(), stream->GetStream()->GetId(), stream->GetStream()->GetInfoString().CStr());
+		auto stream_info = stream->GetStream();
 
-			NotifyStreamPrepared(stream);
+		for (const auto &media_packet : media_packets)
+		{
+			MonitorInstance->RecordLatency(*stream_info, mon::LatencyStage::MediaRouterOutbound, media_packet->GetIngestTime());
 		}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
+		auto observers = std::atomic_load(&_observers_snapshot);
+		for (const auto &observer : *observers)
 		{
-			auto observer_type = observer->GetObserverType();
-
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Publisher)
+			if (observer->GetObserverType() == MediaRouteApplicationObserver::ObserverType::Publisher)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
-
-				observer->OnSendFrame(stream_info, media_packet);
+				observer->OnSendFrames(stream_info, media_packets);
 			}
 		}
 	}
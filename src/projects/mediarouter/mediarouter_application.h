@@ -21,6 +21,10 @@
 #include "base/mediarouter/mediarouter_interface.h"
 #include "mediarouter_stream.h"
 
+// Maximum number of the packets that a worker takes from a stream at once.
+// If the stream has more packets, the stream is scheduled again after the other streams
+#define MEDIAROUTER_WORKER_MAX_BATCH_SIZE (64)
+
 class ApplicationInfo;
 class Stream;
 class RelayServer;
@@ -126,6 +130,13 @@ private:
 	std::vector<std::shared_ptr<MediaRouteApplicationObserver>> _observers;
 	std::shared_mutex _observers_lock;
 
+	// Copy of _observers for the workers (read-copy-update).
+	// The workers load the snapshot without a lock, and the snapshot is replaced whenever _observers is changed
+	using ObserverList = std::vector<std::shared_ptr<MediaRouteApplicationObserver>>;
+	std::shared_ptr<const ObserverList> _observers_snapshot = std::make_shared<ObserverList>();
+	// _observers_lock must be locked
+	void UpdateObserversSnapshot();
+
 	// Information of MediaStream instance
 	// Inbound Streams
 	// Key : Stream.id
@@ -138,6 +149,9 @@ private:
 
 private:
 	uint32_t GetWorkerIDByStreamID(info::stream_id_t stream_id);
+	void ScheduleStream(const std::shared_ptr<ov::Queue<std::shared_ptr<MediaRouteStream>>> &indicator, const std::shared_ptr<MediaRouteStream> &stream);
+	// Takes the packets of the stream (up to MEDIAROUTER_WORKER_MAX_BATCH_SIZE)
+	void PopPackets(std::shared_ptr<MediaRouteStream> &stream, const std::shared_ptr<ov::Queue<std::shared_ptr<MediaRouteStream>>> &indicator, std::vector<std::shared_ptr<MediaPacket>> &media_packets);
 	void InboundWorkerThread(uint32_t worker_id);
 	void OutboundWorkerThread(uint32_t worker_id);
 
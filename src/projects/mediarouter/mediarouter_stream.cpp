@@ -773,6 +773,16 @@ bool MediaRouteStream::AreAllTracksParsed()
 	return true;
 }
 
+// The statistics of the stream are only printed as the debug log, so they are not made when it is not printed
+static bool IsStatisticsLogEnabled()
+{
+#if DEBUG
+	return ov_log_get_enabled(OV_LOG_TAG, OVLogLevelDebug);
+#else
+	return false;
+#endif
+}
+
 void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
 {
 	auto track_id = media_track->GetId();
@@ -816,7 +826,7 @@ void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track
 	_stat_recv_pkt_size[track_id] += media_packet->GetData()->GetLength();
 	_stat_recv_pkt_count[track_id]++;
 
-	if (_stop_watch.IsElapsed(10000) && _stop_watch.Update())
+	if (_stop_watch.IsElapsed(10000) && _stop_watch.Update() && IsStatisticsLogEnabled())
 	{
 		// Uptime
 		int64_t uptime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - _stat_start_time).count();
@@ -980,6 +990,21 @@ void MediaRouteStream::Push(std::shared_ptr<MediaPacket> media_packet)
 	_packets_queue.Enqueue(std::move(media_packet));
 }
 
+bool MediaRouteStream::IsPacketQueueEmpty()
+{
+	return _packets_queue.IsEmpty();
+}
+
+bool MediaRouteStream::TrySchedule()
+{
+	return (_is_scheduled.exchange(true) == false);
+}
+
+void MediaRouteStream::Unschedule()
+{
+	_is_scheduled = false;
+}
+
 std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 {
 	// Get Media Packet
@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <queue>
 #include <vector>
@@ -44,6 +45,12 @@ public:
 	bool ProcessOutboundStream(std::shared_ptr<MediaTrack> &media_track,std::shared_ptr<MediaPacket> &media_packet);
 
 	std::shared_ptr<MediaPacket> Pop();
+	bool IsPacketQueueEmpty();
+
+	// Returns true if the stream was not waiting for a worker, so the caller must hand the stream over to the worker
+	bool TrySchedule();
+	// Called by the worker before it takes the packets, so the packets pushed after this schedule the stream again
+	void Unschedule();
 
 	// Query original stream information
 	std::shared_ptr<info::Stream> GetStream();
@@ -84,6 +91,8 @@ private:
 
 	// Packets queue
 	ov::Queue<std::shared_ptr<MediaPacket>> _packets_queue;
+	// Whether the stream is in the indicator queue of the worker
+	std::atomic<bool> _is_scheduled{false};
 
 	// TODO(Soulk) : Modified to use by tying statistical information into a class and creating a map with MediaTrackId as a key
 
@@ -1,5 +1,7 @@
 #include "access_controller.h"
 
+#include <modules/http/client/http_connection_pool.h>
+#include "admission_webhooks/admission_webhooks_cache.h"
 #include <orchestrator/orchestrator.h>
 
 #define OV_LOG_TAG "AccessController"
@@ -91,14 +93,9 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 			return {AccessController::VerificationResult::Error, nullptr};
 		}
 
-		logti("AdmissionWebhooks queried %s whether client %s could access %s. (Result : %s Elapsed : %u ms)",
-			control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(),
-			admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElpasedTime());
-
-		if(admission_webhooks->GetErrCode() != AdmissionWebhooks::ErrCode::ALLOWED)
-		{
-			return {AccessController::VerificationResult::Fail, admission_webhooks};
-		}
+		// The closing notification is sent asynchronously, so the result is logged by AdmissionWebhooks when the response is received
+		logtd("AdmissionWebhooks is notifying %s that client %s has closed %s",
+			control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr());
 
 		return {AccessController::VerificationResult::Pass, admission_webhooks};
 	}
@@ -159,13 +156,33 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		auto timeout_msec = webhooks_config.GetTimeoutMsec();
 
 		std::shared_ptr<AdmissionWebhooks> admission_webhooks;
+		auto cache_result = AdmissionWebhooksCache::Result::Miss;
 		if(_provider_type != ProviderType::Unknown)
 		{
 			admission_webhooks = AdmissionWebhooks::Query(_provider_type, control_server_url, timeout_msec, secret_key, client_address, request_url);
 		}
 		else if(_publisher_type != PublisherType::Unknown)
 		{
-			admission_webhooks = AdmissionWebhooks::Query(_publisher_type, control_server_url, timeout_msec, secret_key, client_address, request_url);
+			auto query = [=]() {
+				return AdmissionWebhooks::Query(_publisher_type, control_server_url, timeout_msec, secret_key, client_address, request_url);
+			};
+
+			auto cache_ttl_msec = webhooks_config.GetCacheTTLMsec();
+			if (cache_ttl_msec > 0)
+			{
+				// A burst of viewers of the same stream shares one query
+				auto cache = AdmissionWebhooksCache::GetInstance();
+				auto key = AdmissionWebhooksCache::MakeKey(StringFromPublisherType(_publisher_type), request_url, client_address, webhooks_config.GetCacheTokenKey());
+
+				admission_webhooks = cache->Get(key, cache_ttl_msec, query, &cache_result);
+
+				logtd("AdmissionWebhooks cache: %s (hit: %" PRIu64 ", coalesced: %" PRIu64 ", miss: %" PRIu64 ", average latency: %.1f ms, max latency: %" PRIu64 " ms)",
+					  key.CStr(), cache->GetHitCount(), cache->GetCoalescedCount(), cache->GetMissCount(), cache->GetAverageLatency(), cache->GetMaxLatency());
+			}
+			else
+			{
+				admission_webhooks = query();
+			}
 		}
 		else
 		{
@@ -180,8 +197,19 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 			return {AccessController::VerificationResult::Error, nullptr};
 		}
 
-		logti("AdmissionWebhooks queried %s whether client %s could access %s. (Result : %s Elapsed : %u ms)",
-			control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(), admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElpasedTime());
+		if(cache_result == AdmissionWebhooksCache::Result::Miss)
+		{
+			auto connection_pool = http::clnt::HttpConnectionPool::GetInstance();
+			logti("AdmissionWebhooks queried %s whether client %s could access %s. (Result : %s Elapsed : %u ms Connection : %s, Pool hit rate : %.1f%%)",
+				control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(), admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElpasedTime(),
+				admission_webhooks->IsConnectionReused() ? "reused" : "new", connection_pool->GetHitRate());
+		}
+		else
+		{
+			logtd("AdmissionWebhooks reused the decision of %s for client %s to access %s. (Result : %s, %s)",
+				control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(), admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject",
+				(cache_result == AdmissionWebhooksCache::Result::Hit) ? "cached" : "coalesced");
+		}
 
 		if(admission_webhooks->GetErrCode() != AdmissionWebhooks::ErrCode::ALLOWED)
 		{
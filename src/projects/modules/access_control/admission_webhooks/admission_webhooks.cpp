@@ -1,6 +1,9 @@
 #include "admission_webhooks.h"
 
 #include <modules/http/client/http_client.h>
+#include <modules/http/client/http_connection_pool.h>
+
+#define OV_LOG_TAG "AdmissionWebhooks"
 
 std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
 															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
@@ -58,7 +61,16 @@ ov::String AdmissionWebhooks::GetErrReason() const
 
 std::shared_ptr<ov::Url> AdmissionWebhooks::GetNewURL() const
 {
-	return _new_url;
+	if (_new_url == nullptr)
+	{
+		return nullptr;
+	}
+
+	// The decision may be shared by several sessions (AdmissionWebhooksCache), and the caller may modify the URL
+	auto new_url = std::make_shared<ov::Url>();
+	*new_url = *_new_url;
+
+	return new_url;
 }
 
 uint64_t AdmissionWebhooks::GetLifetime() const
@@ -71,6 +83,11 @@ uint64_t AdmissionWebhooks::GetElpasedTime() const
 	return _elapsed_ms;
 }
 
+bool AdmissionWebhooks::IsConnectionReused() const
+{
+	return _is_connection_reused;
+}
+
 void AdmissionWebhooks::SetError(ErrCode code, ov::String reason)
 {
 	_err_code = code;
@@ -233,9 +250,15 @@ void AdmissionWebhooks::Run()
 
 	auto signature_sha1_base64 = ov::Base64::Encode(md_sha1, true);
 
+	// The result of the closing notification is not used by anyone, so it doesn't block the caller
+	// and the response is handled by SocketPoolWorker
+	auto is_async = (_status == Status::Code::CLOSING);
+
 	auto client = std::make_shared<http::clnt::HttpClient>();
 	client->SetMethod(http::Method::Post);
-	client->SetBlockingMode(ov::BlockingMode::Blocking);
+	client->SetBlockingMode(is_async ? ov::BlockingMode::NonBlocking : ov::BlockingMode::Blocking);
+	// Reuse the connection to the control server to avoid TCP/TLS handshake for every admission
+	client->SetKeepAlive(true);
 	client->SetConnectionTimeout(_timeout_msec);
 	client->SetRequestHeader("X-OME-Signature", signature_sha1_base64);
 	client->SetRequestHeader("Content-Type", "application/json");
@@ -245,30 +268,51 @@ void AdmissionWebhooks::Run()
 	ov::StopWatch watch;
 	watch.Start();
 
-	client->Request(_control_server_url->ToUrlString(true), [=](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) 
+	// Keep this instance alive until the response is received
+	auto self = shared_from_this();
+	// The client is alive while its response handler is called
+	auto client_ptr = client.get();
+
+	client->Request(_control_server_url->ToUrlString(true), [self, client_ptr, watch, is_async](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) 
 	{
-		_elapsed_ms = watch.Elapsed();
-
-		// A response was received from the server.
-		if(error == nullptr) 
-		{	
-			if(status_code == http::StatusCode::OK) 
-			{
-				// Parsing response
-				ParseResponse(data);
-				return;
-			} 
-			else 
-			{
-				SetError(ErrCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(status_code)));
-				return;
-			}
+		self->OnResponse(watch.Elapsed(), client_ptr->IsConnectionReused(), status_code, data, error);
+
+		if (is_async)
+		{
+			logti("AdmissionWebhooks notified %s that client %s has closed %s. (Result : %s Elapsed : %" PRIu64 " ms Connection : %s)",
+				  self->_control_server_url->ToUrlString(true).CStr(),
+				  (self->_client_address != nullptr) ? self->_client_address->ToString(false).CStr() : "-",
+				  (self->_requested_url != nullptr) ? self->_requested_url->ToUrlString().CStr() : "-",
+				  (self->_err_code == ErrCode::ALLOWED) ? "Allow" : "Reject", self->_elapsed_ms,
+				  self->_is_connection_reused ? "reused" : "new");
 		}
-		else
+	});
+}
+
+void AdmissionWebhooks::OnResponse(uint64_t elapsed_ms, bool is_connection_reused, http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error)
+{
+	_elapsed_ms = elapsed_ms;
+	_is_connection_reused = is_connection_reused;
+
+	// A response was received from the server.
+	if(error == nullptr) 
+	{	
+		if(status_code == http::StatusCode::OK) 
+		{
+			// Parsing response
+			ParseResponse(data);
+			return;
+		} 
+		else 
 		{
-			// A connection error or an error that does not conform to the HTTP spec has occurred.
-			SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", error->GetCode(), error->GetMessage().CStr()));
+			SetError(ErrCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(status_code)));
 			return;
 		}
-	});
+	}
+	else
+	{
+		// A connection error or an error that does not conform to the HTTP spec has occurred.
+		SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", error->GetCode(), error->GetMessage().CStr()));
+		return;
+	}
 }
@@ -3,8 +3,9 @@
 #include <base/common_types.h>
 #include <base/ovlibrary/ovlibrary.h>
 #include <base/ovsocket/socket_address.h>
+#include <modules/http/http_datastructure.h>
 
-class AdmissionWebhooks
+class AdmissionWebhooks : public std::enable_shared_from_this<AdmissionWebhooks>
 {
 public:
 	enum class ErrCode : uint8_t
@@ -59,15 +60,19 @@ public:
 	std::shared_ptr<ov::Url> GetNewURL() const;
 	uint64_t GetLifetime() const;
 	uint64_t GetElpasedTime() const;
+	// Returns true if the request was sent over a keep-alive connection
+	bool IsConnectionReused() const;
 	
 private:
 	void Run();
 	ov::String GetMessageBody();
 	void SetError(ErrCode code, ov::String reason);
 
+	void OnResponse(uint64_t elapsed_ms, bool is_connection_reused, http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error);
 	void ParseResponse(const std::shared_ptr<ov::Data> &data);
 
 	uint64_t _elapsed_ms = 0;
+	bool _is_connection_reused = false;
 
 	// Request
 	std::shared_ptr<ov::Url> _control_server_url = nullptr;
@@ -81,7 +86,7 @@ private:
 
 	// Response
 	bool _allowed = false;
-	ErrCode _err_code;
+	ErrCode _err_code = ErrCode::INTERNAL_ERROR;
 	ov::String _err_reason;
 	std::shared_ptr<ov::Url> _new_url = nullptr;
 	uint64_t _lifetime = 0;
@@ -0,0 +1,212 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "admission_webhooks_cache.h"
+
+#define OV_LOG_TAG "AdmissionWebhooks"
+
+// The query parameters that change for every request of the same session
+static bool IsVolatileQueryKey(const ov::String &key)
+{
+	// _HLS_msn, _HLS_part, _HLS_skip, ... : LL-HLS delivery directives
+	// session : LL-HLS session id issued by OvenMediaEngine
+	return key.HasPrefix("_HLS_") || (key == "session");
+}
+
+ov::String AdmissionWebhooksCache::MakeKey(const ov::String &type, const std::shared_ptr<const ov::Url> &request_url, const std::shared_ptr<ov::SocketAddress> &client_address,
+										   const ov::String &token_key)
+{
+	ov::String key = ov::String::FormatString("%s|%s", type.CStr(), request_url->ToUrlString(false).CStr());
+	bool has_token = false;
+
+	// QueryMap() is sorted by the key, so the order of the parameters doesn't affect the key
+	for (const auto &[query_key, query_value] : request_url->QueryMap())
+	{
+		if (IsVolatileQueryKey(query_key))
+		{
+			continue;
+		}
+
+		if ((token_key.IsEmpty() == false) && (query_key == token_key) && (query_value.IsEmpty() == false))
+		{
+			has_token = true;
+		}
+
+		key.AppendFormat("&%s=%s", query_key.CStr(), query_value.CStr());
+	}
+
+	// Other query parameters (e.g. transport=tcp) don't identify the viewer,
+	// so the decision is not shared with other clients unless the configured token is present
+	if ((has_token == false) && (client_address != nullptr))
+	{
+		key.AppendFormat("|%s", client_address->GetIpAddress().CStr());
+	}
+
+	return key;
+}
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooksCache::Get(const ov::String &key, int64_t ttl_msec,
+															   const std::function<std::shared_ptr<AdmissionWebhooks>()> &query,
+															   Result *result)
+{
+	std::shared_ptr<InFlight> in_flight;
+
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		auto entry = _entries.find(key);
+		if (entry != _entries.end())
+		{
+			if (entry->second.expire_time_msec > ov::Clock::NowMSec())
+			{
+				_hit_count++;
+				if (result != nullptr)
+				{
+					*result = Result::Hit;
+				}
+
+				return entry->second.decision;
+			}
+
+			_entries.erase(entry);
+		}
+
+		auto in_flight_item = _in_flights.find(key);
+		if (in_flight_item != _in_flights.end())
+		{
+			// Another thread is querying the control server for the same key
+			auto waiting = in_flight_item->second;
+
+			_condition.wait(lock, [&waiting]() {
+				return waiting->completed;
+			});
+
+			_coalesced_count++;
+			if (result != nullptr)
+			{
+				*result = Result::Coalesced;
+			}
+
+			if (waiting->error != nullptr)
+			{
+				std::rethrow_exception(waiting->error);
+			}
+
+			return waiting->decision;
+		}
+
+		in_flight = std::make_shared<InFlight>();
+		_in_flights[key] = in_flight;
+	}
+
+	_miss_count++;
+	if (result != nullptr)
+	{
+		*result = Result::Miss;
+	}
+
+	std::shared_ptr<AdmissionWebhooks> decision;
+
+	try
+	{
+		decision = query();
+	}
+	catch (...)
+	{
+		// Release the waiting requests, otherwise they wait forever
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			in_flight->completed = true;
+			in_flight->error = std::current_exception();
+			_in_flights.erase(key);
+		}
+
+		_condition.notify_all();
+
+		throw;
+	}
+
+	if (decision != nullptr)
+	{
+		UpdateLatency(decision->GetElpasedTime());
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		in_flight->completed = true;
+		in_flight->decision = decision;
+		_in_flights.erase(key);
+
+		// Errors (e.g. timeout) are not cached so that the next request queries the control server again
+		auto error_code = (decision != nullptr) ? decision->GetErrCode() : AdmissionWebhooks::ErrCode::INTERNAL_ERROR;
+
+		if ((ttl_msec > 0) && ((error_code == AdmissionWebhooks::ErrCode::ALLOWED) || (error_code == AdmissionWebhooks::ErrCode::DENIED)))
+		{
+			// The decision must not outlive the lifetime given by the control server
+			auto lifetime = static_cast<int64_t>(decision->GetLifetime());
+			if ((lifetime > 0) && (lifetime < ttl_msec))
+			{
+				ttl_msec = lifetime;
+			}
+
+			auto now = ov::Clock::NowMSec();
+
+			if (_entries.size() >= ADMISSION_WEBHOOKS_CACHE_MAX_ENTRIES)
+			{
+				EvictExpiredEntries(now);
+			}
+
+			if (_entries.size() < ADMISSION_WEBHOOKS_CACHE_MAX_ENTRIES)
+			{
+				_entries[key] = {decision, now + static_cast<uint64_t>(ttl_msec)};
+			}
+			else
+			{
+				logtw("Could not cache the decision for %s: too many entries (%zu)", key.CStr(), _entries.size());
+			}
+		}
+	}
+
+	_condition.notify_all();
+
+	return decision;
+}
+
+double AdmissionWebhooksCache::GetAverageLatency() const
+{
+	uint64_t miss_count = _miss_count;
+
+	return (miss_count > 0) ? (static_cast<double>(_total_latency_msec) / miss_count) : 0.0;
+}
+
+void AdmissionWebhooksCache::EvictExpiredEntries(uint64_t now_msec)
+{
+	for (auto entry = _entries.begin(); entry != _entries.end();)
+	{
+		if (entry->second.expire_time_msec <= now_msec)
+		{
+			entry = _entries.erase(entry);
+		}
+		else
+		{
+			++entry;
+		}
+	}
+}
+
+void AdmissionWebhooksCache::UpdateLatency(uint64_t latency_msec)
+{
+	_total_latency_msec += latency_msec;
+
+	auto max_latency = _max_latency_msec.load();
+	while ((latency_msec > max_latency) && (_max_latency_msec.compare_exchange_weak(max_latency, latency_msec) == false))
+	{
+	}
+}
@@ -0,0 +1,106 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/socket_address.h>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+
+#include "admission_webhooks.h"
+
+// If there are more entries than this, the decision is not cached until the expired entries are removed
+#define ADMISSION_WEBHOOKS_CACHE_MAX_ENTRIES (64 * 1024)
+
+// Caches the decisions of the control server, so that a burst of identical admissions
+// (e.g. thousands of viewers start to play the same stream) results in a single request
+class AdmissionWebhooksCache : public ov::Singleton<AdmissionWebhooksCache>
+{
+public:
+	enum class Result
+	{
+		// The decision was found in the cache
+		Hit,
+		// The decision was made by another request in progress for the same key
+		Coalesced,
+		// The control server was queried
+		Miss
+	};
+
+	// The volatile query parameters (e.g. _HLS_msn) are excluded from the key.
+	// The decision is shared only by the requests from the same client address,
+	// unless the URL has the token parameter (token_key) that identifies the viewer, then it is shared by the clients that have the same token.
+	static ov::String MakeKey(const ov::String &type, const std::shared_ptr<const ov::Url> &request_url, const std::shared_ptr<ov::SocketAddress> &client_address,
+							  const ov::String &token_key);
+
+	// Returns the decision for the key.
+	// If there is no valid decision, query is called (only once for the concurrent requests for the same key)
+	// and its decision is cached for ttl_msec (but not longer than the lifetime of the decision).
+	// If query throws, the exception is rethrown to the caller and to the requests that are waiting for it.
+	std::shared_ptr<AdmissionWebhooks> Get(const ov::String &key, int64_t ttl_msec,
+										   const std::function<std::shared_ptr<AdmissionWebhooks>()> &query,
+										   Result *result = nullptr);
+
+	uint64_t GetHitCount() const
+	{
+		return _hit_count;
+	}
+
+	uint64_t GetCoalescedCount() const
+	{
+		return _coalesced_count;
+	}
+
+	uint64_t GetMissCount() const
+	{
+		return _miss_count;
+	}
+
+	// Average time taken by the control server to respond (in milliseconds)
+	double GetAverageLatency() const;
+	uint64_t GetMaxLatency() const
+	{
+		return _max_latency_msec;
+	}
+
+protected:
+	struct Entry
+	{
+		std::shared_ptr<AdmissionWebhooks> decision;
+		uint64_t expire_time_msec = 0;
+	};
+
+	struct InFlight
+	{
+		bool completed = false;
+		std::shared_ptr<AdmissionWebhooks> decision;
+		// Set if the query has thrown an exception
+		std::exception_ptr error;
+	};
+
+	// Remove the expired entries (_mutex must be locked)
+	void EvictExpiredEntries(uint64_t now_msec);
+
+	void UpdateLatency(uint64_t latency_msec);
+
+	std::mutex _mutex;
+	std::condition_variable _condition;
+
+	std::unordered_map<ov::String, Entry> _entries;
+	std::unordered_map<ov::String, std::shared_ptr<InFlight>> _in_flights;
+
+	std::atomic<uint64_t> _hit_count{0};
+	std::atomic<uint64_t> _coalesced_count{0};
+	std::atomic<uint64_t> _miss_count{0};
+
+	std::atomic<uint64_t> _total_latency_msec{0};
+	std::atomic<uint64_t> _max_latency_msec{0};
+};
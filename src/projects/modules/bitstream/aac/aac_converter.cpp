@@ -227,6 +227,25 @@ std::shared_ptr<ov::Data> AacConverter::ConvertAdtsToRaw(const std::shared_ptr<c
 	return raw_data;
 }
 
+std::shared_ptr<const ov::Data> AacConverter::GetRawData(const std::shared_ptr<const MediaPacket> &packet, std::vector<size_t> *length_list)
+{
+	switch (packet->GetBitstreamFormat())
+	{
+		case cmn::BitstreamFormat::AAC_RAW:
+			[[fallthrough]];
+		case cmn::BitstreamFormat::AAC_ADTS:
+			return packet->GetConvertedData(
+				cmn::BitstreamFormat::AAC_RAW,
+				[](const std::shared_ptr<const ov::Data> &data, std::vector<size_t> *length_list) -> std::shared_ptr<ov::Data> {
+					return ConvertAdtsToRaw(data, length_list);
+				},
+				length_list);
+
+		default:
+			return nullptr;
+	}
+}
+
 ov::String AacConverter::GetProfileString(const std::shared_ptr<AACSpecificConfig> &aac_config)
 {
 	if(aac_config == nullptr)
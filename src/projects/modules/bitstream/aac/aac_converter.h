@@ -15,6 +15,9 @@ public:
 	static std::shared_ptr<ov::Data> ConvertRawToAdts(const uint8_t *data, size_t data_len, const AACSpecificConfig &aac_config);
 	static std::shared_ptr<ov::Data> ConvertRawToAdts(const std::shared_ptr<const ov::Data> &data, const std::shared_ptr<AACSpecificConfig> &aac_config);
 	static std::shared_ptr<ov::Data> ConvertAdtsToRaw(const std::shared_ptr<const ov::Data> &data, std::vector<size_t> *length_list);
+	// Returns the data of the packet in raw format (AAC_RAW or AAC_ADTS packet only).
+	// The ADTS packet is converted only once and the result is shared by all the callers
+	static std::shared_ptr<const ov::Data> GetRawData(const std::shared_ptr<const MediaPacket> &packet, std::vector<size_t> *length_list);
 
 	static ov::String GetProfileString(const std::shared_ptr<AACSpecificConfig> &aac_config);
 	static ov::String GetProfileString(const std::vector<uint8_t> &codec_extradata);
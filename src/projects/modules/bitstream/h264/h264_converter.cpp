@@ -328,6 +328,24 @@ std::shared_ptr<ov::Data> H264Converter::ConvertAnnexbToAvcc(const std::shared_p
 	return avcc_data;
 }
 
+std::shared_ptr<const ov::Data> H264Converter::GetAvccData(const std::shared_ptr<const MediaPacket> &packet)
+{
+	switch (packet->GetBitstreamFormat())
+	{
+		case cmn::BitstreamFormat::H264_AVCC:
+			[[fallthrough]];
+		case cmn::BitstreamFormat::H264_ANNEXB:
+			return packet->GetConvertedData(
+				cmn::BitstreamFormat::H264_AVCC,
+				[](const std::shared_ptr<const ov::Data> &data, std::vector<size_t> *length_list) -> std::shared_ptr<ov::Data> {
+					return ConvertAnnexbToAvcc(data);
+				});
+
+		default:
+			return nullptr;
+	}
+}
+
 ov::String H264Converter::GetProfileString(const std::shared_ptr<ov::Data> &codec_extradata)
 {
 	AVCDecoderConfigurationRecord record;
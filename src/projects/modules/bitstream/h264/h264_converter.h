@@ -19,4 +19,8 @@ public:
 
 	static std::shared_ptr<ov::Data> ConvertAvccToAnnexb(const std::shared_ptr<const ov::Data> &data);
 	static std::shared_ptr<ov::Data> ConvertAnnexbToAvcc(const std::shared_ptr<const ov::Data> &data);
+
+	// Returns the data of the packet in AVCC format (H264_AVCC or H264_ANNEXB packet only).
+	// The Annex-B packet is converted only once and the result is shared by all the callers
+	static std::shared_ptr<const ov::Data> GetAvccData(const std::shared_ptr<const MediaPacket> &packet);
 };
@@ -64,6 +64,40 @@ bool H264Parser::CheckAnnexBKeyframe(const uint8_t *bitstream, size_t length)
 	return false;
 }
 
+bool H264Parser::CheckAnnexBNonReferenceFrame(const uint8_t *bitstream, size_t length)
+{
+	size_t offset = 0;
+	while (offset < length)
+	{
+		size_t start_code_size = 0;
+
+		auto pos = FindAnnexBStartCode(bitstream + offset, length - offset, start_code_size);
+		if (pos == -1)
+		{
+			break;
+		}
+
+		offset = offset + pos + start_code_size;
+		if (length - offset > H264_NAL_UNIT_HEADER_SIZE)
+		{
+			H264NalUnitHeader header;
+			ParseNalUnitHeader(bitstream + offset, H264_NAL_UNIT_HEADER_SIZE, header);
+
+			// The first slice decides
+			if (header.GetNalUnitType() == H264NalUnitType::NonIdrSlice || header.GetNalUnitType() == H264NalUnitType::DPA)
+			{
+				return header.GetNalRefIdc() == 0;
+			}
+			else if (header.GetNalUnitType() == H264NalUnitType::IdrSlice)
+			{
+				return false;
+			}
+		}
+	}
+
+	return false;
+}
+
 bool H264Parser::ParseNalUnitHeader(const uint8_t *nalu, size_t length, H264NalUnitHeader &header)
 {
 	if (length < H264_NAL_UNIT_HEADER_SIZE)
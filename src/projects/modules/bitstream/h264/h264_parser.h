@@ -89,6 +89,11 @@ public:
     {
         return _type;
     }
+
+    uint8_t GetNalRefIdc()
+    {
+        return _nal_ref_idc;
+    }
 private:
     uint8_t _nal_ref_idc = 0;
     H264NalUnitType _type = H264NalUnitType::Unspecified;
@@ -104,6 +109,8 @@ public:
 	// returns -1 if there is no start code in the buffer
 	static int FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &code_size);
     static bool CheckAnnexBKeyframe(const uint8_t *bitstream, size_t length);
+    // Returns true if the slices of the frame are not used for reference (nal_ref_idc == 0), so the frame can be dropped
+    static bool CheckAnnexBNonReferenceFrame(const uint8_t *bitstream, size_t length);
     static bool ParseNalUnitHeader(const uint8_t *nalu, size_t length, H264NalUnitHeader &header);
     static bool ParseSPS(const uint8_t *nalu, size_t length, H264SPS &sps);
     static bool ParseVUI(NalUnitBitstreamParser &parser, H264SPS &sps);
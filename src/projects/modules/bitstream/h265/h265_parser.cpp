@@ -81,6 +81,39 @@ bool H265Parser::CheckKeyframe(const uint8_t *bitstream, size_t length)
 	return false;
 }
 
+bool H265Parser::CheckNonReferenceFrame(const uint8_t *bitstream, size_t length)
+{
+	size_t offset = 0;
+	while (offset < length)
+	{
+		size_t start_code_size = 0;
+
+		auto pos = FindAnnexBStartCode(bitstream + offset, length - offset, start_code_size);
+		if (pos == -1)
+		{
+			break;
+		}
+
+		offset = offset + pos + start_code_size;
+		if (length - offset > H265_NAL_UNIT_HEADER_SIZE)
+		{
+			H265NalUnitHeader header;
+			ParseNalUnitHeader(bitstream + offset, H265_NAL_UNIT_HEADER_SIZE, header);
+
+			auto type = static_cast<uint8_t>(header.GetNalUnitType());
+
+			// The first VCL NAL unit decides (0 ~ 31 are VCL NAL unit types)
+			if (type <= 31)
+			{
+				// TRAIL_N, TSA_N, STSA_N, RADL_N, RASL_N and RSV_VCL_N10/12/14 are even numbers less than 16
+				return (type < 16) && ((type % 2) == 0);
+			}
+		}
+	}
+
+	return false;
+}
+
 bool H265Parser::ParseNalUnitHeader(const uint8_t *nalu, size_t length, H265NalUnitHeader &header)
 {
 	NalUnitBitstreamParser parser(nalu, length);
@@ -149,6 +149,8 @@ public:
 	// returns -1 if there is no start code in the buffer
 	static int FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &start_code_size);
     static bool CheckKeyframe(const uint8_t *bitstream, size_t length);
+    // Returns true if the frame is a sub-layer non-reference picture (TRAIL_N, TSA_N, ...), so the frame can be dropped
+    static bool CheckNonReferenceFrame(const uint8_t *bitstream, size_t length);
     static bool ParseNalUnitHeader(const uint8_t *nalu, size_t length, H265NalUnitHeader &header);
     static bool ParseSPS(const uint8_t *nalu, size_t length, H265SPS &sps);
 
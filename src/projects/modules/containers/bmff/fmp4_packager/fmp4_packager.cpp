@@ -305,7 +305,14 @@ namespace bmff
 		}
 		else if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::H264_ANNEXB)
 		{
-			auto converted_data = H264Converter::ConvertAnnexbToAvcc(media_packet->GetData());
+			// The conversion is cached in the packet and shared by the other packagers, so the
+			// new packet gets its own copy instead of a mutable alias of the shared result
+			auto avcc_data = H264Converter::GetAvccData(media_packet);
+			if (avcc_data == nullptr)
+			{
+				return nullptr;
+			}
+			auto converted_data = avcc_data->Clone();
 			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::H264_AVCC);
@@ -315,7 +322,12 @@ namespace bmff
 		}
 		else if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::AAC_ADTS)
 		{
-			auto raw_data = AacConverter::ConvertAdtsToRaw(media_packet->GetData(), nullptr);
+			auto adts_free_data = AacConverter::GetRawData(media_packet, nullptr);
+			if (adts_free_data == nullptr)
+			{
+				return nullptr;
+			}
+			auto raw_data = adts_free_data->Clone();
 			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
 			new_packet->SetData(raw_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::AAC_RAW);
@@ -0,0 +1,169 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "fmp4_shared_storage.h"
+
+#include "fmp4_private.h"
+
+namespace bmff
+{
+	bool FMP4SharedTrack::AppendState::Update(const void *appender, const std::shared_ptr<const MediaPacket> &media_packet)
+	{
+		if (this->appender != appender)
+		{
+			if (this->appender != nullptr)
+			{
+				// Another publisher appends the packets
+				return false;
+			}
+
+			this->appender = appender;
+			handing_over = received;
+		}
+
+		if (handing_over)
+		{
+			// The new appender may be behind the previous one, so the packets that are not newer than the last appended one are skipped.
+			// (If the MSID is changed, the timestamps may be reset)
+			if ((msid == media_packet->GetMsid()) && (media_packet->GetDts() <= dts))
+			{
+				return false;
+			}
+
+			handing_over = false;
+		}
+
+		received = true;
+		msid = media_packet->GetMsid();
+		dts = media_packet->GetDts();
+
+		return true;
+	}
+
+	void FMP4SharedTrack::AppendState::Release(const void *appender)
+	{
+		if (this->appender == appender)
+		{
+			this->appender = nullptr;
+		}
+	}
+
+	FMP4SharedTrack::FMP4SharedTrack(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track,
+									 const FMP4Packager::Config &packager_config, const FMP4Storage::Config &storage_config)
+	{
+		// The observers are added by the publishers
+		_storage = std::make_shared<FMP4Storage>(nullptr, media_track, storage_config);
+		_packager = std::make_shared<FMP4Packager>(_storage, media_track, data_track, packager_config);
+	}
+
+	bool FMP4SharedTrack::Initialize()
+	{
+		std::lock_guard<std::mutex> lock(_packager_lock);
+
+		return _packager->CreateInitializationSegment();
+	}
+
+	bool FMP4SharedTrack::AppendSample(const void *appender, const std::shared_ptr<const MediaPacket> &media_packet)
+	{
+		std::lock_guard<std::mutex> lock(_packager_lock);
+
+		if (_sample_state.Update(appender, media_packet) == false)
+		{
+			// Another publisher appends this packet
+			return true;
+		}
+
+		return _packager->AppendSample(media_packet);
+	}
+
+	bool FMP4SharedTrack::ReserveDataPacket(const void *appender, const std::shared_ptr<const MediaPacket> &media_packet)
+	{
+		std::lock_guard<std::mutex> lock(_packager_lock);
+
+		if (_data_packet_state.Update(appender, media_packet) == false)
+		{
+			return true;
+		}
+
+		return _packager->ReserveDataPacket(media_packet);
+	}
+
+	void FMP4SharedTrack::ReleaseAppender(const void *appender)
+	{
+		std::lock_guard<std::mutex> lock(_packager_lock);
+
+		_sample_state.Release(appender);
+		_data_packet_state.Release(appender);
+	}
+
+	ov::String FMP4SharedStorage::MakeKey(uint32_t stream_id,
+										  const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track,
+										  const FMP4Packager::Config &packager_config, const FMP4Storage::Config &storage_config)
+	{
+		// The DVR storage path is not a part of the key because it is different for each publisher,
+		// so the path of the publisher that creates the track is used
+		return ov::String::FormatString("%u/%d/%d/%.3f/%.3f/%u/%llu/%s/%llu",
+										stream_id,
+										media_track->GetId(),
+										(data_track != nullptr) ? data_track->GetId() : -1,
+										packager_config.chunk_duration_ms, packager_config.segment_duration_ms,
+										storage_config.max_segments, storage_config.segment_duration_ms,
+										storage_config.dvr_enabled ? "dvr" : "-", storage_config.dvr_duration_sec);
+	}
+
+	std::shared_ptr<FMP4SharedTrack> FMP4SharedStorage::GetTrack(uint32_t stream_id,
+																 const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track,
+																 const FMP4Packager::Config &packager_config, const FMP4Storage::Config &storage_config)
+	{
+		if (media_track == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto key = MakeKey(stream_id, media_track, data_track, packager_config, storage_config);
+
+		std::lock_guard<std::mutex> lock(_tracks_lock);
+
+		auto item = _tracks.find(key);
+		if (item != _tracks.end())
+		{
+			auto track = item->second.lock();
+			if (track != nullptr)
+			{
+				logtd("Shared fMP4 track is reused: %s", key.CStr());
+				return track;
+			}
+		}
+
+		auto track = std::make_shared<FMP4SharedTrack>(media_track, data_track, packager_config, storage_config);
+		if (track->Initialize() == false)
+		{
+			logte("Could not create initialization segment of the shared fMP4 track: %s", key.CStr());
+			return nullptr;
+		}
+
+		// Remove the tracks of the deleted streams
+		for (auto it = _tracks.begin(); it != _tracks.end();)
+		{
+			if (it->second.expired())
+			{
+				it = _tracks.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		_tracks[key] = track;
+
+		logtd("Shared fMP4 track is created: %s", key.CStr());
+
+		return track;
+	}
+}  // namespace bmff
@@ -0,0 +1,89 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "fmp4_packager.h"
+#include "fmp4_storage.h"
+
+namespace bmff
+{
+	// The fMP4 packager and storage of a track that are shared by the publishers of the same stream (LL-HLS, DASH),
+	// so the media is packaged and stored only once regardless of the number of enabled protocols
+	class FMP4SharedTrack
+	{
+	public:
+		FMP4SharedTrack(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track,
+						const FMP4Packager::Config &packager_config, const FMP4Storage::Config &storage_config);
+
+		bool Initialize();
+
+		const std::shared_ptr<FMP4Storage> &GetStorage() const
+		{
+			return _storage;
+		}
+
+		// Every publisher passes the packets it receives, but only the packets of one publisher (the appender) are appended,
+		// because the publishers receive the same packets at their own pace. The first publisher that passes a packet becomes
+		// the appender, and another publisher takes over when it calls ReleaseAppender().
+		//
+		// The observers of the storage are called by the thread of the appender with _packager_lock held,
+		// so they must not call the methods of FMP4SharedTrack and should return quickly (they delay the other publishers).
+		bool AppendSample(const void *appender, const std::shared_ptr<const MediaPacket> &media_packet);
+		bool ReserveDataPacket(const void *appender, const std::shared_ptr<const MediaPacket> &media_packet);
+
+		// Called when the publisher no longer passes the packets
+		void ReleaseAppender(const void *appender);
+
+	protected:
+		struct AppendState
+		{
+			const void *appender = nullptr;
+
+			// The last packet appended by the previous appender
+			bool received = false;
+			bool handing_over = false;
+			uint32_t msid = 0;
+			int64_t dts = 0LL;
+
+			// Returns true if the packet is to be appended
+			bool Update(const void *appender, const std::shared_ptr<const MediaPacket> &media_packet);
+			void Release(const void *appender);
+		};
+
+		std::shared_ptr<FMP4Storage> _storage;
+		std::shared_ptr<FMP4Packager> _packager;
+
+		// The publishers append the packets in their own threads
+		std::mutex _packager_lock;
+		AppendState _sample_state;
+		AppendState _data_packet_state;
+	};
+
+	class FMP4SharedStorage : public ov::Singleton<FMP4SharedStorage>
+	{
+	public:
+		// Returns the track of the stream that is being packaged with the same configuration, or creates a new one.
+		// The track is released when all the publishers release it.
+		std::shared_ptr<FMP4SharedTrack> GetTrack(uint32_t stream_id,
+												  const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track,
+												  const FMP4Packager::Config &packager_config, const FMP4Storage::Config &storage_config);
+
+	protected:
+		static ov::String MakeKey(uint32_t stream_id,
+								  const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track,
+								  const FMP4Packager::Config &packager_config, const FMP4Storage::Config &storage_config);
+
+		std::mutex _tracks_lock;
+		std::unordered_map<ov::String, std::weak_ptr<FMP4SharedTrack>> _tracks;
+	};
+}  // namespace bmff
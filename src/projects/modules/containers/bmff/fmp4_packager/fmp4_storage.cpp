@@ -11,18 +11,64 @@
 #include "fmp4_storage.h"
 #include "fmp4_private.h"
 
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <set>
+
 namespace bmff
 {
 	FMP4Storage::FMP4Storage(const std::shared_ptr<FMp4StorageObserver> &observer, const std::shared_ptr<const MediaTrack> &track, const FMP4Storage::Config &config)
 	{
 		_config = config;
 		_track = track;
-		_observer = observer;
+
+		if (observer != nullptr)
+		{
+			_observers.push_back(observer);
+		}
 
 		// Keep 2x more even if pushed out of chunklist
 		_config.max_segments *= 2;
 		
 		_target_segment_duration_ms = _config.segment_duration_ms;
+
+		if (_config.dvr_enabled == true && OpenDvrFile() == false)
+		{
+			logtw("Could not open DVR file, DVR is disabled : track(%u) path(%s)", _track->GetId(), _config.dvr_storage_path.CStr());
+			_config.dvr_enabled = false;
+		}
+	}
+
+	FMP4Storage::~FMP4Storage()
+	{
+		CloseDvrFile();
+	}
+
+	void FMP4Storage::AddObserver(const std::shared_ptr<FMp4StorageObserver> &observer)
+	{
+		{
+			std::lock_guard<std::shared_mutex> lock(_observers_lock);
+			_observers.push_back(observer);
+		}
+
+		if (_initialization_section != nullptr)
+		{
+			observer->OnFMp4StorageInitialized(_track->GetId());
+		}
+	}
+
+	void FMP4Storage::RemoveObserver(const std::shared_ptr<FMp4StorageObserver> &observer)
+	{
+		std::lock_guard<std::shared_mutex> lock(_observers_lock);
+		_observers.erase(std::remove(_observers.begin(), _observers.end(), observer), _observers.end());
+	}
+
+	std::vector<std::shared_ptr<FMp4StorageObserver>> FMP4Storage::GetObservers() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_observers_lock);
+		return _observers;
 	}
 
 	std::shared_ptr<ov::Data> FMP4Storage::GetInitializationSection() const
@@ -31,6 +77,22 @@ namespace bmff
 	}
 
 	std::shared_ptr<FMP4Segment> FMP4Storage::GetMediaSegment(uint32_t segment_number) const
+	{
+		auto segment = GetMemorySegment(segment_number);
+		if (segment != nullptr)
+		{
+			return segment;
+		}
+
+		if (_config.dvr_enabled == false)
+		{
+			return nullptr;
+		}
+
+		return LoadSegmentFromDvrFile(segment_number);
+	}
+
+	std::shared_ptr<FMP4Segment> FMP4Storage::GetMemorySegment(uint32_t segment_number) const
 	{
 		std::shared_lock<std::shared_mutex> lock(_segments_lock);
 		auto index = segment_number - _number_of_deleted_segments;
@@ -56,8 +118,8 @@ namespace bmff
 
 	std::shared_ptr<FMP4Chunk> FMP4Storage::GetMediaChunk(uint32_t segment_number, uint32_t chunk_number) const
 	{
-		// Get Media Segement
-		auto segment = GetMediaSegment(segment_number);
+		// Get Media Segement (Chunks are only kept in memory)
+		auto segment = GetMemorySegment(segment_number);
 		if (segment == nullptr)
 		{
 			return nullptr;
@@ -66,7 +128,7 @@ namespace bmff
 		// last chunk number + 1 of completed segment is the first chunk of the next segment
 		if (segment->IsCompleted() && segment->GetLastChunkNumber() + 1 == chunk_number)
 		{
-			segment = GetMediaSegment(segment_number + 1);
+			segment = GetMemorySegment(segment_number + 1);
 			if (segment == nullptr)
 			{
 				return nullptr;
@@ -117,10 +179,12 @@ namespace bmff
 	bool FMP4Storage::StoreInitializationSection(const std::shared_ptr<ov::Data> &section)
 	{
 		_initialization_section = section;
-		if (_observer != nullptr)
+
+		for (const auto &observer : GetObservers())
 		{
-			_observer->OnFMp4StorageInitialized(_track->GetId());
+			observer->OnFMp4StorageInitialized(_track->GetId());
 		}
+
 		return true;
 	}
 
@@ -136,24 +200,41 @@ namespace bmff
 		if (segment == nullptr || segment->IsCompleted())
 		{
 			// Notify observer
-			if (segment != nullptr && _observer != nullptr)
+			if (segment != nullptr)
 			{
-				_observer->OnMediaSegmentUpdated(_track->GetId(), segment->GetNumber());
+				for (const auto &observer : GetObservers())
+				{
+					observer->OnMediaSegmentUpdated(_track->GetId(), segment->GetNumber());
+				}
 			}
 
 			// Create new segment
 			segment = std::make_shared<FMP4Segment>(GetLastSegmentNumber() + 1, _config.segment_duration_ms);
+			std::shared_ptr<FMP4Segment> old_segment = nullptr;
 			{
 				std::lock_guard<std::shared_mutex> lock(_segments_lock);
 				_segments.push_back(segment);
 				_last_segment_number = segment->GetNumber();
 
-				// Delete old segments
 				if (_segments.size() > _config.max_segments)
 				{
-					_number_of_deleted_segments++;
-					_segments.pop_front();
+					old_segment = _segments.front();
+				}
+			}
+
+			// Delete old segments
+			if (old_segment != nullptr)
+			{
+				// The old segment is written to the DVR file before it is removed from memory,
+				// so that there is no moment when it can be found in neither.
+				if (_config.dvr_enabled == true)
+				{
+					SaveSegmentToDvrFile(old_segment);
 				}
+
+				std::lock_guard<std::shared_mutex> lock(_segments_lock);
+				_number_of_deleted_segments++;
+				_segments.pop_front();
 			}
 		}
 
@@ -178,11 +259,221 @@ namespace bmff
 		_min_chunk_duration_ms = std::min(_min_chunk_duration_ms, duration_ms);
 
 		// Notify observer
-		if (_observer != nullptr)
+		for (const auto &observer : GetObservers())
+		{
+			observer->OnMediaChunkUpdated(_track->GetId(), segment->GetNumber(), segment->GetLastChunkNumber());
+		}
+
+		return true;
+	}
+
+	bool FMP4Storage::OpenDvrFile()
+	{
+		if (ov::PathManager::MakeDirectory(_config.dvr_storage_path.CStr()) == false)
+		{
+			logte("Could not create DVR directory : %s", _config.dvr_storage_path.CStr());
+			return false;
+		}
+
+		_dvr_file_path = ov::PathManager::Combine(_config.dvr_storage_path, ov::String::FormatString("track_%u_%s.dvr", _track->GetId(), ov::Random::GenerateString(8).CStr()));
+
+		_dvr_fd = ::open(_dvr_file_path.CStr(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (_dvr_fd < 0)
+		{
+			logte("Could not open DVR file : %s (%s)", _dvr_file_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		logtd("DVR file is opened : track(%u) file(%s) max duration(%llu)", _track->GetId(), _dvr_file_path.CStr(), _config.dvr_duration_sec);
+
+		return true;
+	}
+
+	void FMP4Storage::CloseDvrFile()
+	{
+		std::lock_guard<std::shared_mutex> lock(_dvr_lock);
+
+		if (_dvr_fd >= 0)
+		{
+			::close(_dvr_fd);
+			_dvr_fd = -1;
+
+			ov::PathManager::DeleteFile(_dvr_file_path);
+
+			// The directory of the stream is shared by the tracks, so it is removed by the last one (rmdir fails while it is not empty)
+			::rmdir(_config.dvr_storage_path.CStr());
+		}
+
+		_dvr_index.clear();
+	}
+
+	void FMP4Storage::RemoveDvrLeftovers(const ov::String &path)
+	{
+		static std::mutex cleaned_paths_lock;
+		static std::set<ov::String> cleaned_paths;
+
+		{
+			std::lock_guard<std::mutex> lock(cleaned_paths_lock);
+			if (cleaned_paths.insert(path).second == false)
+			{
+				return;
+			}
+		}
+
+		auto dir = ::opendir(path.CStr());
+		if (dir == nullptr)
+		{
+			// Nothing is left
+			return;
+		}
+
+		std::vector<ov::String> stream_paths;
+		while (auto item = ::readdir(dir))
+		{
+			ov::String name = item->d_name;
+			if ((name == ".") || (name == ".."))
+			{
+				continue;
+			}
+
+			auto stream_path = ov::PathManager::Combine(path, name);
+			if (ov::PathManager::IsDirectory(stream_path))
+			{
+				stream_paths.push_back(stream_path);
+			}
+		}
+		::closedir(dir);
+
+		for (const auto &stream_path : stream_paths)
+		{
+			// Only the files made by OpenDvrFile() are deleted, so a directory that has other files is kept
+			std::vector<ov::String> file_list;
+			if (ov::PathManager::GetFileList(stream_path, ov::PathManager::Combine(stream_path, "track_*.dvr"), &file_list, false) != nullptr)
+			{
+				continue;
+			}
+
+			for (const auto &file : file_list)
+			{
+				ov::PathManager::DeleteFile(file);
+			}
+
+			if (::rmdir(stream_path.CStr()) == 0)
+			{
+				logti("DVR files left by the previous run are removed : %s", stream_path.CStr());
+			}
+		}
+	}
+
+	bool FMP4Storage::SaveSegmentToDvrFile(const std::shared_ptr<FMP4Segment> &segment)
+	{
+		auto data = segment->GetData();
+		if (data == nullptr || _dvr_fd < 0)
+		{
+			return false;
+		}
+
+		// Only this thread appends to the file, so the data can be written without holding the lock
+		auto buffer = data->GetDataAs<uint8_t>();
+		size_t remained = data->GetLength();
+		off_t offset = _dvr_file_size;
+
+		while (remained > 0)
+		{
+			auto written = ::pwrite(_dvr_fd, buffer, remained, offset);
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				logte("Could not write segment to DVR file : track(%u) segment(%lld) (%s)", _track->GetId(), segment->GetNumber(), ov::Error::CreateErrorFromErrno()->What());
+				return false;
+			}
+
+			buffer += written;
+			offset += written;
+			remained -= written;
+		}
+
+		std::lock_guard<std::shared_mutex> lock(_dvr_lock);
+
+		DvrSegmentIndex index;
+		index.number = segment->GetNumber();
+		index.offset = _dvr_file_size;
+		index.size = data->GetLength();
+		index.start_timestamp = segment->GetStartTimestamp();
+		index.duration_ms = segment->GetDuration();
+
+		_dvr_index.push_back(index);
+		_dvr_file_size = offset;
+		_dvr_duration_ms += index.duration_ms;
+
+		// Expire the oldest segments and give the disk space back
+		while (_dvr_index.size() > 1 && _dvr_duration_ms > (_config.dvr_duration_sec * 1000.0))
 		{
-			_observer->OnMediaChunkUpdated(_track->GetId(), segment->GetNumber(), segment->GetLastChunkNumber());
+			auto &oldest = _dvr_index.front();
+
+			if (::fallocate(_dvr_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, oldest.offset, oldest.size) < 0)
+			{
+				logtd("Could not release the space of DVR file : %s (%s)", _dvr_file_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			}
+
+			_dvr_duration_ms -= oldest.duration_ms;
+			_dvr_index.pop_front();
 		}
 
 		return true;
 	}
+
+	std::shared_ptr<FMP4Segment> FMP4Storage::LoadSegmentFromDvrFile(uint32_t segment_number) const
+	{
+		std::shared_lock<std::shared_mutex> lock(_dvr_lock);
+
+		if (_dvr_fd < 0 || _dvr_index.empty())
+		{
+			return nullptr;
+		}
+
+		// Segment numbers in the index are ascending, but not sequential if a segment could not be written
+		auto item = std::lower_bound(_dvr_index.begin(), _dvr_index.end(), segment_number,
+									 [](const DvrSegmentIndex &index, uint32_t number) {
+										 return index.number < number;
+									 });
+		if (item == _dvr_index.end() || item->number != segment_number)
+		{
+			return nullptr;
+		}
+
+		auto index = *item;
+
+		auto data = std::make_shared<ov::Data>(index.size);
+		data->SetLength(index.size);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		size_t remained = index.size;
+		off_t offset = index.offset;
+
+		while (remained > 0)
+		{
+			auto read_bytes = ::pread(_dvr_fd, buffer, remained, offset);
+			if (read_bytes <= 0)
+			{
+				if (read_bytes < 0 && errno == EINTR)
+				{
+					continue;
+				}
+
+				logte("Could not read segment from DVR file : track(%u) segment(%u) (%s)", _track->GetId(), segment_number, ov::Error::CreateErrorFromErrno()->What());
+				return nullptr;
+			}
+
+			buffer += read_bytes;
+			offset += read_bytes;
+			remained -= read_bytes;
+		}
+
+		return std::make_shared<FMP4Segment>(index.number, data, index.start_timestamp, index.duration_ms);
+	}
 } // namespace bmff
\ No newline at end of file
@@ -27,9 +27,20 @@ namespace bmff
 		{
 			uint32_t max_segments = 10;
 			uint64_t segment_duration_ms = 6000;
+
+			// DVR: segments pushed out of memory are appended to a file in dvr_storage_path
+			bool dvr_enabled = false;
+			ov::String dvr_storage_path;
+			uint64_t dvr_duration_sec = 0;
 		};
 
 		FMP4Storage(const std::shared_ptr<FMp4StorageObserver> &observer, const std::shared_ptr<const MediaTrack> &track, const Config &config);
+		~FMP4Storage();
+
+		// A storage can be shared by several publishers, each of them observes the storage.
+		// If the initialization section is already stored, OnFMp4StorageInitialized() is called immediately.
+		void AddObserver(const std::shared_ptr<FMp4StorageObserver> &observer);
+		void RemoveObserver(const std::shared_ptr<FMp4StorageObserver> &observer);
 
 		std::shared_ptr<ov::Data> GetInitializationSection() const;
 		std::shared_ptr<FMP4Segment> GetMediaSegment(uint32_t segment_number) const;
@@ -47,7 +58,28 @@ namespace bmff
 
 		uint64_t GetTargetSegmentDuration() const;
 
+		// Removes the DVR files and the stream directories (<path>/<stream>_<key>) left by a previous run that did not shut down cleanly.
+		// Only the first call for a path in the process does it, because the later calls may find the files of the running streams.
+		static void RemoveDvrLeftovers(const ov::String &path);
+
 	private:
+		// Index of a segment stored in the DVR file
+		struct DvrSegmentIndex
+		{
+			uint32_t number = 0;
+			off_t offset = 0;
+			size_t size = 0;
+			int64_t start_timestamp = 0;
+			double duration_ms = 0;
+		};
+
+		std::shared_ptr<FMP4Segment> GetMemorySegment(uint32_t segment_number) const;
+
+		bool OpenDvrFile();
+		void CloseDvrFile();
+		bool SaveSegmentToDvrFile(const std::shared_ptr<FMP4Segment> &segment);
+		std::shared_ptr<FMP4Segment> LoadSegmentFromDvrFile(uint32_t segment_number) const;
+
 		Config	_config;
 		std::shared_ptr<const MediaTrack> _track;
 
@@ -67,6 +99,18 @@ namespace bmff
 
 		uint64_t _target_segment_duration_ms = 0;
 
-		std::shared_ptr<FMp4StorageObserver> _observer;
+		// DVR file is append-only, the space of expired segments is released by punching holes
+		int _dvr_fd = -1;
+		ov::String _dvr_file_path;
+		off_t _dvr_file_size = 0;
+		double _dvr_duration_ms = 0;
+		// 0 -> 1 -> 2 -> push_back(evicted segment)
+		std::deque<DvrSegmentIndex> _dvr_index;
+		mutable std::shared_mutex _dvr_lock;
+
+		std::vector<std::shared_ptr<FMp4StorageObserver>> GetObservers() const;
+
+		std::vector<std::shared_ptr<FMp4StorageObserver>> _observers;
+		mutable std::shared_mutex _observers_lock;
 	};
 }
\ No newline at end of file
@@ -74,6 +74,16 @@ namespace bmff
 			_data = std::make_shared<ov::Data>(((1000.0 * 1000.0 * 4.0)/8.0) * (static_cast<double>(target_duration) / 1000.0));
 		}
 
+		// Completed segment restored from the DVR file, it has no chunk information
+		FMP4Segment(uint64_t number, const std::shared_ptr<ov::Data> &data, int64_t start_timestamp, double duration_ms)
+		{
+			_number = number;
+			_data = data;
+			_start_timestamp = start_timestamp;
+			_duration_ms = duration_ms;
+			_is_completed = true;
+		}
+
 		void SetCompleted()
 		{
 			_is_completed = true;
@@ -1,6 +1,9 @@
 #include "file_writer.h"
 
+#include <fcntl.h>
 #include <modules/bitstream/h264/h264_converter.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "private.h"
 
@@ -95,6 +98,8 @@ bool FileWriter::SetPath(const ov::String path, const ov::String format)
 		_format_context = nullptr;
 	}
 
+	CloseFile();
+
 	const AVOutputFormat *output_format = nullptr;
 
 	// If the format is nullptr, it is automatically set based on the extension.
@@ -126,6 +131,142 @@ ov::String FileWriter::GetPath()
 	return _path;
 }
 
+void FileWriter::SetWriteBufferSize(size_t size)
+{
+	std::lock_guard<std::shared_mutex> mlock(_lock);
+
+	// Round up to the page size, so that each flush writes whole pages
+	long page_size = ::sysconf(_SC_PAGESIZE);
+	if ((page_size > 0) && (size > 0))
+	{
+		size = ((size + page_size - 1) / page_size) * page_size;
+	}
+
+	_write_buffer_size = size;
+}
+
+void FileWriter::SetFsyncPolicy(FsyncPolicy policy)
+{
+	_fsync_policy = policy;
+}
+
+FileWriter::FsyncPolicy FileWriter::FsyncPolicyFromString(const ov::String &policy)
+{
+	auto lower_policy = policy.LowerCaseString();
+
+	if (lower_policy == "close")
+	{
+		return FsyncPolicy::Close;
+	}
+	else if (lower_policy == "flush")
+	{
+		return FsyncPolicy::Flush;
+	}
+
+	return FsyncPolicy::None;
+}
+
+bool FileWriter::OpenFile()
+{
+	_fd = ::open(_format_context->url, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	if (_fd < 0)
+	{
+		logte("Error opening file. error(%d), %s", errno, _format_context->url);
+		return false;
+	}
+
+	// av_malloc() returns a memory aligned for SIMD, and the buffer is released by CloseFile()
+	auto buffer = static_cast<uint8_t *>(av_malloc(_write_buffer_size));
+	if (buffer == nullptr)
+	{
+		logte("Could not allocate the write buffer. size(%zu)", _write_buffer_size);
+		CloseFile();
+		return false;
+	}
+
+	_avio_context = avio_alloc_context(buffer, _write_buffer_size, 1, this, nullptr, OnWrite, OnSeek);
+	if (_avio_context == nullptr)
+	{
+		logte("Could not allocate the I/O context");
+		av_free(buffer);
+		CloseFile();
+		return false;
+	}
+
+	// mp4 muxer rewrites the header when the file is closed
+	_avio_context->seekable = AVIO_SEEKABLE_NORMAL;
+
+	_format_context->pb = _avio_context;
+	_format_context->flags |= AVFMT_FLAG_CUSTOM_IO;
+
+	return true;
+}
+
+void FileWriter::CloseFile()
+{
+	if (_avio_context != nullptr)
+	{
+		avio_flush(_avio_context);
+
+		av_freep(&_avio_context->buffer);
+		avio_context_free(&_avio_context);
+	}
+
+	if (_fd >= 0)
+	{
+		if ((_fsync_policy != FsyncPolicy::None) && (::fsync(_fd) != 0))
+		{
+			logtw("Could not synchronize the file. error(%d), path(%s)", errno, _path.CStr());
+		}
+
+		::close(_fd);
+		_fd = -1;
+	}
+}
+
+int FileWriter::OnWrite(void *opaque, uint8_t *buf, int buf_size)
+{
+	auto writer = static_cast<FileWriter *>(opaque);
+	int remained = buf_size;
+
+	while (remained > 0)
+	{
+		auto written = ::write(writer->_fd, buf, remained);
+
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			logte("Could not write to the file. error(%d), path(%s)", errno, writer->_path.CStr());
+			return AVERROR(errno);
+		}
+
+		buf += written;
+		remained -= written;
+	}
+
+	return buf_size;
+}
+
+int64_t FileWriter::OnSeek(void *opaque, int64_t offset, int whence)
+{
+	auto writer = static_cast<FileWriter *>(opaque);
+
+	if (whence & AVSEEK_SIZE)
+	{
+		struct stat file_stat;
+
+		return (::fstat(writer->_fd, &file_stat) == 0) ? file_stat.st_size : AVERROR(errno);
+	}
+
+	auto position = ::lseek(writer->_fd, offset, whence & ~AVSEEK_FORCE);
+
+	return (position >= 0) ? position : AVERROR(errno);
+}
+
 bool FileWriter::Start()
 {
 	std::lock_guard<std::shared_mutex> mlock(_lock);
@@ -134,7 +275,14 @@ bool FileWriter::Start()
 
 	_start_time = -1LL;
 
-	if (!(_format_context->oformat->flags & AVFMT_NOFILE))
+	if (!(_format_context->oformat->flags & AVFMT_NOFILE) && (_write_buffer_size > 0))
+	{
+		if (OpenFile() == false)
+		{
+			return false;
+		}
+	}
+	else if (!(_format_context->oformat->flags & AVFMT_NOFILE))
 	{
 		int error = avio_open2(&_format_context->pb, _format_context->url, AVIO_FLAG_READ_WRITE, nullptr, &options);
 		if (error < 0)
@@ -178,12 +326,15 @@ bool FileWriter::Stop()
 			av_write_trailer(_format_context);
 		}
 
+		// The custom I/O context is not closed by libavformat
 		avformat_close_input(&_format_context);
 
 		avformat_free_context(_format_context);
 
 		_format_context = nullptr;
 
+		CloseFile();
+
 		if (chmod(path.CStr(), S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) != 0)
 		{
 			logtw("Could not change permission. path(%s)", path.CStr());
@@ -193,6 +344,31 @@ bool FileWriter::Stop()
 	return true;
 }
 
+bool FileWriter::Flush()
+{
+	std::lock_guard<std::shared_mutex> mlock(_lock);
+
+	if ((_format_context == nullptr) || (_format_context->pb == nullptr))
+	{
+		return false;
+	}
+
+	avio_flush(_format_context->pb);
+
+	if (_format_context->pb->error < 0)
+	{
+		logte("Could not flush the file. error(%d), path(%s)", _format_context->pb->error, _path.CStr());
+		return false;
+	}
+
+	if ((_fsync_policy == FsyncPolicy::Flush) && (_fd >= 0) && (::fdatasync(_fd) != 0))
+	{
+		logtw("Could not synchronize the file. error(%d), path(%s)", errno, _path.CStr());
+	}
+
+	return true;
+}
+
 bool FileWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::shared_ptr<FileTrackInfo> track)
 {
 	std::lock_guard<std::shared_mutex> mlock(_lock);
@@ -279,8 +455,15 @@ bool FileWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::shar
 //	- H264 : AnnexB bitstream
 // 	- AAC : ASC(Audio Specific Config) bitstream
 
-bool FileWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data)
+bool FileWriter::PutData(const std::shared_ptr<const MediaPacket> &packet)
 {
+	auto track_id = packet->GetTrackId();
+	auto pts = packet->GetPts();
+	auto dts = packet->GetDts();
+	auto flag = packet->GetFlag();
+	auto format = packet->GetBitstreamFormat();
+	auto data = packet->GetData();
+
 	std::lock_guard<std::shared_mutex> mlock(_lock);
 
 	if (_format_context == nullptr)
@@ -355,7 +538,7 @@ bool FileWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 		switch (format)
 		{
 			case cmn::BitstreamFormat::H264_ANNEXB:
-				cdata = H264Converter::ConvertAnnexbToAvcc(data);
+				cdata = H264Converter::GetAvccData(packet);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
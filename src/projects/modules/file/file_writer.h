@@ -122,6 +122,16 @@ public:
 		TIMESTAMP_PASSTHROUGH_MODE = 1
 	};
 
+	enum class FsyncPolicy
+	{
+		// The kernel decides when the data is written to the disk
+		None,
+		// fsync() when the file is closed
+		Close,
+		// fsync() whenever the buffer is flushed
+		Flush
+	};
+
 public:
 	static std::shared_ptr<FileWriter> Create();
 
@@ -134,13 +144,23 @@ public:
 	bool SetPath(const ov::String path, const ov::String format = nullptr);
 	ov::String GetPath();
 
+	// The muxer writes to a buffer of this size, and the buffer is written to the file when it is full or flushed.
+	// (0: use the default I/O of libavformat)
+	// Must be called before Start()
+	void SetWriteBufferSize(size_t size);
+	void SetFsyncPolicy(FsyncPolicy policy);
+	static FsyncPolicy FsyncPolicyFromString(const ov::String &policy);
+
 	bool Start();
 
 	bool Stop();
 
+	// Writes the buffered data to the file
+	bool Flush();
+
 	bool AddTrack(cmn::MediaType media_type, int32_t track_id, std::shared_ptr<FileTrackInfo> trackinfo);
 
-	bool PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data);
+	bool PutData(const std::shared_ptr<const MediaPacket> &packet);
 
 	bool IsWritable();
 
@@ -148,6 +168,13 @@ public:
 
 	static bool IsSupportCodec(ov::String format, cmn::MediaCodecId codec_id);
 
+private:
+	bool OpenFile();
+	void CloseFile();
+
+	static int OnWrite(void *opaque, uint8_t *buf, int buf_size);
+	static int64_t OnSeek(void *opaque, int64_t offset, int whence);
+
 private:
 	ov::String _path;
 	ov::String _format;
@@ -155,6 +182,13 @@ private:
 	int64_t _start_time;
 	bool _timestamp_recalc_mode;
 
+	size_t _write_buffer_size = 0;
+	FsyncPolicy _fsync_policy = FsyncPolicy::None;
+
+	// Used when _write_buffer_size > 0
+	int _fd = -1;
+	AVIOContext *_avio_context = nullptr;
+
 	// <MediaTrack.id, std::hsared_ptr<FileTrackInfo>>
 	std::map<int32_t, std::shared_ptr<FileTrackInfo>> _tracks;
 
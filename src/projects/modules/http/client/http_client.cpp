@@ -9,6 +9,7 @@
 #include "http_client.h"
 
 #include "../http_private.h"
+#include "http_connection_pool.h"
 
 #define HTTP_CLIENT_READ_BUFFER_SIZE (64 * 1024)
 #define HTTP_CLIENT_MAX_CHUNK_HEADER_LENGTH (32)
@@ -66,6 +67,16 @@ namespace http
 			return _recv_timeout_msec;
 		}
 
+		void HttpClient::SetKeepAlive(bool keep_alive)
+		{
+			_keep_alive = keep_alive;
+		}
+
+		bool HttpClient::IsKeepAlive() const
+		{
+			return _keep_alive;
+		}
+
 		void HttpClient::SetMethod(http::Method method)
 		{
 			_method = method;
@@ -140,6 +151,12 @@ namespace http
 
 		void HttpClient::OnReadable()
 		{
+			if (_parsed_url == nullptr)
+			{
+				// There is no request in progress
+				return;
+			}
+
 			auto error = TryTlsConnect();
 
 			if (error != nullptr)
@@ -201,9 +218,9 @@ namespace http
 
 		std::shared_ptr<const ov::Error> HttpClient::PrepareForRequest(const ov::String &url, ov::SocketAddress *address)
 		{
-			if (_requested)
+			if (_parsed_url != nullptr)
 			{
-				return ov::Error::CreateError("HTTP", "It has already been requested before: %s", _url.CStr());
+				return ov::Error::CreateError("HTTP", "Another request is in progress: %s", _url.CStr());
 			}
 
 			if (url.IsEmpty())
@@ -246,13 +263,77 @@ namespace http
 				parsed_url->SetPort(port);
 			}
 
-			auto socket_address = ov::SocketAddress(parsed_url->Host(), port);
+			// Reset the states of the previous request
+			_requested = false;
+			_parser = prot::h1::HttpResponseParser();
+			_response_body = nullptr;
+			_is_chunked_transfer = false;
+			_chunk_parse_status = ChunkParseStatus::None;
+			_chunk_length = 0L;
+			_chunk_header.Clear();
+			_received_bytes = 0;
+			_is_connection_reused = false;
+			_is_https = is_https;
+
+			_connection_key = HttpConnectionPool::MakeKey(parsed_url->Scheme(), parsed_url->Host(), port, _blocking_mode);
+
+			auto connection = _keep_alive ? HttpConnectionPool::GetInstance()->Acquire(_connection_key) : nullptr;
+
+			if (connection != nullptr)
+			{
+				// The TCP/TLS connection is already established
+				_socket = connection->GetSocket();
+				_tls_data = connection->GetTlsData();
+
+				if ((_socket->GetBlockingMode() == ov::BlockingMode::NonBlocking) && (_socket->SetAsyncInterface(GetSharedPtr()) == false))
+				{
+					connection->Close();
+					return ov::Error::CreateError("HTTP", "Could not take over the connection");
+				}
+
+				if (_tls_data != nullptr)
+				{
+					_tls_data->SetIoCallback(GetSharedPtrAs<ov::TlsClientDataIoCallback>());
+				}
+
+				_is_connection_reused = true;
+				_address = *(_socket->GetRemoteAddress());
+			}
+			else
+			{
+				auto socket_address = ov::SocketAddress(parsed_url->Host(), port);
+
+				if (socket_address.IsValid() == false)
+				{
+					return ov::Error::CreateError("HTTP", "Invalid address: %s:%d, URL: %s", parsed_url->Host().CStr(), port, url.CStr());
+				}
+
+				_address = socket_address;
+
+				auto error = CreateConnection();
+
+				if (error != nullptr)
+				{
+					return error;
+				}
+			}
 
-			if (socket_address.IsValid() == false)
+			if (address != nullptr)
 			{
-				return ov::Error::CreateError("HTTP", "Invalid address: %s:%d, URL: %s", parsed_url->Host().CStr(), port, url.CStr());
+				*address = _address;
 			}
 
+			_url = url;
+			_parsed_url = parsed_url;
+
+			_request_header["Host"] = ov::String::FormatString(
+				"%s:%d", _parsed_url->Host().CStr(), _parsed_url->Port());
+
+			return nullptr;
+		}
+
+		std::shared_ptr<const ov::Error> HttpClient::CreateConnection()
+		{
 			_socket = _socket_pool->AllocSocket();
 
 			if (_socket == nullptr)
@@ -265,7 +346,7 @@ namespace http
 				return ov::Error::CreateError("HTTP", "Could not set blocking mode");
 			}
 
-			if (is_https)
+			if (_is_https)
 			{
 				std::shared_ptr<const ov::Error> error;
 				_tls_data = std::make_shared<ov::TlsClientData>(ov::TlsContext::CreateClientContext(&error), (_blocking_mode == ov::BlockingMode::NonBlocking));
@@ -278,18 +359,92 @@ namespace http
 				_tls_data->SetIoCallback(GetSharedPtrAs<ov::TlsClientDataIoCallback>());
 			}
 
-			if (address != nullptr)
+			return nullptr;
+		}
+
+		std::shared_ptr<const ov::Error> HttpClient::Connect()
+		{
+			// Convert milliseconds to timeval
+			_socket->SetRecvTimeout(
+				{.tv_sec = _recv_timeout_msec / 1000,
+				 .tv_usec = _recv_timeout_msec % 1000});
+
+			if (_is_connection_reused)
 			{
-				*address = socket_address;
+				if (_socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
+				{
+					// Response will be received in OnReadable()
+					SendRequestIfNeeded();
+					return nullptr;
+				}
+
+				OnConnected(nullptr);
+				return nullptr;
 			}
 
-			_url = url;
-			_parsed_url = parsed_url;
+			auto error = _socket->Connect(_address, _connection_timeout_msec);
 
-			_request_header["Host"] = ov::String::FormatString(
-				"%s:%d", _parsed_url->Host().CStr(), _parsed_url->Port());
+			if (error == nullptr)
+			{
+				if (_socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
+				{
+					// Data will be downloaded in OnReadable()
+					return nullptr;
+				}
 
-			return nullptr;
+				OnConnected(nullptr);
+				return nullptr;
+			}
+
+			return ov::Error::CreateError("HTTP", error->GetCode(), "Could not connect to %s: %s", _url.CStr(), error->GetMessage().CStr());
+		}
+
+		bool HttpClient::RetryWithNewConnection()
+		{
+			logtd("The pooled connection for %s has been closed by the server, retrying with a new connection...", _url.CStr());
+
+			OV_SAFE_RESET(
+				_tls_data, nullptr, {
+					_tls_data->SetIoCallback(nullptr);
+					_tls_data = nullptr;
+				},
+				_tls_data);
+			OV_SAFE_RESET(_socket, nullptr, _socket->Close(), _socket);
+
+			_requested = false;
+			_parser = prot::h1::HttpResponseParser();
+			_response_body = nullptr;
+			_is_connection_reused = false;
+
+			auto error = CreateConnection();
+
+			if (error == nullptr)
+			{
+				error = Connect();
+			}
+
+			if (error != nullptr)
+			{
+				HandleError(error);
+			}
+
+			return true;
+		}
+
+		bool HttpClient::IsReusableResponse() const
+		{
+			if ((_parser.GetHttpVersionAsNumber() < 1.1) || (_parser.GetHeader("Connection").LowerCaseString() == "close"))
+			{
+				return false;
+			}
+
+			if (_is_chunked_transfer)
+			{
+				return (_chunk_parse_status == ChunkParseStatus::Completed);
+			}
+
+			// If the length is unknown, the end of the response is the end of the connection
+			return _parser.HasContentLength() && (_response_body != nullptr) && (_response_body->GetLength() == _parser.GetContentLength());
 		}
 
 		void HttpClient::SendRequestIfNeeded()
@@ -326,6 +481,16 @@ namespace http
 			{
 				_request_header["Content-Length"] = ov::Converter::ToString(_request_body->GetLength());
 			}
+			else
+			{
+				// The header may have been set by the previous request
+				_request_header.erase("Content-Length");
+			}
+
+			if (_keep_alive)
+			{
+				_request_header["Connection"] = "keep-alive";
+			}
 
 			logtd("Request headers: %zu:", _request_header.size());
 
@@ -369,33 +534,24 @@ namespace http
 				OV_ASSERT2(_url.IsEmpty() == false);
 				OV_ASSERT2(_parsed_url != nullptr);
 
-				logtd("Request an URL: %s (address: %s)...", url.CStr(), address.ToString(false).CStr());
-
-				// Convert milliseconds to timeval
-				_socket->SetRecvTimeout(
-					{.tv_sec = _recv_timeout_msec / 1000,
-					 .tv_usec = _recv_timeout_msec % 1000});
+				logtd("Request an URL: %s (address: %s, reused: %s)...", url.CStr(), address.ToString(false).CStr(), ov::Converter::ToString(_is_connection_reused).CStr());
 
-				error = _socket->Connect(address, _connection_timeout_msec);
+				error = Connect();
 
 				if (error == nullptr)
 				{
-					if (_socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
-					{
-						// Data will be downloaded in OnReadable()
-						return;
-					}
-
-					OnConnected(nullptr);
 					return;
 				}
-
-				error = ov::Error::CreateError("HTTP", error->GetCode(), "Could not connect to %s: %s", url.CStr(), error->GetMessage().CStr());
 			}
 
 			HandleError(error);
 		}
 
+		bool HttpClient::IsConnectionReused() const
+		{
+			return _is_connection_reused;
+		}
+
 		ov::String HttpClient::GetResponseHeader(const ov::String &key)
 		{
 			return _parser.GetHeader(key);
@@ -408,6 +564,8 @@ namespace http
 
 		void HttpClient::RecvResponse()
 		{
+			// This client must be alive until the response is handled, even if the connection is pooled in the meantime
+			auto self = GetSharedPtr();
 			auto socket = _socket;
 			auto tls_data = _tls_data;
 			std::shared_ptr<ov::Data> data;
@@ -456,6 +614,7 @@ namespace http
 
 				if (error == nullptr)
 				{
+					_received_bytes += process_data->GetLength();
 					error = ProcessData(process_data);
 				}
 
@@ -491,6 +650,14 @@ namespace http
 				}
 			}
 
+			if (_is_connection_reused && (_received_bytes == 0) && (need_to_callback || (error != nullptr)))
+			{
+				// The server closed the idle connection before it received the request
+				RetryWithNewConnection();
+				return;
+			}
+
+			auto reuse_connection = _keep_alive && (error == nullptr) && (need_to_callback == false) && IsReusableResponse();
 			auto response_handler = _response_handler;
 
 			if (response_handler != nullptr)
@@ -498,7 +665,7 @@ namespace http
 				response_handler(_parser.GetStatusCode(), _response_body, error);
 			}
 
-			CleanupVariables();
+			CleanupVariables(reuse_connection);
 		}
 
 		std::shared_ptr<const ov::Error> HttpClient::ProcessChunk(const std::shared_ptr<const ov::Data> &data, size_t *processed_bytes)
@@ -743,12 +910,30 @@ namespace http
 			}
 		}
 
-		void HttpClient::CleanupVariables()
+		void HttpClient::CleanupVariables(bool reuse_connection)
 		{
+			// The socket callback may be the last owner of this client (non-blocking mode),
+			// and it is replaced when the connection is pooled
+			auto self = GetSharedPtr();
+
 			// Clean up variables
 			_url.Clear();
 			_parsed_url = nullptr;
 			_response_handler = nullptr;
+			_requested = false;
+
+			if (reuse_connection && (_socket != nullptr))
+			{
+				auto key = _connection_key;
+				auto socket = std::move(_socket);
+				auto tls_data = std::move(_tls_data);
+
+				_socket = nullptr;
+				_tls_data = nullptr;
+
+				HttpConnectionPool::GetInstance()->Release(key, socket, tls_data);
+				return;
+			}
 
 			OV_SAFE_RESET(
 				_tls_data, nullptr, {
@@ -761,6 +946,8 @@ namespace http
 
 		void HttpClient::HandleError(std::shared_ptr<const ov::Error> error)
 		{
+			// Closing the socket releases the socket callback, which may be the last owner of this client
+			auto self = GetSharedPtr();
 			auto response_handler = _response_handler;
 
 			// An error occurred - reset all variables
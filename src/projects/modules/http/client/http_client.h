@@ -47,6 +47,11 @@ namespace http
 
 			void SetTimeout(int timeout_msec);
 
+			// If enabled, the connection is kept in HttpConnectionPool after the response is received,
+			// and the next request to the same host reuses it (HTTP/1.1 keep-alive)
+			void SetKeepAlive(bool keep_alive);
+			bool IsKeepAlive() const;
+
 			void SetMethod(http::Method method);
 			http::Method GetMethod() const;
 
@@ -63,8 +68,12 @@ namespace http
 				SetRequestBody(body.ToData(false));
 			}
 
+			// Request() can be called again after the response of the previous request is received
 			void Request(const ov::String &url, ResponseHandler response_handler);
 
+			// Returns true if the last request was sent over a connection of HttpConnectionPool
+			bool IsConnectionReused() const;
+
 			// Response headers (Headers received from HTTP server)
 			ov::String GetResponseHeader(const ov::String &key);
 			const std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaders() const;
@@ -107,6 +116,11 @@ namespace http
 
 		protected:
 			std::shared_ptr<const ov::Error> PrepareForRequest(const ov::String &url, ov::SocketAddress *address);
+			std::shared_ptr<const ov::Error> CreateConnection();
+			std::shared_ptr<const ov::Error> Connect();
+			// Called when the server has closed the pooled connection before responding
+			bool RetryWithNewConnection();
+			bool IsReusableResponse() const;
 			std::shared_ptr<const ov::OpensslError> TryTlsConnect();
 			void SendRequestIfNeeded();
 			// Use this API when blocking mode
@@ -117,7 +131,8 @@ namespace http
 			bool SendData(const std::shared_ptr<const ov::Data> &data);
 
 			void PostProcess();
-			void CleanupVariables();
+			// If reuse_connection is true, the connection is returned to HttpConnectionPool instead of being closed
+			void CleanupVariables(bool reuse_connection = false);
 
 			void HandleError(std::shared_ptr<const ov::Error> error);
 
@@ -145,8 +160,17 @@ namespace http
 			std::mutex _request_mutex;
 			std::atomic<bool> _requested = false;
 
+			bool _keep_alive = false;
+			// Key of HttpConnectionPool
+			ov::String _connection_key;
+			bool _is_connection_reused = false;
+			// Number of bytes received for the current request
+			size_t _received_bytes = 0;
+
 			ov::String _url;
 			std::shared_ptr<ov::Url> _parsed_url;
+			bool _is_https = false;
+			ov::SocketAddress _address;
 			ResponseHandler _response_handler = nullptr;
 
 			std::shared_ptr<ov::Socket> _socket;
@@ -0,0 +1,171 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http_connection_pool.h"
+
+#include <sys/socket.h>
+
+#include "../http_private.h"
+
+namespace http
+{
+	namespace clnt
+	{
+		HttpConnectionPool::Connection::Connection(const std::shared_ptr<ov::Socket> &socket, const std::shared_ptr<ov::TlsClientData> &tls_data)
+			: _socket(socket),
+			  _tls_data(tls_data)
+		{
+			_idle_since.Start();
+		}
+
+		bool HttpConnectionPool::Connection::IsAlive() const
+		{
+			if (_is_broken || (_socket->GetState() != ov::SocketState::Connected))
+			{
+				return false;
+			}
+
+			// The server must not send anything while the connection is idle,
+			// so a readable socket means that the server has closed the connection (or sent garbage)
+			uint8_t buffer;
+			auto result = ::recv(_socket->GetNativeHandle(), &buffer, 1, MSG_PEEK | MSG_DONTWAIT);
+
+			return (result < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK));
+		}
+
+		void HttpConnectionPool::Connection::Close()
+		{
+			_is_broken = true;
+			_socket->Close();
+		}
+
+		void HttpConnectionPool::Connection::OnConnected(const std::shared_ptr<const ov::SocketError> &error)
+		{
+			// The connection is already established
+		}
+
+		void HttpConnectionPool::Connection::OnReadable()
+		{
+			// The connection will be closed when it is acquired or evicted
+			_is_broken = true;
+		}
+
+		void HttpConnectionPool::Connection::OnClosed()
+		{
+			_is_broken = true;
+		}
+
+		ov::String HttpConnectionPool::MakeKey(const ov::String &scheme, const ov::String &host, int port, ov::BlockingMode blocking_mode)
+		{
+			// The blocking mode of a socket cannot be changed after it is connected, so it is a part of the key
+			return ov::String::FormatString(
+				"%s://%s:%d (%s)",
+				scheme.LowerCaseString().CStr(), host.CStr(), port,
+				ov::StringFromBlockingMode(blocking_mode));
+		}
+
+		std::shared_ptr<HttpConnectionPool::Connection> HttpConnectionPool::Acquire(const ov::String &key)
+		{
+			std::lock_guard lock_guard(_connection_map_mutex);
+
+			EvictIdleConnections();
+
+			auto item = _connection_map.find(key);
+
+			if (item != _connection_map.end())
+			{
+				auto &connections = item->second;
+
+				while (connections.empty() == false)
+				{
+					auto connection = connections.back();
+					connections.pop_back();
+
+					if (connection->IsAlive())
+					{
+						_hit_count++;
+
+						logtd("Reuse a connection for %s (hit: %" PRIu64 ", miss: %" PRIu64 ")", key.CStr(), _hit_count.load(), _miss_count.load());
+
+						return connection;
+					}
+
+					connection->Close();
+				}
+
+				_connection_map.erase(item);
+			}
+
+			_miss_count++;
+
+			return nullptr;
+		}
+
+		void HttpConnectionPool::Release(const ov::String &key, const std::shared_ptr<ov::Socket> &socket, const std::shared_ptr<ov::TlsClientData> &tls_data)
+		{
+			auto connection = std::make_shared<Connection>(socket, tls_data);
+
+			if (tls_data != nullptr)
+			{
+				tls_data->SetIoCallback(nullptr);
+			}
+
+			if (socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
+			{
+				// Watch the connection while it is idle
+				socket->SetAsyncInterface(connection);
+			}
+
+			std::lock_guard lock_guard(_connection_map_mutex);
+
+			auto &connections = _connection_map[key];
+
+			connections.push_back(connection);
+
+			while (connections.size() > HTTP_CONNECTION_POOL_MAX_IDLE_CONNECTIONS_PER_HOST)
+			{
+				connections.front()->Close();
+				connections.pop_front();
+			}
+
+			EvictIdleConnections();
+		}
+
+		double HttpConnectionPool::GetHitRate() const
+		{
+			uint64_t hit_count = _hit_count;
+			uint64_t total_count = hit_count + _miss_count;
+
+			return (total_count > 0) ? (hit_count * 100.0 / total_count) : 0.0;
+		}
+
+		void HttpConnectionPool::EvictIdleConnections()
+		{
+			for (auto item = _connection_map.begin(); item != _connection_map.end();)
+			{
+				auto &connections = item->second;
+
+				// The oldest connection is at the front
+				while ((connections.empty() == false) && (connections.front()->GetIdleTime() >= HTTP_CONNECTION_POOL_IDLE_TIMEOUT_MSEC))
+				{
+					connections.front()->Close();
+					connections.pop_front();
+				}
+
+				if (connections.empty())
+				{
+					item = _connection_map.erase(item);
+				}
+				else
+				{
+					++item;
+				}
+			}
+		}
+	}  // namespace clnt
+}  // namespace http
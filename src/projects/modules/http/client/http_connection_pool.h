@@ -0,0 +1,108 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/ovcrypto.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/ovsocket.h>
+
+#include <deque>
+#include <unordered_map>
+
+// Maximum number of idle connections kept for each host
+#define HTTP_CONNECTION_POOL_MAX_IDLE_CONNECTIONS_PER_HOST (16)
+// Idle connections are closed after this time
+// (Shorter than the keep-alive timeout of the most HTTP servers, so the server rarely closes the connection first)
+#define HTTP_CONNECTION_POOL_IDLE_TIMEOUT_MSEC (4 * 1000)
+
+namespace http
+{
+	namespace clnt
+	{
+		// Keeps the connections of HttpClient alive after the response is received,
+		// so the next request to the same host can skip the TCP/TLS handshake
+		class HttpConnectionPool : public ov::Singleton<HttpConnectionPool>
+		{
+		public:
+			class Connection : public ov::SocketAsyncInterface
+			{
+			public:
+				Connection(const std::shared_ptr<ov::Socket> &socket, const std::shared_ptr<ov::TlsClientData> &tls_data);
+
+				std::shared_ptr<ov::Socket> GetSocket() const
+				{
+					return _socket;
+				}
+
+				std::shared_ptr<ov::TlsClientData> GetTlsData() const
+				{
+					return _tls_data;
+				}
+
+				int64_t GetIdleTime() const
+				{
+					return _idle_since.Elapsed();
+				}
+
+				// Returns false if the server has closed the connection (or sent unexpected data) while it was idle
+				bool IsAlive() const;
+
+				void Close();
+
+			protected:
+				//--------------------------------------------------------------------
+				// Implementation of SocketAsyncInterface (Called while the non-blocking connection is idle)
+				//--------------------------------------------------------------------
+				void OnConnected(const std::shared_ptr<const ov::SocketError> &error) override;
+				void OnReadable() override;
+				void OnClosed() override;
+
+			protected:
+				std::shared_ptr<ov::Socket> _socket;
+				std::shared_ptr<ov::TlsClientData> _tls_data;
+
+				ov::StopWatch _idle_since;
+				std::atomic<bool> _is_broken{false};
+			};
+
+			// The key identifies the connections that can be shared (scheme, host, port and blocking mode)
+			static ov::String MakeKey(const ov::String &scheme, const ov::String &host, int port, ov::BlockingMode blocking_mode);
+
+			// Returns an idle connection for the key, or nullptr if there is no reusable connection
+			std::shared_ptr<Connection> Acquire(const ov::String &key);
+			// Keeps the connection for the next request
+			void Release(const ov::String &key, const std::shared_ptr<ov::Socket> &socket, const std::shared_ptr<ov::TlsClientData> &tls_data);
+
+			uint64_t GetHitCount() const
+			{
+				return _hit_count;
+			}
+
+			uint64_t GetMissCount() const
+			{
+				return _miss_count;
+			}
+
+			// Percentage of the requests that reused a connection
+			double GetHitRate() const;
+
+		protected:
+			// Close the connections that are expired or broken
+			// (_connection_map_mutex must be locked)
+			void EvictIdleConnections();
+
+			std::mutex _connection_map_mutex;
+			// key : idle connections (the most recently used connection is at the back)
+			std::unordered_map<ov::String, std::deque<std::shared_ptr<Connection>>> _connection_map;
+
+			std::atomic<uint64_t> _hit_count{0};
+			std::atomic<uint64_t> _miss_count{0};
+		};
+	}  // namespace clnt
+}  // namespace http
@@ -7,6 +7,9 @@
 //
 //==============================================================================
 #include "encoder.h"
+
+#include <unordered_set>
+
 #include "huffman_codec.h"
 #include "hpack_private.h"
 
@@ -16,6 +19,8 @@ namespace http
 	{
 		bool Encoder::UpdateDynamicTableSize(size_t size)
 		{
+			std::lock_guard<std::mutex> lock(_encoding_lock);
+
 			if (_table_connector.UpdateDynamicTableSize(size) == false)
 			{
 				return false;
@@ -27,9 +32,111 @@ namespace http
 
 		std::shared_ptr<ov::Data> Encoder::Encode(const HeaderField &header_fields, EncodingType type)
 		{
+			std::lock_guard<std::mutex> lock(_encoding_lock);
+
 			std::shared_ptr<ov::Data> encoded_data = std::make_shared<ov::Data>(header_fields.GetSize());
 			ov::ByteStream stream(encoded_data.get());
 
+			if (EncodeHeaderField(stream, header_fields, type) == false)
+			{
+				return nullptr;
+			}
+
+			return encoded_data;
+		}
+
+		std::shared_ptr<ov::Data> Encoder::EncodeHeaderBlock(const std::vector<HeaderField> &header_fields)
+		{
+			std::lock_guard<std::mutex> lock(_encoding_lock);
+
+			auto header_block = std::make_shared<ov::Data>(1024);
+			ov::ByteStream stream(header_block.get());
+
+			// Key of the header fields to be indexed
+			ov::String cache_key;
+			std::vector<const HeaderField *> indexed_fields;
+			std::vector<const HeaderField *> volatile_fields;
+
+			for (const auto &header_field : header_fields)
+			{
+				if (IsVolatileField(header_field.GetName()))
+				{
+					volatile_fields.push_back(&header_field);
+					continue;
+				}
+
+				indexed_fields.push_back(&header_field);
+				cache_key.AppendFormat("%s: %s\r\n", header_field.GetName().CStr(), header_field.GetValue().CStr());
+			}
+
+			auto table_modified_count = _table_connector.GetDynamicTableModifiedCount();
+			auto cached_block = _header_block_cache.find(cache_key);
+
+			if ((_need_signal_table_size_update == false) &&
+				(cached_block != _header_block_cache.end()) &&
+				(cached_block->second.table_modified_count == table_modified_count))
+			{
+				stream.Write(cached_block->second.data);
+			}
+			else
+			{
+				auto signal_table_size_update = _need_signal_table_size_update;
+				auto indexed_block = std::make_shared<ov::Data>(1024);
+				ov::ByteStream indexed_stream(indexed_block.get());
+
+				for (const auto &header_field : indexed_fields)
+				{
+					if (EncodeHeaderField(indexed_stream, *header_field, EncodingType::LiteralWithIndexing) == false)
+					{
+						return nullptr;
+					}
+				}
+
+				// If the dynamic table is not changed, all fields are encoded as indexes and the same bytes will be encoded next time
+				if ((signal_table_size_update == false) && (table_modified_count == _table_connector.GetDynamicTableModifiedCount()))
+				{
+					if (_header_block_cache.size() >= MAX_HPACK_HEADER_BLOCK_CACHE_COUNT)
+					{
+						_header_block_cache.clear();
+					}
+
+					_header_block_cache[cache_key] = {table_modified_count, indexed_block};
+				}
+
+				stream.Write(indexed_block);
+			}
+
+			for (const auto &header_field : volatile_fields)
+			{
+				if (EncodeHeaderField(stream, *header_field, EncodingType::LiteralWithoutIndexing) == false)
+				{
+					return nullptr;
+				}
+			}
+
+			return header_block;
+		}
+
+		bool Encoder::IsVolatileField(const ov::String &name)
+		{
+			// The values of these fields are different for every message
+			static const std::unordered_set<ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> volatile_fields = {
+				":path",
+				"age",
+				"content-length",
+				"content-range",
+				"date",
+				"etag",
+				"expires",
+				"last-modified",
+				"location",
+				"set-cookie"};
+
+			return volatile_fields.find(name) != volatile_fields.end();
+		}
+
+		bool Encoder::EncodeHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type)
+		{
 			bool result = false;
 
 			if (_need_signal_table_size_update)
@@ -37,7 +144,7 @@ namespace http
 				if (EncodeDynamicTableSizeUpdate(stream, _table_connector.GetDynamicTableSize()) == false)
 				{
 					logte("Failed to encode DynamicTableSizeUpdate (%u) field", _table_connector.GetDynamicTableSize());
-					return nullptr;
+					return false;
 				}
 
 				_need_signal_table_size_update = false;
@@ -64,17 +171,17 @@ namespace http
 						result = EncodeLiteralHeaderFieldNeverIndexed(stream, header_fields, index);
 						break;
 					default:
-						return nullptr;
+						return false;
 				}
 			}
 
 			if (result == false)
 			{
 				logte("Failed to encode header field");
-				return nullptr;
+				return false;
 			}
 
-			return encoded_data;
+			return true;
 		}
 
 		bool Encoder::EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index)
@@ -12,6 +12,8 @@
 #include "data_structure.h"
 #include "table_connector.h"
 
+#define MAX_HPACK_HEADER_BLOCK_CACHE_COUNT 64
+
 namespace http
 {
 	// https://www.rfc-editor.org/rfc/rfc7541.html
@@ -31,7 +33,17 @@ namespace http
 
 			std::shared_ptr<ov::Data> Encode(const HeaderField &header_fields, EncodingType type);
 
+			// Encodes all header fields of a message into one header block.
+			// The fields that change on every message (see IsVolatileField()) are not indexed so that they don't evict the others from the dynamic table.
+			// The others are indexed, and once all of them are encoded as indexes, the encoded bytes are cached
+			// and reused for the same fields until the dynamic table is changed.
+			std::shared_ptr<ov::Data> EncodeHeaderBlock(const std::vector<HeaderField> &header_fields);
+
+			static bool IsVolatileField(const ov::String &name);
+
 		private:
+			bool EncodeHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type);
+
 			bool EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index);
 			bool EncodeLiteralHeaderFieldWithIndexing(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t name_index);
 			bool EncodeLiteralHeaderFieldWithoutIndexing(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t name_index);
@@ -48,6 +60,19 @@ namespace http
 
 			TableConnector	_table_connector;
 			bool _need_signal_table_size_update = false;
+
+			struct CachedHeaderBlock
+			{
+				// The encoded indexes are valid only while the dynamic table is the same
+				uint64_t table_modified_count = 0;
+				std::shared_ptr<const ov::Data> data;
+			};
+
+			// Header fields (except for the volatile fields) : Encoded header block
+			std::unordered_map<ov::String, CachedHeaderBlock> _header_block_cache;
+
+			// The header fields must be encoded in the order of the dynamic table updates
+			std::mutex _encoding_lock;
 		};
 	} // namespace hpack
 } // namespace http
\ No newline at end of file
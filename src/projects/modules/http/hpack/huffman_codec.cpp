@@ -7,7 +7,6 @@
 //
 //==============================================================================
 
-#include <base/ovlibrary/bit_reader.h>
 #include "huffman_codec.h"
 
 namespace http
@@ -274,11 +273,16 @@ namespace http
 			Build(0x7fffff0, 27, 254);
 			Build(0x3ffffee, 26, 255);
 			Build(0x3fffffff, 30, 256); //EOS
+
+			BuildDecodingTable();
 		}
 
 		std::shared_ptr<ov::Data> HuffmanCodec::Encode(const ov::String &str)
 		{
-			uint8_t out_data[str.GetLength() * 2];
+			// The longest code is 30 bits
+			auto encoded_data = std::make_shared<ov::Data>(((str.GetLength() * 30) + 7) / 8);
+			encoded_data->SetLength(encoded_data->GetCapacity());
+			auto out_data = encoded_data->GetWritableDataAs<uint8_t>();
 			size_t out_data_size = 0;
 
 			uint64_t bit_buffer = 0;
@@ -323,59 +327,103 @@ namespace http
 				out_data_size ++;
 			}
 			
-			return std::make_shared<ov::Data>(&out_data[0], out_data_size);
+			encoded_data->SetLength(out_data_size);
+
+			return encoded_data;
 		}
 
 		bool HuffmanCodec::Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str)
 		{
-			auto reader = std::make_shared<BitReader>(data->GetDataAs<uint8_t>(), data->GetLength());
-			auto node = _tree;
+			auto encoded = data->GetDataAs<uint8_t>();
+			auto length = data->GetLength();
+			uint8_t state = 0;
 
-			while (reader->BytesReamined() > 0)
+			// Every code is at least 5 bits
+			str.SetCapacity(str.GetLength() + ((length * 8) / 5));
+
+			for (size_t i = 0; i < length; i++)
 			{
-				auto b = reader->ReadBit();
-				if (b == 1)
+				for (auto bits : {static_cast<uint8_t>(encoded[i] >> 4), static_cast<uint8_t>(encoded[i] & 0x0F)})
 				{
-					node = node->GetRight();
-					if (node == nullptr)
+					const auto &entry = _decoding_table[state][bits];
+
+					if (entry.flags & DecodingFlag::Failed)
 					{
+						// Invalid code or EOS
 						return false;
 					}
-				}
-				else
-				{
-					node = node->GetLeft();
-					if (node == nullptr)
+
+					if (entry.flags & DecodingFlag::Symbol)
 					{
-						return false;
+						str.Append(static_cast<char>(entry.symbol));
 					}
+
+					state = entry.next_state;
 				}
+			}
+
+			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
+			// As the Huffman-encoded data doesn't always end at an octet boundary,
+			// some padding is inserted after it, up to the next octet boundary.  To
+			// prevent this padding from being misinterpreted as part of the string
+			// literal, the most significant bits of the code corresponding to the
+			// EOS (end-of-string) symbol are used.
+
+			// So, the symbol (1111111) corresponding to EOS may be included in the 
+			// last 7 bits or less. In this case, no processing is done because it will 
+			// terminate without reaching the leaf naturally.
+
+			return true;
+		}
 
-				if (node->IsLeaf())
+		void HuffmanCodec::BuildDecodingTable()
+		{
+			// ID of the internal node is the state
+			std::vector<Node *> nodes = {_tree};
+			std::unordered_map<Node *, uint8_t> node_ids = {{_tree, 0}};
+
+			for (size_t state = 0; state < nodes.size(); state++)
+			{
+				for (uint8_t bits = 0; bits < 16; bits++)
 				{
-					if (node->GetValue() == 256)
+					auto &entry = _decoding_table[state][bits];
+					auto node = nodes[state];
+
+					for (int shift = 3; shift >= 0; shift--)
 					{
-						// EOS
-						return false;
+						node = (((bits >> shift) & 0x01) == 1) ? node->GetRight() : node->GetLeft();
+
+						if ((node == nullptr) || (node->IsLeaf() && node->GetValue() == 256))
+						{
+							entry.flags = DecodingFlag::Failed;
+							break;
+						}
+
+						if (node->IsLeaf())
+						{
+							entry.flags |= DecodingFlag::Symbol;
+							entry.symbol = static_cast<uint8_t>(node->GetValue());
+							node = _tree;
+						}
 					}
 
-					str.Append(static_cast<uint8_t>(node->GetValue()));
-					node = _tree;
+					if (entry.flags & DecodingFlag::Failed)
+					{
+						continue;
+					}
 
-					// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
-					// As the Huffman-encoded data doesn't always end at an octet boundary,
-					// some padding is inserted after it, up to the next octet boundary.  To
-					// prevent this padding from being misinterpreted as part of the string
-					// literal, the most significant bits of the code corresponding to the
-					// EOS (end-of-string) symbol are used.
+					auto node_id = node_ids.find(node);
+					if (node_id == node_ids.end())
+					{
+						OV_ASSERT2(nodes.size() < _decoding_table.size());
 
-					// So, the symbol (1111111) corresponding to EOS may be included in the 
-					// last 7 bits or less. In this case, no processing is done because it will 
-					// terminate without reaching the leaf naturally.
+						node_id = node_ids.emplace(node, static_cast<uint8_t>(nodes.size())).first;
+						nodes.push_back(node);
+					}
+
+					entry.next_state = node_id->second;
 				}
 			}
-
-			return true;
 		}
 
 		void HuffmanCodec::BuildTree(uint32_t code, uint8_t length, uint16_t symbol)
@@ -29,6 +29,8 @@ namespace http
 			void BuildMap(uint32_t code, uint8_t length, uint16_t symbol);
 			// Build Tree for decoding from code to symbol
 			void BuildTree(uint32_t code, uint8_t length, uint16_t symbol);
+			// Build the state transition table from the tree for decoding 4 bits at a time
+			void BuildDecodingTable();
 
 			class Node
 			{
@@ -78,7 +80,27 @@ namespace http
 
 			// 
 			Node* _tree = new Node();
-			std::unordered_map<uint8_t, std::pair<uint32_t, uint8_t>> _map;
+			// Symbol (0 ~ 256) : <Code, Code length>
+			std::array<std::pair<uint32_t, uint8_t>, 257> _map;
+
+			// The shortest code is 5 bits, so at most one symbol is decoded from 4 bits
+			enum DecodingFlag : uint8_t
+			{
+				Symbol = 0x01,
+				Failed = 0x02
+			};
+
+			struct DecodingEntry
+			{
+				// State is the ID of the internal node of the tree (0 : root)
+				uint8_t next_state = 0;
+				uint8_t flags = 0;
+				uint8_t symbol = 0;
+			};
+
+			// The tree has 256 internal nodes for 257 symbols
+			// [State][4 bits]
+			std::array<std::array<DecodingEntry, 16>, 256> _decoding_table;
 		};
 	}
 }
\ No newline at end of file
@@ -65,6 +65,7 @@ namespace http
 				logd("DEBUG", "Indexed header field: %s", header_field.ToString().CStr());
 
 				_append_sequence++;
+				_modified_count++;
 
 				_table_usage += header_field.GetSize();
 
@@ -131,6 +132,12 @@ namespace http
 				return _header_fields_table.size();
 			}
 
+			// It is increased whenever an entry is inserted or removed, so the indexes are not changed while it is the same
+			uint64_t GetModifiedCount()
+			{
+				return _modified_count;
+			}
+
 			size_t PopHeaderField()
 			{
 				if (_header_fields_table.empty())
@@ -140,8 +147,25 @@ namespace http
 
 				auto header_field = _header_fields_table.back();
 				_header_fields_table.pop_back();
+
+				// Remove the evicted entry from the maps, otherwise LookupIndex() returns an index out of the table
+				// (the maps keep only the latest sequence, so the entry may have been replaced by a newer one)
+				auto sequence_number = _removed_count + 1;
+
+				auto it = _header_field_sequence_map.find(header_field.GetKey());
+				if ((it != _header_field_sequence_map.end()) && (it->second == sequence_number))
+				{
+					_header_field_sequence_map.erase(it);
+				}
+
+				it = _header_field_name_sequence_map.find(header_field.GetName());
+				if ((it != _header_field_name_sequence_map.end()) && (it->second == sequence_number))
+				{
+					_header_field_name_sequence_map.erase(it);
+				}
 				
 				_removed_count ++;
+				_modified_count ++;
 				_table_usage -= header_field.GetSize();
 
 				return header_field.GetSize();
@@ -185,6 +209,8 @@ namespace http
 
 			// Removed item count
 			uint32_t _removed_count = 0;
+
+			uint64_t _modified_count = 0;
 		};
 	}  // namespace hpack
 }  // namespace http
\ No newline at end of file
@@ -73,5 +73,11 @@ namespace http
 			std::lock_guard<std::mutex> lock(_dynamic_table_lock);
 			return _dynamic_table->GetTableSize();
 		}
+
+		uint64_t TableConnector::GetDynamicTableModifiedCount()
+		{
+			std::lock_guard<std::mutex> lock(_dynamic_table_lock);
+			return _dynamic_table->GetModifiedCount();
+		}
 	}
 }
\ No newline at end of file
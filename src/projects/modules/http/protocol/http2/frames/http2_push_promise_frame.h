@@ -18,13 +18,21 @@ namespace http
 	{
 		namespace h2
 		{
-            // Not yet implemented
+			// Only the server side (sending) is implemented
 			class Http2PushPromiseFrame : public Http2Frame
 			{
 			public:
+				enum class Flags : uint8_t
+				{
+					None = 0x00,
+					EndHeaders = 0x04,
+					Padded = 0x08,
+				};
+
 				// Make by itself
-				Http2PushPromiseFrame()
-					: Http2Frame(0)
+				// stream_id: The stream that the pushed request is associated with
+				Http2PushPromiseFrame(uint32_t stream_id)
+					: Http2Frame(stream_id)
 				{
 					SetType(Http2Frame::Type::PushPromise);
 				}
@@ -34,6 +42,34 @@ namespace http
 				{
 				}
 
+				// Setters
+				void SetEndHeaders()
+				{
+					TURN_ON_HTTP2_FRAME_FLAG(Flags::EndHeaders);
+				}
+
+				void SetPromisedStreamId(uint32_t promised_stream_id)
+				{
+					_promised_stream_id = promised_stream_id;
+				}
+
+				// Set Header Block Fragment (The request header fields of the pushed request)
+				void SetHeaderBlockFragment(const std::shared_ptr<const ov::Data> &header_block_fragment)
+				{
+					_header_block_fragment = header_block_fragment;
+				}
+
+				// Getters
+				uint32_t GetPromisedStreamId() const
+				{
+					return _promised_stream_id;
+				}
+
+				const std::shared_ptr<const ov::Data> &GetHeaderBlockFragment() const
+				{
+					return _header_block_fragment;
+				}
+
 				// To String
 				ov::String ToString() const override
 				{
@@ -44,7 +80,13 @@ namespace http
 					str += "\n";
 					str += "[PUSH_PROMISE Frame]\n";
 
-					str += ov::String::FormatString("Not yet implemented\n");
+					str += ov::String::FormatString("Promised Stream ID : %u\n", _promised_stream_id);
+
+					// Header Block Fragment length
+					str += ov::String::FormatString("Header Block Fragment Length : %d\n", (_header_block_fragment != nullptr) ? _header_block_fragment->GetLength() : 0);
+
+					str += ov::String::FormatString("Flags : EndHeaders(%s)\n",
+					ov::Converter::ToString(CHECK_HTTP2_FRAME_FLAG(Flags::EndHeaders)).CStr());
 
 					return str;
 				}
@@ -57,7 +99,19 @@ namespace http
 						return Http2Frame::GetPayload();
 					}
 
-					return nullptr;
+					auto payload = std::make_shared<ov::Data>();
+					ov::ByteStream stream(payload.get());
+
+					// R(1) + Promised Stream ID(31)
+					stream.WriteBE32(_promised_stream_id & 0x7FFFFFFF);
+
+					// Append Header Block Fragment
+					if (_header_block_fragment != nullptr)
+					{
+						payload->Append(_header_block_fragment);
+					}
+
+					return payload;
 				}
 
 			private:
@@ -68,10 +122,14 @@ namespace http
 						return false;
 					}
 
+					// A client cannot push
 					SetParsingState(ParsingState::Error);
 
 					return true;
 				}
+
+				uint32_t _promised_stream_id = 0;
+				std::shared_ptr<const ov::Data> _header_block_fragment = nullptr;
 			};
 		}
 	}
@@ -258,9 +258,13 @@ namespace http
 						break;
 				}
 
-				// To optimize the speed, masking is processed with a multiple of 8, which is set to a multiple of 8 in advance to prevent buffer reallocation
-				ssize_t total_length = _header.mask ? (((_payload_length + 7L) / 8L) * 8L) : _payload_length;
-				_payload = std::make_shared<ov::Data>(total_length);
+				if (_payload_length > MAX_WEBSOCKET_FRAME_SIZE)
+				{
+					logte("Too large payload: %llu (max: %lld)", _payload_length, MAX_WEBSOCKET_FRAME_SIZE);
+					return -1;
+				}
+
+				_payload = std::make_shared<ov::Data>(_payload_length);
 
 				_last_status = FrameParseStatus::ParseMask;
 
@@ -300,10 +304,18 @@ namespace http
 
 				if (bytes_to_read > 0)
 				{
+					auto offset = _payload->GetLength();
+
 					if (_payload->Append(data->GetData(), bytes_to_read) == false)
 					{
 						return -1;
 					}
+
+					if (_header.mask)
+					{
+						// Unmask the received bytes while they are still in the cache
+						Unmask(_payload->GetWritableDataAs<uint8_t>() + offset, bytes_to_read, offset);
+					}
 				}
 
 				_remained_payload_length -= bytes_to_read;
@@ -313,28 +325,6 @@ namespace http
 					// Frame is completed
 					OV_ASSERT2(_payload->GetLength() == _payload_length);
 
-					if (_header.mask)
-					{
-						size_t payload_length = _payload->GetLength();
-
-						// For quick calculation, we'll adjust it to a multiple of 8
-						// (When _header.mask is on, it has already been allocated as a multiple of 8 when allocating data)
-
-						static_assert(sizeof(_frame_masking_key) == 4, "sizeof(_frame_masking_key) must be 4 bytes");
-
-						uint64_t mask = static_cast<uint64_t>(_frame_masking_key) << (sizeof(_frame_masking_key) * 8) | static_cast<uint64_t>(_frame_masking_key);
-
-						size_t block_count = ((payload_length + 7L) / 8L);
-
-						auto current = _payload->GetWritableDataAs<uint64_t>();
-
-						for (size_t index = 0; index < block_count; index++)
-						{
-							*current ^= mask;
-							current++;
-						}
-					}
-
 					logtd("The frame is finished: %s", ToString().CStr());
 
 					_last_status = FrameParseStatus::Completed;
@@ -347,6 +337,46 @@ namespace http
 				return bytes_to_read;
 			}
 
+			void Frame::Unmask(uint8_t *data, size_t length, uint64_t offset) const
+			{
+				// RFC6455 - 5.3. Client-to-Server Masking
+				//
+				// Octet i of the transformed data ("transformed-octet-i") is the XOR of
+				// octet i of the original data ("original-octet-i") with octet at index
+				// i modulo 4 of the masking key ("masking-key-octet-j"):
+				//
+				//   j                   = i MOD 4
+				//   transformed-octet-i = original-octet-i XOR masking-key-octet-j
+				static_assert(sizeof(_frame_masking_key) == 4, "sizeof(_frame_masking_key) must be 4 bytes");
+
+				// _frame_masking_key is stored in the order of the received octets, so the key is rotated to start at the offset
+				auto key = reinterpret_cast<const uint8_t *>(&_frame_masking_key);
+				uint8_t mask_bytes[sizeof(uint64_t)];
+
+				for (size_t index = 0; index < sizeof(mask_bytes); index++)
+				{
+					mask_bytes[index] = key[(offset + index) % sizeof(_frame_masking_key)];
+				}
+
+				uint64_t mask;
+				::memcpy(&mask, mask_bytes, sizeof(mask));
+
+				// 8 bytes at a time (memcpy() is used because the data may not be aligned)
+				size_t index = 0;
+				for (; (index + sizeof(mask)) <= length; index += sizeof(mask))
+				{
+					uint64_t block;
+					::memcpy(&block, data + index, sizeof(block));
+					block ^= mask;
+					::memcpy(data + index, &block, sizeof(block));
+				}
+
+				for (; index < length; index++)
+				{
+					data[index] ^= mask_bytes[index % sizeof(mask_bytes)];
+				}
+			}
+
 			void Frame::Reset()
 			{
 				::memset(&_header, 0, sizeof(_header));
@@ -149,6 +149,9 @@ namespace http
 				ssize_t ProcessMask(const std::shared_ptr<const ov::Data> &data);
 				ssize_t ProcessPayload(const std::shared_ptr<const ov::Data> &data);
 
+				// Unmasks the data in place, offset is the position of the data in the payload
+				void Unmask(uint8_t *data, size_t length, uint64_t offset) const;
+
 				FrameHeader _header;
 				int _header_read_bytes = 0;
 
@@ -0,0 +1,78 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http2_preframed_data.h"
+
+#include "../../protocol/http2/frames/http2_data_frame.h"
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			PreframedData::PreframedData(const std::shared_ptr<const ov::Data> &payload, size_t max_frame_size)
+				: _payload(payload)
+			{
+				auto payload_length = (_payload != nullptr) ? _payload->GetLength() : 0;
+				auto frame_count = std::max(static_cast<size_t>(1), (payload_length + max_frame_size - 1) / max_frame_size);
+
+				_fragments.reserve(frame_count);
+
+				if (payload_length == 0)
+				{
+					// A DATA frame without payload
+					_fragments.push_back(nullptr);
+					return;
+				}
+
+				for (size_t offset = 0; offset < payload_length; offset += max_frame_size)
+				{
+					_fragments.push_back(_payload->Subdata(offset, std::min(max_frame_size, payload_length - offset)));
+				}
+			}
+
+			const std::shared_ptr<const ov::Data> &PreframedData::GetPayload() const
+			{
+				return _payload;
+			}
+
+			std::vector<PreframedData::Frame> PreframedData::GetFrames(uint32_t stream_id, bool end_stream) const
+			{
+				std::vector<Frame> frames;
+				frames.reserve(_fragments.size());
+
+				for (const auto &fragment : _fragments)
+				{
+					auto fragment_length = (fragment != nullptr) ? fragment->GetLength() : 0;
+					auto flags = prot::h2::Http2DataFrame::Flags::None;
+
+					if (end_stream && (&fragment == &_fragments.back()))
+					{
+						flags = prot::h2::Http2DataFrame::Flags::EndStream;
+					}
+
+					uint8_t header[HTTP2_FRAME_HEADER_SIZE] = {
+						static_cast<uint8_t>((fragment_length >> 16) & 0xFF),
+						static_cast<uint8_t>((fragment_length >> 8) & 0xFF),
+						static_cast<uint8_t>(fragment_length & 0xFF),
+						static_cast<uint8_t>(prot::h2::Http2Frame::Type::Data),
+						static_cast<uint8_t>(flags),
+						static_cast<uint8_t>((stream_id >> 24) & 0x7F),
+						static_cast<uint8_t>((stream_id >> 16) & 0xFF),
+						static_cast<uint8_t>((stream_id >> 8) & 0xFF),
+						static_cast<uint8_t>(stream_id & 0xFF)};
+
+					frames.push_back({std::make_shared<const ov::Data>(header, HTTP2_FRAME_HEADER_SIZE), fragment});
+				}
+
+				return frames;
+			}
+		}  // namespace h2
+	}  // namespace svr
+}  // namespace http
@@ -0,0 +1,48 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			// DATA frames of a payload that is sent to many streams (such as a LL-HLS partial segment).
+			// The payload is split into the frames only once and shared by all streams,
+			// only the 9-byte frame headers are made for each stream.
+			class PreframedData
+			{
+			public:
+				struct Frame
+				{
+					std::shared_ptr<const ov::Data> header;
+					// A part of the payload (nullptr if the payload is empty)
+					std::shared_ptr<const ov::Data> payload;
+				};
+
+				// max_frame_size: The payload is split into the frames of this size
+				PreframedData(const std::shared_ptr<const ov::Data> &payload, size_t max_frame_size);
+
+				const std::shared_ptr<const ov::Data> &GetPayload() const;
+
+				// Returns the DATA frames to send to the stream
+				std::vector<Frame> GetFrames(uint32_t stream_id, bool end_stream) const;
+
+			private:
+				std::shared_ptr<const ov::Data> _payload;
+
+				// Payload of each frame (they refer to the memory of _payload)
+				std::vector<std::shared_ptr<const ov::Data>> _fragments;
+			};
+		}  // namespace h2
+	}  // namespace svr
+}  // namespace http
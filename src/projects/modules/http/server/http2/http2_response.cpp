@@ -45,14 +45,24 @@ namespace http
 				return Send(frame);
 			}
 
+			bool Http2Response::AppendPreframedData(const std::shared_ptr<const PreframedData> &preframed_data)
+			{
+				if ((preframed_data == nullptr) || (preframed_data->GetPayload() == nullptr))
+				{
+					return false;
+				}
+
+				_preframed_data_map[preframed_data->GetPayload().get()] = preframed_data;
+
+				return AppendData(preframed_data->GetPayload());
+			}
+
 			uint32_t Http2Response::SendHeader()
 			{
-				std::shared_ptr<ov::Data> header_block = std::make_shared<ov::Data>(65535);
 				size_t sent_size = 0;
 
 				// :status header field is must on top
-				auto header_field = _hpack_encoder->Encode({":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode()))}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-				header_block->Append(header_field);
+				std::vector<hpack::HeaderField> header_fields = {{":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode()))}};
 
 				for (const auto &[name, values] : GetResponseHeaderList())
 				{
@@ -60,11 +70,16 @@ namespace http
 					{
 						// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
 						// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
-						auto header_field = _hpack_encoder->Encode({name.LowerCaseString(), value}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-						header_block->Append(header_field);
+						header_fields.emplace_back(name.LowerCaseString(), value);
 					}
 				}
 
+				auto header_block = _hpack_encoder->EncodeHeaderBlock(header_fields);
+				if (header_block == nullptr)
+				{
+					return 0;
+				}
+
 				logtd("[Http2Response] Send header block : size(%u)", header_block->GetLength());
 
 				std::shared_ptr<ov::Data> head_block_fragment;
@@ -144,6 +159,29 @@ namespace http
 
 				for (const auto &data : GetResponseDataList())
 				{
+					auto preframed_data = _preframed_data_map.find(data.get());
+					if (preframed_data != _preframed_data_map.end())
+					{
+						bool end_stream = (_keep_stream == false && (&data == &GetResponseDataList().back()));
+
+						// The payload of the frames is shared with the other streams, so it is sent without copying
+						for (const auto &frame : preframed_data->second->GetFrames(_stream_id, end_stream))
+						{
+							auto result = (frame.payload != nullptr) ? HttpResponse::Send(frame.header, frame.payload) : HttpResponse::Send(frame.header);
+
+							if (result == false)
+							{
+								logte("Failed to send payload");
+								_preframed_data_map.clear();
+								ResetResponseData();
+								return -1;
+							}
+						}
+
+						sent_bytes += data->GetLength();
+						continue;
+					}
+
 					size_t offset = 0;
 					auto data_fragment = data;
 					while (offset + MAX_HTTP2_DATA_SIZE < data->GetLength())
@@ -156,6 +194,7 @@ namespace http
 						if (Send(payload_frame) == false)
 						{
 							logte("Failed to send payload");
+							_preframed_data_map.clear();
 							ResetResponseData();
 							return -1;
 						}
@@ -177,6 +216,7 @@ namespace http
 					if (Send(payload_frame) == false)
 					{
 						logte("Failed to send payload");
+						_preframed_data_map.clear();
 						ResetResponseData();
 						return -1;
 					}
@@ -184,6 +224,7 @@ namespace http
 					sent_bytes += data->GetLength();
 				}
 
+				_preframed_data_map.clear();
 				ResetResponseData();
 
 				logtd("All datas are sent...");
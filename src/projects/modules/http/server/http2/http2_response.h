@@ -12,6 +12,7 @@
 #include "../http_response.h"
 #include "../../protocol/http2/frames/http2_frames.h"
 #include "../../hpack/encoder.h"
+#include "http2_preframed_data.h"
 
 #define MAX_HTTP2_HEADER_SIZE (1024 * 1024)
 #define MAX_HTTP2_DATA_SIZE (16384)
@@ -34,6 +35,9 @@ namespace http
 				void SetKeepStream(bool keep_stream);
 				bool Send(const std::shared_ptr<prot::h2::Http2DataFrame> &data_frame, bool end_stream);
 
+				// Appends the payload of preframed_data, and its DATA frames are sent instead of framing the payload again
+				bool AppendPreframedData(const std::shared_ptr<const PreframedData> &preframed_data);
+
 			private:
 				uint32_t SendHeader() override;
 				uint32_t SendPayload() override;
@@ -41,6 +45,9 @@ namespace http
 				uint32_t _stream_id = 0;
 				bool _keep_stream = false;
 				std::shared_ptr<hpack::Encoder> _hpack_encoder;
+
+				// Key: Payload of the PreframedData
+				std::map<const ov::Data *, std::shared_ptr<const PreframedData>> _preframed_data_map;
 			};
 		}
 	}
@@ -52,6 +52,43 @@ namespace http
 				return _stream_id;
 			}
 
+			std::shared_ptr<HttpStream> HttpStream::PushPromise(const ov::String &path)
+			{
+				auto connection = GetConnection();
+				auto promised_stream = connection->CreateHttp2PushStream();
+				if (promised_stream == nullptr)
+				{
+					return nullptr;
+				}
+
+				// The request header fields of the promised request
+				auto header_block = connection->GetHpackEncoder()->EncodeHeaderBlock({
+					{":method", "GET"},
+					{":scheme", (connection->GetTlsData() != nullptr) ? "https" : "http"},
+					{":authority", _request->GetHost()},
+					{":path", path}});
+				if (header_block == nullptr)
+				{
+					promised_stream->Release();
+					return nullptr;
+				}
+
+				auto push_promise_frame = std::make_shared<Http2PushPromiseFrame>(_stream_id);
+				push_promise_frame->SetPromisedStreamId(promised_stream->GetStreamId());
+				push_promise_frame->SetHeaderBlockFragment(header_block);
+				push_promise_frame->SetEndHeaders();
+
+				if (_response->Send(push_promise_frame) == false)
+				{
+					promised_stream->Release();
+					return nullptr;
+				}
+
+				logtd("Promised stream(%u) is reserved by stream(%u) : %s", promised_stream->GetStreamId(), _stream_id, path.CStr());
+
+				return promised_stream;
+			}
+
 			bool HttpStream::OnEndHeaders()
 			{
 				// Header Completed
@@ -280,6 +317,12 @@ namespace http
 						auto hpack_encoder = GetConnection()->GetHpackEncoder();
 						hpack_encoder->UpdateDynamicTableSize(std::min(size, MAX_HEADER_TABLE_SIZE));
 					}
+
+					auto [enable_push_exist, enable_push] = frame->GetParameter(Http2SettingsFrame::Parameters::EnablePush);
+					if (enable_push_exist)
+					{
+						GetConnection()->SetHttp2PushEnabled(enable_push != 0);
+					}
 					
 					// Settings Frame
 					auto settings_frame = std::make_shared<Http2SettingsFrame>();
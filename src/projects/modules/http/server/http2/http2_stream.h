@@ -38,6 +38,12 @@ namespace http
 				uint32_t GetStreamId() const;
 				bool OnFrameReceived(const std::shared_ptr<Http2Frame> &frame);
 
+				// Server push (https://www.rfc-editor.org/rfc/rfc7540#section-8.2)
+				// Sends PUSH_PROMISE of the GET request for path on this stream, and returns the promised stream.
+				// The response of the promised stream is sent in the same way as the other streams.
+				// It must be called before the response of this stream is sent, and returns nullptr if the client disabled the server push.
+				std::shared_ptr<HttpStream> PushPromise(const ov::String &path);
+
 			private:
 				// Send Settings frame and Window_Update frame
 				bool SendInitialControlMessage();
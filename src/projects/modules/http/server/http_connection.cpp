@@ -199,6 +199,40 @@ namespace http
 			return _hpack_decoder;
 		}
 
+		void HttpConnection::SetHttp2PushEnabled(bool enabled)
+		{
+			_http2_push_enabled = enabled;
+		}
+
+		bool HttpConnection::IsHttp2PushEnabled() const
+		{
+			return (_connection_type == ConnectionType::Http20) && _http2_push_enabled;
+		}
+
+		std::shared_ptr<h2::HttpStream> HttpConnection::CreateHttp2PushStream()
+		{
+			if (IsHttp2PushEnabled() == false)
+			{
+				return nullptr;
+			}
+
+			std::unique_lock<std::mutex> lock(_http_stream_map_guard);
+
+			if (_next_push_stream_id > 0x7FFFFFFF)
+			{
+				// Stream identifiers cannot be reused
+				return nullptr;
+			}
+
+			auto stream_id = _next_push_stream_id;
+			_next_push_stream_id += 2;
+
+			auto stream = std::make_shared<h2::HttpStream>(GetSharedPtr(), stream_id);
+			_http_stream_map.emplace(stream_id, stream);
+
+			return stream;
+		}
+
 		// Find Interceptor
 		std::shared_ptr<RequestInterceptor> HttpConnection::FindInterceptor(const std::shared_ptr<HttpExchange> &exchange)
 		{
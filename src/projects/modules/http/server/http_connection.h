@@ -64,6 +64,12 @@ namespace http
 			std::shared_ptr<hpack::Encoder> GetHpackEncoder() const;
 			std::shared_ptr<hpack::Decoder> GetHpackDecoder() const;
 
+			// HTTP/2 server push (SETTINGS_ENABLE_PUSH of the client)
+			void SetHttp2PushEnabled(bool enabled);
+			bool IsHttp2PushEnabled() const;
+			// Reserves a stream for the server push, returns nullptr if the server push is not available
+			std::shared_ptr<h2::HttpStream> CreateHttp2PushStream();
+
 			// To string
 			virtual ov::String ToString() const;
 
@@ -122,6 +128,10 @@ namespace http
 			// HTTP/2 HPACK Codec
 			std::shared_ptr<hpack::Encoder> _hpack_encoder = nullptr;
 			std::shared_ptr<hpack::Decoder> _hpack_decoder = nullptr;
+			// The server push is enabled until the client disables it (https://www.rfc-editor.org/rfc/rfc7540#section-6.5.2)
+			std::atomic<bool> _http2_push_enabled = true;
+			// Streams initiated by the server use even-numbered stream identifiers
+			uint32_t _next_push_stream_id = 2;
 
 			///////////////////////
 			// For Websocket
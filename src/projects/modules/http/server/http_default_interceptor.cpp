@@ -86,7 +86,7 @@ namespace http
 			// A variable to handle 403 Method not allowed
 			bool regex_found = false;
 
-			auto uri = ov::Url::Parse(request->GetUri());
+			auto &uri = request->GetParsedUri();
 
 			if (uri == nullptr)
 			{
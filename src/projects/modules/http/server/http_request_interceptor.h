@@ -12,6 +12,7 @@
 #include <modules/physical_port/physical_port_observer.h>
 
 #include <memory>
+#include <vector>
 
 #include "../http_datastructure.h"
 
@@ -31,6 +32,15 @@ namespace http
 			// If this method returns true, it will only pass to this interceptor when data is received in the future, but not to another interceptor.
 			virtual bool IsInterceptorForRequest(const std::shared_ptr<const HttpExchange> &client) = 0;
 
+			/// Returns the file extensions (lowercase, without the dot) of the requests that this interceptor can process.
+			/// HttpServer uses them to route the request without calling IsInterceptorForRequest() of unrelated interceptors.
+			///
+			/// @return If empty, IsInterceptorForRequest() is called for every request regardless of the extension
+			virtual std::vector<ov::String> GetRoutingExtensions() const
+			{
+				return {};
+			}
+
 			/// A callback called to initialize request/response immediately after IsInterceptorForRequest()
 			///
 			/// @param client An instance that contains informations related to HTTP request/response
@@ -303,6 +303,28 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::Send(const std::shared_ptr<const ov::Data> &header, const std::shared_ptr<const ov::Data> &payload)
+		{
+			if ((header == nullptr) || (payload == nullptr))
+			{
+				OV_ASSERT2((header != nullptr) && (payload != nullptr));
+				return false;
+			}
+
+			if (_tls_data == nullptr)
+			{
+				// ov::Socket copies the data only if it cannot be sent immediately
+				return _client_socket->Send(header, payload);
+			}
+
+			// They are encrypted into one TLS record
+			auto data = std::make_shared<ov::Data>(header->GetLength() + payload->GetLength());
+			data->Append(header);
+			data->Append(payload);
+
+			return Send(data);
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
@@ -82,6 +82,8 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
+			// Sends the header followed by the payload without copying the payload (if TLS is not used)
+			bool Send(const std::shared_ptr<const ov::Data> &header, const std::shared_ptr<const ov::Data> &payload);
 			
 		private:
 			virtual uint32_t SendHeader();
@@ -94,7 +94,11 @@ namespace http
 				client.second->Close(PhysicalPortDisconnectReason::Disconnect);
 			}
 
-			_interceptor_list.clear();
+			{
+				std::lock_guard<std::shared_mutex> guard(_interceptor_list_mutex);
+				_interceptor_list.clear();
+				RebuildInterceptorRouteTable();
+			}
 
 			_repeater.Stop();
 
@@ -239,15 +243,88 @@ namespace http
 			}
 
 			_interceptor_list.push_back(interceptor);
+			RebuildInterceptorRouteTable();
+
 			return true;
 		}
 
+		void HttpServer::RebuildInterceptorRouteTable()
+		{
+			_interceptor_route_table.clear();
+			_generic_interceptor_list.clear();
+
+			// Collect all extensions first, so that every route keeps the generic interceptors in registration order
+			for (auto &interceptor : _interceptor_list)
+			{
+				for (auto &extension : interceptor->GetRoutingExtensions())
+				{
+					_interceptor_route_table[extension.LowerCaseString()];
+				}
+			}
+
+			for (auto &interceptor : _interceptor_list)
+			{
+				auto extensions = interceptor->GetRoutingExtensions();
+
+				if (extensions.empty())
+				{
+					_generic_interceptor_list.push_back(interceptor);
+
+					for (auto &route : _interceptor_route_table)
+					{
+						route.second.push_back(interceptor);
+					}
+
+					continue;
+				}
+
+				for (auto &extension : extensions)
+				{
+					auto &route = _interceptor_route_table[extension.LowerCaseString()];
+
+					// Prevent duplicate registration when an interceptor declares the same extension twice
+					if (std::find(route.begin(), route.end(), interceptor) == route.end())
+					{
+						route.push_back(interceptor);
+					}
+				}
+			}
+		}
+
+		ov::String HttpServer::GetRoutingExtension(const std::shared_ptr<const HttpExchange> &exchange)
+		{
+			auto &parsed_uri = exchange->GetRequest()->GetParsedUri();
+
+			if (parsed_uri == nullptr)
+			{
+				return "";
+			}
+
+			// Path() doesn't contain the query string
+			auto &path = parsed_uri->Path();
+			auto slash_index = path.IndexOfRev('/');
+			auto dot_index = path.IndexOfRev('.');
+
+			if ((dot_index < 0) || (dot_index < slash_index))
+			{
+				// The last segment of the path has no extension
+				return "";
+			}
+
+			return path.Substring(dot_index + 1).LowerCaseString();
+		}
+
 		std::shared_ptr<RequestInterceptor> HttpServer::FindInterceptor(const std::shared_ptr<HttpExchange> &exchange)
 		{
+			auto extension = GetRoutingExtension(exchange);
+
 			// Find interceptor for the request
 			std::shared_lock<std::shared_mutex> guard(_interceptor_list_mutex);
 
-			for (auto &interceptor : _interceptor_list)
+			auto route = _interceptor_route_table.find(extension);
+			auto &candidates = (route != _interceptor_route_table.end()) ? route->second : _generic_interceptor_list;
+
+			for (auto &interceptor : candidates)
 			{
 				if (interceptor->IsInterceptorForRequest(exchange))
 				{
@@ -277,6 +354,8 @@ namespace http
 			}
 
 			_interceptor_list.erase(item);
+			RebuildInterceptorRouteTable();
+
 			return true;
 		}
 
@@ -65,6 +65,10 @@ namespace http
 			std::shared_ptr<HttpConnection> FindClient(const std::shared_ptr<ov::Socket> &remote);
 			std::shared_ptr<HttpConnection> ProcessConnect(const std::shared_ptr<ov::Socket> &remote);
 
+			// Must be called while holding _interceptor_list_mutex
+			void RebuildInterceptorRouteTable();
+			static ov::String GetRoutingExtension(const std::shared_ptr<const HttpExchange> &exchange);
+
 			//--------------------------------------------------------------------
 			// Implementation of PhysicalPortObserver
 			//--------------------------------------------------------------------
@@ -86,6 +90,10 @@ namespace http
 
 			std::shared_mutex _interceptor_list_mutex;
 			std::vector<std::shared_ptr<RequestInterceptor>> _interceptor_list;
+			// key: extension of the request path, value: candidate interceptors in registration order
+			std::unordered_map<ov::String, std::vector<std::shared_ptr<RequestInterceptor>>> _interceptor_route_table;
+			// Interceptors that don't declare any extension (used when the extension isn't in the route table)
+			std::vector<std::shared_ptr<RequestInterceptor>> _generic_interceptor_list;
 			std::vector<std::shared_ptr<ocst::VirtualHost>> _virtual_host_list;
 
 		private:
@@ -43,7 +43,7 @@ namespace http
 
 				size_t length = (data == nullptr) ? 0LL : data->GetLength();
 
-				if (length < 0x7D)
+				if (length <= 0x7D)
 				{
 					// frame-payload-length    = ( %x00-7D )
 					//                         / ( %x7E frame-payload-length-16 )
@@ -52,7 +52,7 @@ namespace http
 					//                         ; respectively
 					header.payload_length = static_cast<uint8_t>(length);
 				}
-				else if (length < 0xFFFF)
+				else if (length <= 0xFFFF)
 				{
 					// frame-payload-length-16 = %x0000-FFFF ; 16 bits in length
 					header.payload_length = 126;
@@ -64,28 +64,31 @@ namespace http
 					header.payload_length = 127;
 				}
 
-				auto response_data = std::make_shared<ov::Data>(65535);
+				// Only the frame header is made here, the payload is sent as it is
+				// (Header + 64 bits extended payload length)
+				auto header_data = std::make_shared<ov::Data>(sizeof(header) + sizeof(uint64_t));
 
-				response_data->Append(&header, sizeof(header));
+				header_data->Append(&header, sizeof(header));
 
 				if (header.payload_length == 126)
 				{
 					auto payload_length = ov::HostToNetwork16(static_cast<uint16_t>(length));
-					response_data->Append(&payload_length, sizeof(payload_length));
+					header_data->Append(&payload_length, sizeof(payload_length));
 				}
 				else if (header.payload_length == 127)
 				{
 					auto payload_length = ov::HostToNetwork64(static_cast<uint64_t>(length));
-					response_data->Append(&payload_length, sizeof(payload_length));
+					header_data->Append(&payload_length, sizeof(payload_length));
 				}
 
-				if (length > 0LL)
+				if (length == 0LL)
 				{
-					logtd("Trying to send data\n%s", data->Dump(32).CStr());
-					response_data->Append(data);
+					return HttpResponse::Send(header_data) ? length : -1LL;
 				}
 
-				return HttpResponse::Send(response_data) ? length : -1LL;
+				logtd("Trying to send data\n%s", data->Dump(32).CStr());
+
+				return HttpResponse::Send(header_data, data) ? length : -1LL;
 			}
 
 			ssize_t WebSocketResponse::Send(const ov::String &string)
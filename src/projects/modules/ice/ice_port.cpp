@@ -267,8 +267,7 @@ bool IcePort::RemoveSession(uint32_t session_id)
 	{
 		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
 
-		auto item = _session_port_table.find(session_id);
-		if (item == _session_port_table.end())
+		if (_session_port_table.Find(session_id, &ice_port_info) == false)
 		{
 			/*
 			The case of reaching here is as follows.
@@ -316,12 +315,10 @@ bool IcePort::RemoveSession(uint32_t session_id)
 			return false;
 		}
 
-		ice_port_info = item->second;
-
-		_session_port_table.erase(item);
+		_session_port_table.Erase(session_id);
 		for(const auto &item : ice_port_info->address_map)
 		{
-			_address_port_table.erase(item.first);
+			_address_port_table.Erase(item.first);
 		}
 
 		// Close only TCP (TURN)
@@ -386,10 +383,10 @@ void IcePort::CheckTimedoutItem()
 
 		for (auto &deleted_ice_port : delete_list)
 		{
-			_session_port_table.erase(deleted_ice_port->session_id);
+			_session_port_table.Erase(deleted_ice_port->session_id);
 			for(const auto &item : deleted_ice_port->address_map)
 			{
-				_address_port_table.erase(item.first);
+				_address_port_table.Erase(item.first);
 			}
 		}
 	}
@@ -422,35 +419,43 @@ bool IcePort::Send(uint32_t session_id, std::shared_ptr<RtcpPacket> packet)
 bool IcePort::Send(uint32_t session_id, const std::shared_ptr<const ov::Data> &data)
 {
 	std::shared_ptr<IcePortInfo> ice_port_info;
+	if (_session_port_table.Find(session_id, &ice_port_info) == false)
 	{
-		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
-
-		auto item = _session_port_table.find(session_id);
-		if (item == _session_port_table.end())
-		{
-			logtd("ClientSocket not found for session #%d", session_id);
-			return false;
-		}
-
-		ice_port_info = item->second;
+		logtd("ClientSocket not found for session #%d", session_id);
+		return false;
 	}
 
 	std::shared_ptr<const ov::Data> send_data = nullptr;
 
-	// Send throutgh TURN data channel
-	if(ice_port_info->is_turn_client == true && ice_port_info->is_data_channel_enabled == true)
-	{	
-		send_data = CreateChannelDataMessage(ice_port_info->data_channle_number, data);
-	}
-	// Send thourgh DATA indication
-	else if(ice_port_info->is_turn_client == true && ice_port_info->is_data_channel_enabled == false)
+	if(ice_port_info->is_turn_client == false)
 	{
-		send_data = CreateDataIndication(ice_port_info->peer_address, data);
+		// Send direct
+		send_data = data;
 	}
-	// Send direct
 	else
 	{
-		send_data = data;
+		bool is_data_channel_enabled;
+		uint16_t data_channel_number;
+		ov::SocketAddress peer_address;
+
+		{
+			// The TURN fields are updated by the packets from the client
+			std::lock_guard<std::mutex> lock_guard(ice_port_info->turn_lock);
+			is_data_channel_enabled = ice_port_info->is_data_channel_enabled;
+			data_channel_number = ice_port_info->data_channle_number;
+			peer_address = ice_port_info->peer_address;
+		}
+
+		// Send throutgh TURN data channel
+		if(is_data_channel_enabled == true)
+		{	
+			send_data = CreateChannelDataMessage(data_channel_number, data);
+		}
+		// Send thourgh DATA indication
+		else
+		{
+			send_data = CreateDataIndication(peer_address, data);
+		}
 	}
 
 	if(send_data == nullptr)
@@ -557,26 +562,23 @@ void IcePort::OnApplicationPacketReceived(const std::shared_ptr<ov::Socket> &rem
 						GateInfo &gate_info, const std::shared_ptr<const ov::Data> &data)
 {
 	std::shared_ptr<IcePortInfo> ice_port_info;
+	if (_address_port_table.Find(address, &ice_port_info) == false)
 	{
-		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
-		auto item = _address_port_table.find(address);
-		if (item != _address_port_table.end())
-		{
-			ice_port_info = item->second;
-			// When the candidate pair is determined, the peer starts sending DTLS messages. This can be seen as a true connected.
-			if(ice_port_info->state != IcePortConnectionState::Connected)
-			{
-				SetIceState(ice_port_info, IcePortConnectionState::Connected);
-				// It communicates with the candidate address that sends application data first.
-				ice_port_info->address = address;
-			}
-		}
+		logtw("Could not find client(%s) information. Dropping...", address.ToString(false).CStr());
+		return;
 	}
 
-	if (ice_port_info == nullptr)
+	// When the candidate pair is determined, the peer starts sending DTLS messages. This can be seen as a true connected.
+	if(ice_port_info->state != IcePortConnectionState::Connected)
 	{
-		logtw("Could not find client(%s) information. Dropping...", address.ToString(false).CStr());
-		return;
+		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
+
+		if(ice_port_info->state != IcePortConnectionState::Connected)
+		{
+			SetIceState(ice_port_info, IcePortConnectionState::Connected);
+			// It communicates with the candidate address that sends application data first.
+			ice_port_info->address = address;
+		}
 	}
 	
 	if(ice_port_info->observer != nullptr)
@@ -603,16 +605,13 @@ void IcePort::OnChannelDataPacketReceived(const std::shared_ptr<ov::Socket> &rem
 	// Update GateInfo
 	// If a request comes from a send indication or channel, this is through a turn. When transmitting a packet to the player, it must be sent through a data indication or channel, so it stores related information.
 	std::shared_ptr<IcePortInfo> ice_port_info;
+	if (_address_port_table.Find(address, &ice_port_info))
 	{
-		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
-		auto item = _address_port_table.find(address);
-		if (item != _address_port_table.end())
-		{
-			ice_port_info = item->second;
-			ice_port_info->is_turn_client = true;
-			ice_port_info->is_data_channel_enabled = true;
-			ice_port_info->data_channle_number = application_gate_info.channel_number;
-		}
+		std::lock_guard<std::mutex> lock_guard(ice_port_info->turn_lock);
+
+		ice_port_info->is_data_channel_enabled = true;
+		ice_port_info->data_channle_number = application_gate_info.channel_number;
+		ice_port_info->is_turn_client = true;
 	}
 
 	// Decapsulate and process the packet again.
@@ -761,36 +760,42 @@ bool IcePort::ProcessStunBindingRequest(const std::shared_ptr<ov::Socket> &remot
 
 			for(const auto &item : ice_port_info->address_map)
 			{
-				_address_port_table.erase(item.first);
+				_address_port_table.Erase(item.first);
 			}
-			_session_port_table.erase(ice_port_info->session_id);
+			_session_port_table.Erase(ice_port_info->session_id);
 		}
 
 		return false;
 	}
 
-	if (ice_port_info->state == IcePortConnectionState::New || 
-		(ice_port_info->state == IcePortConnectionState::Checking && ice_port_info->address != address) )
+	auto state = ice_port_info->state.load();
+	if (state == IcePortConnectionState::New || state == IcePortConnectionState::Checking)
 	{
 		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
 
-		if(ice_port_info->state == IcePortConnectionState::New)
+		// The state and the address may have been changed by another thread before the lock was acquired
+		state = ice_port_info->state.load();
+		if (state == IcePortConnectionState::New ||
+			(state == IcePortConnectionState::Checking && ice_port_info->address != address))
 		{
-			logti("Add the client to the port list: %s / %s", address.ToString(false).CStr(), gate_info.ToString().CStr());
-		}
-		else
-		{
-			logti("Update the client to the port list: to %s from %s", address.ToString(false).CStr(), ice_port_info->address.ToString(false).CStr());
-		}
+			if (state == IcePortConnectionState::New)
+			{
+				logti("Add the client to the port list: %s / %s", address.ToString(false).CStr(), gate_info.ToString().CStr());
+			}
+			else
+			{
+				logti("Update the client to the port list: to %s from %s", address.ToString(false).CStr(), ice_port_info->address.ToString(false).CStr());
+			}
 
-		ice_port_info->remote = remote;
-		ice_port_info->address = address;
-		ice_port_info->address_map[address] = true;
+			ice_port_info->remote = remote;
+			ice_port_info->address = address;
+			ice_port_info->address_map[address] = true;
 
-		_address_port_table[address] = ice_port_info;
-		_session_port_table[ice_port_info->session_id] = ice_port_info;
+			_address_port_table.Set(address, ice_port_info);
+			_session_port_table.Set(ice_port_info->session_id, ice_port_info);
 
-		SetIceState(ice_port_info, IcePortConnectionState::Checking);
+			SetIceState(ice_port_info, IcePortConnectionState::Checking);
+		}
 	}
 
 	ice_port_info->UpdateBindingTime();
@@ -1091,16 +1096,13 @@ bool IcePort::ProcessTurnSendIndication(const std::shared_ptr<ov::Socket> &remot
 	gate_info.peer_address = xor_peer_attribute->GetAddress();
 
 	std::shared_ptr<IcePortInfo> ice_port_info;
+	if (_address_port_table.Find(address, &ice_port_info))
 	{
-		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
-		auto item = _address_port_table.find(address);
-		if (item != _address_port_table.end())
-		{
-			ice_port_info = item->second;
-			ice_port_info->is_turn_client = true;
-			ice_port_info->is_data_channel_enabled = false;
-			ice_port_info->peer_address = gate_info.peer_address;
-		}
+		std::lock_guard<std::mutex> lock_guard(ice_port_info->turn_lock);
+
+		ice_port_info->is_data_channel_enabled = false;
+		ice_port_info->peer_address = gate_info.peer_address;
+		ice_port_info->is_turn_client = true;
 	}
 
 	OnPacketReceived(remote, address, gate_info, data);
@@ -1136,16 +1138,13 @@ bool IcePort::ProcessTurnChannelBindRequest(const std::shared_ptr<ov::Socket> &r
 	SendStunMessage(remote, address, gate_info, response_message, _hmac_key);
 
 	std::shared_ptr<IcePortInfo> ice_port_info;
+	if (_address_port_table.Find(address, &ice_port_info))
 	{
-		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
-		auto item = _address_port_table.find(address);
-		if (item != _address_port_table.end())
-		{
-			ice_port_info = item->second;
-			ice_port_info->is_turn_client = true;
-			ice_port_info->is_data_channel_enabled = true;
-			ice_port_info->data_channle_number = channel_number_attribute->GetChannelNumber();
-		}
+		std::lock_guard<std::mutex> lock_guard(ice_port_info->turn_lock);
+
+		ice_port_info->is_data_channel_enabled = true;
+		ice_port_info->data_channle_number = channel_number_attribute->GetChannelNumber();
+		ice_port_info->is_turn_client = true;
 	}
 
 	return true;
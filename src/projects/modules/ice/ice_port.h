@@ -73,12 +73,16 @@ protected:
 		ov::SocketAddress address;
 		std::map<ov::SocketAddress, bool> address_map;
 
-		IcePortConnectionState state;
+		// Written with _port_table_lock, but read by the packet threads without it
+		std::atomic<IcePortConnectionState> state = IcePortConnectionState::Closed;
 
 		std::chrono::time_point<std::chrono::system_clock> expire_time;
 
 		// Information related TURN
-		bool is_turn_client = false;
+		// The TURN fields are written by the packet threads and read by the sending threads with turn_lock
+		// (is_turn_client is set last, so the direct clients are sent without the lock)
+		std::mutex turn_lock;
+		std::atomic<bool> is_turn_client = false;
 		bool is_data_channel_enabled = false;
 		ov::SocketAddress peer_address;
 		uint16_t data_channle_number = 0;
@@ -145,14 +149,14 @@ public:
 
 	IcePortConnectionState GetState(uint32_t session_id) const
 	{
-		auto item = _session_port_table.find(session_id);
-		if(item == _session_port_table.end())
+		std::shared_ptr<IcePortInfo> ice_port_info;
+		if(_session_port_table.Find(session_id, &ice_port_info) == false)
 		{
 			OV_ASSERT(false, "Invalid session_id: %d", session_id);
 			return IcePortConnectionState::Failed;
 		}
 
-		return item->second->state;
+		return ice_port_info->state;
 	}
 
 	ov::String GenerateUfrag();
@@ -240,10 +244,12 @@ private:
 	
 	// Find IcePortInfo with peer's ip:port
 	// key: SocketAddress value: IcePortInfo
+	// These tables are looked up for every packet from all PhysicalPort worker threads, so they are sharded.
+	// _port_table_lock only serializes the writers (adding/removing a session to/from both tables, state transitions).
 	std::mutex _port_table_lock;
-	std::map<ov::SocketAddress, std::shared_ptr<IcePortInfo>> _address_port_table;
+	ov::ShardedMap<ov::SocketAddress, std::shared_ptr<IcePortInfo>> _address_port_table;
 	// Find IcePortInfo with peer's session id
-	std::map<session_id_t, std::shared_ptr<IcePortInfo>> _session_port_table;
+	ov::ShardedMap<session_id_t, std::shared_ptr<IcePortInfo>> _session_port_table;
 
 	// Insert item when send stun binding request
 	// Remove item when receive stun binding response or timed out
@@ -17,29 +17,60 @@ namespace serdes
 			return Json::nullValue;
 		}
 
+		auto snapshot = metrics->GetSnapshot();
 		Json::Value value;
 
-		SetTimestamp(value, "createdTime", metrics->GetCreatedTime());
-		SetTimestamp(value, "lastUpdatedTime", metrics->GetLastUpdatedTime());
-		SetInt64(value, "totalBytesIn", metrics->GetTotalBytesIn());
-		SetInt64(value, "totalBytesOut", metrics->GetTotalBytesOut());
-		SetTimestamp(value, "lastRecvTime", metrics->GetLastRecvTime());
-		SetTimestamp(value, "lastSentTime", metrics->GetLastSentTime());
-		SetInt(value, "totalConnections", metrics->GetTotalConnections());
-		SetInt(value, "maxTotalConnections", metrics->GetMaxTotalConnections());
-		SetTimestamp(value, "maxTotalConnectionTime", metrics->GetMaxTotalConnectionsTime());
+		SetTimestamp(value, "createdTime", snapshot.created_time);
+		SetTimestamp(value, "lastUpdatedTime", snapshot.last_updated_time);
+		SetInt64(value, "totalBytesIn", snapshot.total_bytes_in);
+		SetInt64(value, "totalBytesOut", snapshot.total_bytes_out);
+		SetTimestamp(value, "lastRecvTime", snapshot.last_recv_time);
+		SetTimestamp(value, "lastSentTime", snapshot.last_sent_time);
+		SetInt(value, "totalConnections", snapshot.total_connections);
+		SetInt(value, "maxTotalConnections", snapshot.max_total_connections);
+		SetTimestamp(value, "maxTotalConnectionTime", snapshot.max_total_connection_time);
 
 		Json::Value &connections = value["connections"];
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Webrtc).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Webrtc));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::LLDash).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::LLDash));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Hls).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Hls));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::LLHls).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::LLHls));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Dash).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Dash));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Ovt).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Ovt));
+		for (auto type : {PublisherType::Webrtc, PublisherType::LLDash, PublisherType::Hls, PublisherType::LLHls, PublisherType::Dash, PublisherType::Ovt})
+		{
+			SetInt(connections, StringFromPublisherType(type).LowerCaseString().CStr(), snapshot.connections[static_cast<int8_t>(type)]);
+		}
 
 		return value;
 	}
 
+	void WriteMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::CommonMetrics> &metrics)
+	{
+		if (metrics == nullptr)
+		{
+			writer.Null();
+			return;
+		}
+
+		auto snapshot = metrics->GetSnapshot();
+
+		writer.BeginObject();
+
+		writer.Member("createdTime", ov::Converter::ToISO8601String(snapshot.created_time));
+		writer.Member("lastUpdatedTime", ov::Converter::ToISO8601String(snapshot.last_updated_time));
+		writer.Member("totalBytesIn", static_cast<int64_t>(snapshot.total_bytes_in));
+		writer.Member("totalBytesOut", static_cast<int64_t>(snapshot.total_bytes_out));
+		writer.Member("lastRecvTime", ov::Converter::ToISO8601String(snapshot.last_recv_time));
+		writer.Member("lastSentTime", ov::Converter::ToISO8601String(snapshot.last_sent_time));
+		writer.Member("totalConnections", static_cast<int32_t>(snapshot.total_connections));
+		writer.Member("maxTotalConnections", static_cast<int32_t>(snapshot.max_total_connections));
+		writer.Member("maxTotalConnectionTime", ov::Converter::ToISO8601String(snapshot.max_total_connection_time));
+
+		writer.Key("connections").BeginObject();
+		for (auto type : {PublisherType::Webrtc, PublisherType::LLDash, PublisherType::Hls, PublisherType::LLHls, PublisherType::Dash, PublisherType::Ovt})
+		{
+			writer.Member(StringFromPublisherType(type).LowerCaseString().CStr(), static_cast<int32_t>(snapshot.connections[static_cast<int8_t>(type)]));
+		}
+		writer.EndObject();
+
+		writer.EndObject();
+	}
+
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics)
 	{
 		Json::Value value = JsonFromMetrics(metrics);
@@ -52,6 +83,36 @@ namespace serdes
 		SetTimeInterval(value, "requestTimeToOrigin", metrics->GetOriginConnectionTimeMSec());
 		SetTimeInterval(value, "responseTimeFromOrigin", metrics->GetOriginSubscribeTimeMSec());
 
+		// Latencies from the ingest in microseconds (only the stages that have been measured)
+		Json::Value latencies(Json::objectValue);
+
+		for (int index = 0; index < static_cast<int>(mon::LatencyStage::NumberOfStages); index++)
+		{
+			auto stage = static_cast<mon::LatencyStage>(index);
+			auto snapshot = metrics->GetLatencyHistogram(stage).GetSnapshot();
+
+			if (snapshot.count == 0)
+			{
+				continue;
+			}
+
+			Json::Value &latency = latencies[mon::StringFromLatencyStage(stage).CStr()];
+
+			SetInt64(latency, "count", snapshot.count);
+			SetInt64(latency, "min", snapshot.min_us);
+			SetInt64(latency, "max", snapshot.max_us);
+			SetInt64(latency, "mean", snapshot.mean_us);
+			SetInt64(latency, "p50", snapshot.p50_us);
+			SetInt64(latency, "p90", snapshot.p90_us);
+			SetInt64(latency, "p99", snapshot.p99_us);
+			SetInt64(latency, "p999", snapshot.p999_us);
+		}
+
+		if (latencies.empty() == false)
+		{
+			value["latencies"] = latencies;
+		}
+
 		return value;
 	}
 }  // namespace serdes
\ No newline at end of file
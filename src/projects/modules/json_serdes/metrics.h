@@ -14,4 +14,7 @@ namespace serdes
 {
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
+
+	// Writes the same object as JsonFromMetrics() without building Json::Value
+	void WriteMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::CommonMetrics> &metrics);
 }  // namespace serdes
\ No newline at end of file
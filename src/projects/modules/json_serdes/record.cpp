@@ -223,6 +223,16 @@ namespace serdes
 			if (record->GetSequence() > 0)
 				SetInt(response, "sequence", record->GetSequence());
 
+			if (record->GetMaxWriteBacklogBytes() > 0)
+			{
+				SetInt64(response, "writeBacklogBytes", record->GetWriteBacklogBytes());
+				SetInt64(response, "writeBacklogPackets", record->GetWriteBacklogPackets());
+				SetInt64(response, "maxWriteBacklogBytes", record->GetMaxWriteBacklogBytes());
+			}
+
+			if (record->GetWriteDroppedPackets() > 0)
+				SetInt64(response, "droppedPackets", record->GetWriteDroppedPackets());
+
 			if (record->GetRecordStartTime() != std::chrono::system_clock::from_time_t(0))
 			{
 				SetTimestamp(response, "startTime", record->GetRecordStartTime());
@@ -0,0 +1,784 @@
+//==============================================================================
+//
+//  MPEGTS Packetizer
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "mpegts_packetizer.h"
+
+#define OV_LOG_TAG "MpegTsPacketizer"
+
+namespace mpegts
+{
+	namespace
+	{
+		// CRC-32/MPEG-2 (polynomial: 0x04C11DB7, not reflected, initial value: 0xFFFFFFFF, no final XOR)
+		class Crc32Mpeg2
+		{
+		public:
+			Crc32Mpeg2()
+			{
+				for (uint32_t index = 0; index < 256; index++)
+				{
+					uint32_t crc = index << 24;
+
+					for (int bit = 0; bit < 8; bit++)
+					{
+						crc = (crc & 0x80000000) ? ((crc << 1) ^ 0x04C11DB7) : (crc << 1);
+					}
+
+					_table[index] = crc;
+				}
+			}
+
+			uint32_t Calculate(const uint8_t *data, size_t length) const
+			{
+				uint32_t crc = 0xFFFFFFFF;
+
+				for (size_t index = 0; index < length; index++)
+				{
+					crc = (crc << 8) ^ _table[((crc >> 24) ^ data[index]) & 0xFF];
+				}
+
+				return crc;
+			}
+
+		protected:
+			std::array<uint32_t, 256> _table;
+		};
+
+		uint32_t Crc32(const uint8_t *data, size_t length)
+		{
+			static const Crc32Mpeg2 crc32;
+
+			return crc32.Calculate(data, length);
+		}
+
+		// Unit: 90kHz (33 bits)
+		int64_t ToMpegTsTimestamp(int64_t timestamp, const cmn::Timebase &timebase)
+		{
+			int64_t result;
+
+			if ((timebase.GetNum() == 1) && (timebase.GetDen() == 90000))
+			{
+				result = timestamp;
+			}
+			else
+			{
+				// timestamp * num * 90000 overflows 64 bits with the fine-grained timebases (such as 1/1000000) after some hours
+				result = static_cast<int64_t>(static_cast<__int128>(timestamp) * timebase.GetNum() * 90000 / timebase.GetDen());
+			}
+
+			return (result + MPEGTS_TIMESTAMP_OFFSET) & 0x1FFFFFFFFLL;
+		}
+
+		uint8_t *WriteTimestamp(uint8_t *buffer, uint8_t prefix, int64_t timestamp)
+		{
+			// prefix(4) + TS[32..30](3) + marker(1) + TS[29..15](15) + marker(1) + TS[14..0](15) + marker(1)
+			*buffer++ = static_cast<uint8_t>((prefix << 4) | (((timestamp >> 30) & 0x07) << 1) | 0x01);
+			*buffer++ = static_cast<uint8_t>(timestamp >> 22);
+			*buffer++ = static_cast<uint8_t>((((timestamp >> 15) & 0x7F) << 1) | 0x01);
+			*buffer++ = static_cast<uint8_t>(timestamp >> 7);
+			*buffer++ = static_cast<uint8_t>(((timestamp & 0x7F) << 1) | 0x01);
+
+			return buffer;
+		}
+
+		// Returns (to - from) of the 33 bits timestamps considering the wrap around
+		int64_t GetTimestampDelta(int64_t from, int64_t to)
+		{
+			int64_t delta = (to - from) & 0x1FFFFFFFFLL;
+
+			return (delta >= 0x100000000LL) ? (delta - 0x200000000LL) : delta;
+		}
+
+		// Writes the PCR (6 bytes) derived from the DTS
+		uint8_t *WritePcr(uint8_t *buffer, int64_t dts)
+		{
+			int64_t pcr_base = (dts - MPEGTS_PCR_DELAY) & 0x1FFFFFFFFLL;
+
+			// program_clock_reference_base(33) + reserved(6) + program_clock_reference_extension(9, always 0)
+			*buffer++ = static_cast<uint8_t>(pcr_base >> 25);
+			*buffer++ = static_cast<uint8_t>(pcr_base >> 17);
+			*buffer++ = static_cast<uint8_t>(pcr_base >> 9);
+			*buffer++ = static_cast<uint8_t>(pcr_base >> 1);
+			*buffer++ = static_cast<uint8_t>(((pcr_base & 0x01) << 7) | 0x7E);
+			*buffer++ = 0x00;
+
+			return buffer;
+		}
+
+		// Makes a TS packet that contains the whole section (pointer_field + section + CRC + stuffing)
+		void MakeSectionPacket(uint16_t pid, const std::vector<uint8_t> &section, std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE> &packet)
+		{
+			packet.fill(0xFF);
+
+			packet[0] = MPEGTS_SYNC_BYTE;
+			// payload_unit_start_indicator(1)
+			packet[1] = static_cast<uint8_t>(0x40 | ((pid >> 8) & 0x1F));
+			packet[2] = static_cast<uint8_t>(pid & 0xFF);
+			// adaptation_field_control(01: payload only), continuity_counter is updated when the packet is written
+			packet[3] = 0x10;
+			// pointer_field
+			packet[4] = 0x00;
+
+			::memcpy(packet.data() + 5, section.data(), section.size());
+
+			auto crc = Crc32(section.data(), section.size());
+			auto crc_buffer = packet.data() + 5 + section.size();
+
+			crc_buffer[0] = static_cast<uint8_t>(crc >> 24);
+			crc_buffer[1] = static_cast<uint8_t>(crc >> 16);
+			crc_buffer[2] = static_cast<uint8_t>(crc >> 8);
+			crc_buffer[3] = static_cast<uint8_t>(crc);
+		}
+
+		// Sets the section_length (including CRC) of the section
+		void SetSectionLength(std::vector<uint8_t> &section)
+		{
+			auto section_length = section.size() - MPEGTS_TABLE_HEADER_SIZE + 4;
+
+			section[1] = static_cast<uint8_t>((section[1] & 0xF0) | ((section_length >> 8) & 0x0F));
+			section[2] = static_cast<uint8_t>(section_length & 0xFF);
+		}
+
+		// Returns true if the Annex-B bitstream starts with an access unit delimiter
+		bool HasAccessUnitDelimiter(cmn::MediaCodecId codec_id, const uint8_t *data, size_t length)
+		{
+			size_t offset;
+
+			if ((length >= 4) && (data[0] == 0x00) && (data[1] == 0x00) && (data[2] == 0x01))
+			{
+				offset = 3;
+			}
+			else if ((length >= 5) && (data[0] == 0x00) && (data[1] == 0x00) && (data[2] == 0x00) && (data[3] == 0x01))
+			{
+				offset = 4;
+			}
+			else
+			{
+				return false;
+			}
+
+			switch (codec_id)
+			{
+				case cmn::MediaCodecId::H264:
+					return (data[offset] & 0x1F) == 9;
+
+				case cmn::MediaCodecId::H265:
+					return ((data[offset] >> 1) & 0x3F) == 35;
+
+				default:
+					return false;
+			}
+		}
+	}  // namespace
+
+	bool MpegTsPacketizer::AddTrack(const std::shared_ptr<const MediaTrack> &media_track)
+	{
+		if (media_track == nullptr)
+		{
+			return false;
+		}
+
+		return AddTrack(media_track->GetId(), media_track->GetMediaType(), media_track->GetCodecId(), media_track->GetTimeBase());
+	}
+
+	bool MpegTsPacketizer::AddTrack(int32_t track_id, cmn::MediaType media_type, cmn::MediaCodecId codec_id, const cmn::Timebase &timebase)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		if ((timebase.GetNum() <= 0) || (timebase.GetDen() <= 0))
+		{
+			logte("Invalid timebase: %s", timebase.ToString().CStr());
+			return false;
+		}
+
+		auto track = std::make_shared<Track>();
+
+		switch (codec_id)
+		{
+			case cmn::MediaCodecId::H264:
+				track->stream_type = static_cast<uint8_t>(WellKnownStreamTypes::H264);
+				break;
+
+			case cmn::MediaCodecId::H265:
+				track->stream_type = static_cast<uint8_t>(WellKnownStreamTypes::H265);
+				break;
+
+			case cmn::MediaCodecId::Aac:
+				track->stream_type = static_cast<uint8_t>(WellKnownStreamTypes::AAC);
+				break;
+
+			case cmn::MediaCodecId::Mp3:
+				track->stream_type = static_cast<uint8_t>(WellKnownStreamTypes::MP3);
+				break;
+
+			default:
+				logte("Not supported codec: %s", ::StringFromMediaCodecId(codec_id).CStr());
+				return false;
+		}
+
+		size_t video_count = 0;
+		size_t audio_count = 0;
+
+		for (const auto &item : _track_list)
+		{
+			(item->media_type == cmn::MediaType::Video) ? video_count++ : audio_count++;
+		}
+
+		track->track_id = track_id;
+		track->media_type = media_type;
+		track->codec_id = codec_id;
+		track->timebase = timebase;
+		track->pid = static_cast<uint16_t>(MPEGTS_FIRST_ES_PID + _track_list.size());
+		track->stream_id = static_cast<uint8_t>((media_type == cmn::MediaType::Video) ? (MPEGTS_VIDEO_STREAM_ID + video_count) : (MPEGTS_AUDIO_STREAM_ID + audio_count));
+
+		_track_list.push_back(track);
+		_track_map[track_id] = track;
+
+		// The PCR is carried by the first video track (or the first track if there is no video)
+		if ((_pcr_pid == 0x1FFF) || ((media_type == cmn::MediaType::Video) && (video_count == 0)))
+		{
+			_pcr_pid = track->pid;
+			_pcr_track = track;
+		}
+
+		_tables_updated = false;
+
+		return true;
+	}
+
+	void MpegTsPacketizer::SetTablePeriod(int64_t period_ms)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		_table_period = period_ms * 90;
+	}
+
+	void MpegTsPacketizer::MakeTables(const ov::String &service_name)
+	{
+		std::vector<uint8_t> section;
+		Table table;
+
+		// Keep the continuity counters of the previous tables
+		std::map<uint16_t, uint8_t> continuity_counters;
+		for (const auto &item : _tables)
+		{
+			continuity_counters[item.pid] = item.continuity_counter;
+		}
+
+		_tables.clear();
+
+		// PAT
+		section = {
+			static_cast<uint8_t>(WellKnownTableId::PROGRAM_ASSOCIATION_SECTION),
+			// section_syntax_indicator(1) + '0'(1) + reserved(2) + section_length(12, filled later)
+			0xB0, 0x00,
+			// transport_stream_id(16)
+			(MPEGTS_TRANSPORT_STREAM_ID >> 8) & 0xFF, MPEGTS_TRANSPORT_STREAM_ID & 0xFF,
+			// reserved(2) + version_number(5) + current_next_indicator(1)
+			0xC1,
+			// section_number, last_section_number
+			0x00, 0x00,
+			// program_number(16)
+			(MPEGTS_PROGRAM_NUMBER >> 8) & 0xFF, MPEGTS_PROGRAM_NUMBER & 0xFF,
+			// reserved(3) + program_map_PID(13)
+			0xE0 | ((MPEGTS_PMT_PID >> 8) & 0x1F), MPEGTS_PMT_PID & 0xFF};
+		SetSectionLength(section);
+
+		table.pid = static_cast<uint16_t>(WellKnownPacketId::PAT);
+		MakeSectionPacket(table.pid, section, table.packet);
+		_tables.push_back(table);
+
+		// PMT
+		section = {
+			static_cast<uint8_t>(WellKnownTableId::PROGRAM_MAP_SECTION),
+			0xB0, 0x00,
+			(MPEGTS_PROGRAM_NUMBER >> 8) & 0xFF, MPEGTS_PROGRAM_NUMBER & 0xFF,
+			0xC1,
+			0x00, 0x00,
+			// reserved(3) + PCR_PID(13)
+			static_cast<uint8_t>(0xE0 | ((_pcr_pid >> 8) & 0x1F)), static_cast<uint8_t>(_pcr_pid & 0xFF),
+			// reserved(4) + program_info_length(12)
+			0xF0, 0x00};
+
+		for (const auto &track : _track_list)
+		{
+			section.push_back(track->stream_type);
+			// reserved(3) + elementary_PID(13)
+			section.push_back(static_cast<uint8_t>(0xE0 | ((track->pid >> 8) & 0x1F)));
+			section.push_back(static_cast<uint8_t>(track->pid & 0xFF));
+			// reserved(4) + ES_info_length(12)
+			section.push_back(0xF0);
+			section.push_back(0x00);
+		}
+		SetSectionLength(section);
+
+		table.pid = MPEGTS_PMT_PID;
+		MakeSectionPacket(table.pid, section, table.packet);
+		_tables.push_back(table);
+
+		// SDT
+		ov::String provider_name = "OvenMediaEngine";
+		// The service name must fit in the TS packet with the other fields
+		auto name = service_name.Left(64);
+
+		section = {
+			// table_id (service_description_section - actual_transport_stream)
+			0x42,
+			// section_syntax_indicator(1) + reserved_future_use(1) + reserved(2) + section_length(12)
+			0xF0, 0x00,
+			(MPEGTS_TRANSPORT_STREAM_ID >> 8) & 0xFF, MPEGTS_TRANSPORT_STREAM_ID & 0xFF,
+			0xC1,
+			0x00, 0x00,
+			// original_network_id(16)
+			(MPEGTS_ORIGINAL_NETWORK_ID >> 8) & 0xFF, MPEGTS_ORIGINAL_NETWORK_ID & 0xFF,
+			// reserved_future_use
+			0xFF,
+			// service_id(16)
+			(MPEGTS_PROGRAM_NUMBER >> 8) & 0xFF, MPEGTS_PROGRAM_NUMBER & 0xFF,
+			// reserved_future_use(6) + EIT_schedule_flag(1) + EIT_present_following_flag(1)
+			0xFC};
+
+		// service_descriptor: descriptor_tag, descriptor_length, service_type (digital television service), provider, name
+		auto descriptor_length = 3 + provider_name.GetLength() + name.GetLength();
+		// running_status(3: running) + free_CA_mode(1) + descriptors_loop_length(12)
+		section.push_back(static_cast<uint8_t>(0x80 | (((descriptor_length + 2) >> 8) & 0x0F)));
+		section.push_back(static_cast<uint8_t>((descriptor_length + 2) & 0xFF));
+		section.push_back(0x48);
+		section.push_back(static_cast<uint8_t>(descriptor_length));
+		section.push_back(0x01);
+		section.push_back(static_cast<uint8_t>(provider_name.GetLength()));
+		section.insert(section.end(), provider_name.CStr(), provider_name.CStr() + provider_name.GetLength());
+		section.push_back(static_cast<uint8_t>(name.GetLength()));
+		section.insert(section.end(), name.CStr(), name.CStr() + name.GetLength());
+		SetSectionLength(section);
+
+		table.pid = static_cast<uint16_t>(WellKnownPacketId::SDT);
+		MakeSectionPacket(table.pid, section, table.packet);
+		_tables.push_back(table);
+
+		for (auto &item : _tables)
+		{
+			auto continuity_counter = continuity_counters.find(item.pid);
+
+			if (continuity_counter != continuity_counters.end())
+			{
+				item.continuity_counter = continuity_counter->second;
+			}
+		}
+
+		_service_name = service_name;
+		_tables_updated = true;
+	}
+
+	void MpegTsPacketizer::WriteTables()
+	{
+		for (auto &table : _tables)
+		{
+			table.packet[3] = static_cast<uint8_t>((table.packet[3] & 0xF0) | table.continuity_counter);
+			table.continuity_counter = (table.continuity_counter + 1) & 0x0F;
+
+			AppendPacket(table.packet);
+		}
+	}
+
+	void MpegTsPacketizer::AppendPacket(const TsPacket &packet)
+	{
+		_data->Append(packet.data(), packet.size());
+	}
+
+	bool MpegTsPacketizer::Prepare(const ov::String &service_name)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		if (_track_list.empty())
+		{
+			logte("There is no track to packetize");
+			return false;
+		}
+
+		if ((_tables_updated == false) || (_service_name != service_name))
+		{
+			MakeTables(service_name);
+		}
+
+		for (auto &track : _track_list)
+		{
+			track->first_pts = -1LL;
+			track->duration = 0LL;
+		}
+
+		_data = std::make_shared<ov::Data>(_buffer_size);
+
+		WriteTables();
+		_last_table_dts = -1LL;
+		_last_pcr_dts = -1LL;
+
+		return true;
+	}
+
+	bool MpegTsPacketizer::PrepareIfNeeded(const ov::String &service_name)
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			if (_data != nullptr)
+			{
+				return true;
+			}
+		}
+
+		return Prepare(service_name);
+	}
+
+	std::shared_ptr<const ov::Data> MpegTsPacketizer::GetData() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		return _data;
+	}
+
+	int64_t MpegTsPacketizer::GetFirstPts(uint32_t track_id) const
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto track_item = _track_map.find(track_id);
+
+		if ((track_item != _track_map.end()) && (track_item->second->first_pts >= 0LL))
+		{
+			return track_item->second->first_pts;
+		}
+
+		return 0LL;
+	}
+
+	int64_t MpegTsPacketizer::GetFirstPts(cmn::MediaType type) const
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		for (const auto &track : _track_list)
+		{
+			if (track->media_type == type)
+			{
+				return std::max(track->first_pts, static_cast<int64_t>(0));
+			}
+		}
+
+		return 0LL;
+	}
+
+	int64_t MpegTsPacketizer::GetDuration(uint32_t track_id) const
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto track_item = _track_map.find(track_id);
+
+		if (track_item != _track_map.end())
+		{
+			return track_item->second->duration;
+		}
+
+		return 0LL;
+	}
+
+	bool MpegTsPacketizer::WritePacket(const std::shared_ptr<const MediaPacket> &packet)
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		if (_data == nullptr)
+		{
+			logte("Packetizer is not prepared");
+			return false;
+		}
+
+		auto track_item = _track_map.find(packet->GetTrackId());
+
+		if (track_item == _track_map.end())
+		{
+			logte("Could not find the track: %d (%zu)", packet->GetTrackId(), _track_map.size());
+			return false;
+		}
+
+		auto &track = *(track_item->second);
+
+		switch (packet->GetBitstreamFormat())
+		{
+			case cmn::BitstreamFormat::H264_ANNEXB:
+				[[fallthrough]];
+			case cmn::BitstreamFormat::H265_ANNEXB:
+				[[fallthrough]];
+			case cmn::BitstreamFormat::AAC_ADTS:
+				break;
+
+			default:
+				// MP3 has no specific bitstream format
+				if (track.codec_id == cmn::MediaCodecId::Mp3)
+				{
+					break;
+				}
+
+				logte("Not supported bitstream format: %s", cmn::GetBitstreamFormatString(packet->GetBitstreamFormat()).CStr());
+				return false;
+		}
+
+		auto data = packet->GetData();
+		auto pts = packet->GetPts();
+		auto dts = (packet->GetDts() >= 0LL) ? packet->GetDts() : pts;
+
+		auto ts_pts = ToMpegTsTimestamp(pts, track.timebase);
+		auto ts_dts = ToMpegTsTimestamp(dts, track.timebase);
+
+		if (_table_period > 0LL)
+		{
+			if (_last_table_dts < 0LL)
+			{
+				// The tables were written by Prepare()
+				_last_table_dts = ts_dts;
+			}
+			else if ((ts_dts - _last_table_dts) >= _table_period)
+			{
+				WriteTables();
+				_last_table_dts = ts_dts;
+			}
+		}
+
+		// Keep the PCR interval even if the PCR track is sparse
+		if ((track.pid != _pcr_pid) &&
+			((_last_pcr_dts < 0LL) || (GetTimestampDelta(_last_pcr_dts, ts_dts) >= MPEGTS_PCR_PERIOD)))
+		{
+			WritePcrPacket(ts_dts);
+		}
+
+		if (WritePes(track, data->GetDataAs<uint8_t>(), data->GetLength(), ts_pts, ts_dts, packet->GetFlag() == MediaPacketFlag::Key) == false)
+		{
+			return false;
+		}
+
+		if (track.first_pts < 0LL)
+		{
+			track.first_pts = pts;
+		}
+
+		if (packet->GetDuration() > 0LL)
+		{
+			track.duration += packet->GetDuration();
+		}
+
+		return true;
+	}
+
+	bool MpegTsPacketizer::WritePes(Track &track, const uint8_t *data, size_t length, int64_t pts, int64_t dts, bool is_key_frame)
+	{
+		// PES header (up to 19 bytes) + access unit delimiter (up to 7 bytes)
+		uint8_t header[32];
+		auto buffer = header;
+		bool has_dts = (pts != dts);
+
+		*buffer++ = 0x00;
+		*buffer++ = 0x00;
+		*buffer++ = 0x01;
+		*buffer++ = track.stream_id;
+		// PES_packet_length is filled later
+		auto pes_packet_length = buffer;
+		buffer += 2;
+		// '10' + PES_scrambling_control(2) + PES_priority(1) + data_alignment_indicator(1) + copyright(1) + original_or_copy(1)
+		*buffer++ = (track.media_type == cmn::MediaType::Video) ? 0x84 : 0x80;
+		// PTS_DTS_flags(2) + ESCR_flag(1) + ES_rate_flag(1) + DSM_trick_mode_flag(1) + additional_copy_info_flag(1) + PES_CRC_flag(1) + PES_extension_flag(1)
+		*buffer++ = has_dts ? 0xC0 : 0x80;
+		// PES_header_data_length
+		*buffer++ = has_dts ? 10 : 5;
+
+		buffer = WriteTimestamp(buffer, has_dts ? 0x03 : 0x02, pts);
+
+		if (has_dts)
+		{
+			buffer = WriteTimestamp(buffer, 0x01, dts);
+		}
+
+		// Some players (such as Safari) need an access unit delimiter at the beginning of each access unit
+		if (HasAccessUnitDelimiter(track.codec_id, data, length) == false)
+		{
+			if (track.codec_id == cmn::MediaCodecId::H264)
+			{
+				static const uint8_t aud[] = {0x00, 0x00, 0x00, 0x01, 0x09, 0xF0};
+				::memcpy(buffer, aud, sizeof(aud));
+				buffer += sizeof(aud);
+			}
+			else if (track.codec_id == cmn::MediaCodecId::H265)
+			{
+				static const uint8_t aud[] = {0x00, 0x00, 0x00, 0x01, 0x46, 0x01, 0x50};
+				::memcpy(buffer, aud, sizeof(aud));
+				buffer += sizeof(aud);
+			}
+		}
+
+		size_t header_length = buffer - header;
+		size_t total_length = header_length + length;
+		// The length of the data that follows PES_packet_length
+		size_t packet_length = total_length - 6;
+
+		// 0 means unbounded (allowed only for the video)
+		if ((track.media_type == cmn::MediaType::Video) || (packet_length > 0xFFFF))
+		{
+			packet_length = 0;
+		}
+
+		pes_packet_length[0] = static_cast<uint8_t>(packet_length >> 8);
+		pes_packet_length[1] = static_cast<uint8_t>(packet_length & 0xFF);
+
+		bool is_first = true;
+		size_t offset = 0;
+		TsPacket packet;
+
+		while (offset < total_length)
+		{
+			auto ts = packet.data();
+
+			ts[0] = MPEGTS_SYNC_BYTE;
+			ts[1] = static_cast<uint8_t>((is_first ? 0x40 : 0x00) | ((track.pid >> 8) & 0x1F));
+			ts[2] = static_cast<uint8_t>(track.pid & 0xFF);
+
+			// Adaptation field
+			// The PCR must not go back from the one of the PCR-only packet derived from the other track
+			bool write_pcr = is_first && (track.pid == _pcr_pid) &&
+							 ((_last_pcr_dts < 0LL) || (GetTimestampDelta(_last_pcr_dts, dts) >= 0LL));
+			bool random_access = is_first && is_key_frame;
+			size_t adaptation_field_length = 0;
+
+			if (write_pcr || random_access)
+			{
+				// adaptation_field_length + flags
+				adaptation_field_length = 2;
+				ts[5] = (random_access ? 0x40 : 0x00) | (write_pcr ? 0x10 : 0x00);
+
+				if (write_pcr)
+				{
+					WritePcr(ts + 6, dts);
+					adaptation_field_length += 6;
+					_last_pcr_dts = dts;
+				}
+			}
+
+			size_t remained = total_length - offset;
+			size_t capacity = MPEGTS_MIN_PACKET_SIZE - 4 - adaptation_field_length;
+
+			if (remained < capacity)
+			{
+				// Fill the rest with stuffing bytes of the adaptation field
+				size_t stuffing_length = capacity - remained;
+
+				if (adaptation_field_length == 0)
+				{
+					if (stuffing_length == 1)
+					{
+						// Only the adaptation_field_length (0)
+						adaptation_field_length = 1;
+						stuffing_length = 0;
+					}
+					else
+					{
+						adaptation_field_length = 2;
+						ts[5] = 0x00;
+						stuffing_length -= 2;
+					}
+				}
+
+				::memset(ts + 4 + adaptation_field_length, 0xFF, stuffing_length);
+				adaptation_field_length += stuffing_length;
+				capacity = remained;
+			}
+
+			if (adaptation_field_length > 0)
+			{
+				ts[4] = static_cast<uint8_t>(adaptation_field_length - 1);
+			}
+
+			// adaptation_field_control (11: adaptation field + payload, 01: payload only) + continuity_counter
+			ts[3] = static_cast<uint8_t>(((adaptation_field_length > 0) ? 0x30 : 0x10) | track.continuity_counter);
+			track.continuity_counter = (track.continuity_counter + 1) & 0x0F;
+
+			auto payload = ts + 4 + adaptation_field_length;
+			size_t copied = 0;
+
+			if (offset < header_length)
+			{
+				copied = std::min(header_length - offset, capacity);
+				::memcpy(payload, header + offset, copied);
+			}
+
+			if (copied < capacity)
+			{
+				::memcpy(payload + copied, data + (offset + copied - header_length), capacity - copied);
+			}
+
+			AppendPacket(packet);
+
+			offset += capacity;
+			is_first = false;
+		}
+
+		return true;
+	}
+
+	void MpegTsPacketizer::WritePcrPacket(int64_t dts)
+	{
+		if (_pcr_track == nullptr)
+		{
+			return;
+		}
+
+		TsPacket packet;
+		auto ts = packet.data();
+
+		packet.fill(0xFF);
+
+		ts[0] = MPEGTS_SYNC_BYTE;
+		ts[1] = static_cast<uint8_t>((_pcr_pid >> 8) & 0x1F);
+		ts[2] = static_cast<uint8_t>(_pcr_pid & 0xFF);
+		// adaptation_field_control (10: adaptation field only)
+		// The continuity_counter is not incremented because the packet has no payload
+		ts[3] = static_cast<uint8_t>(0x20 | ((_pcr_track->continuity_counter - 1) & 0x0F));
+		// adaptation_field_length (the rest of the packet) + flags (PCR_flag)
+		ts[4] = MPEGTS_MIN_PACKET_SIZE - 5;
+		ts[5] = 0x10;
+		WritePcr(ts + 6, dts);
+
+		AppendPacket(packet);
+
+		_last_pcr_dts = dts;
+	}
+
+	std::shared_ptr<const ov::Data> MpegTsPacketizer::PopData()
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto data = _data;
+
+		if (data != nullptr)
+		{
+			_data = std::make_shared<ov::Data>(std::max(data->GetLength(), static_cast<size_t>(MPEGTS_MIN_PACKET_SIZE)));
+		}
+
+		return data;
+	}
+
+	std::shared_ptr<const ov::Data> MpegTsPacketizer::Finalize()
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		auto data = _data;
+		_data = nullptr;
+
+		if (data != nullptr)
+		{
+			// Leave some room for the next segment
+			_buffer_size = std::max(data->GetLength() + (data->GetLength() / 4), static_cast<size_t>(MPEGTS_MIN_PACKET_SIZE));
+		}
+
+		return data;
+	}
+}  // namespace mpegts
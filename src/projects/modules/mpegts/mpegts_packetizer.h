@@ -0,0 +1,152 @@
+//==============================================================================
+//
+//  MPEGTS Packetizer
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <array>
+
+#include "mpegts_packet.h"
+#include "mpegts_pes.h"
+#include "mpegts_section.h"
+
+#define MPEGTS_PROGRAM_NUMBER 0x0001
+#define MPEGTS_TRANSPORT_STREAM_ID 0x0001
+#define MPEGTS_ORIGINAL_NETWORK_ID 0xFF01
+#define MPEGTS_PMT_PID 0x1000
+// PID of the first elementary stream (the others use the next PIDs in the order of AddTrack())
+#define MPEGTS_FIRST_ES_PID 0x0100
+
+#define MPEGTS_VIDEO_STREAM_ID 0xE0
+#define MPEGTS_AUDIO_STREAM_ID 0xC0
+
+// Unit: 90kHz
+// Same as the default of libavformat (max_delay: 0.7s), so the timestamps are the same as the segments muxed by libavformat
+#define MPEGTS_PCR_DELAY (63000)
+#define MPEGTS_TIMESTAMP_OFFSET (MPEGTS_PCR_DELAY * 2)
+// Unit: 90kHz
+// ISO/IEC 13818-1 allows at most 100ms between two PCRs of a program
+#define MPEGTS_PCR_PERIOD (90 * 40)
+
+#define MPEGTS_PACKETIZER_DEFAULT_BUFFER_SIZE (1024 * 1024)
+
+/*  PES Packetization Process
+
+	(ES 1) => [PES Header | Access unit delimiter (H.264/H.265 only) | ES 1                                       ]
+	Packet 1: [TS Header][Adaptation field: PCR, RAI][PES Header |    Payload     ] : payload_unit_start_indicator = 1
+	Packet 2: [TS Header][                    Payload                           ]
+	Packet 3: [TS Header][Adaptation field : stuffing][          Payload        ]
+
+	When the PCR track has not started a PES for MPEGTS_PCR_PERIOD (e.g. a sparse video track),
+	a PCR-only packet (adaptation field only) is written on the PCR PID before the PES of the other track.
+*/
+
+namespace mpegts
+{
+	// Muxes the media packets to MPEG-TS without libavformat.
+	// PAT/PMT/SDT are made only when the tracks are changed, so only the continuity counter is updated when they are written.
+	//
+	// MpegTsPacket, Pes and Section are parsers for the depacketizer (they are filled by AppendData()/Parse() and only
+	// have getters), so the packetizer writes the TS packets, PES headers and sections itself.
+	class MpegTsPacketizer
+	{
+	public:
+		bool AddTrack(const std::shared_ptr<const MediaTrack> &media_track);
+		bool AddTrack(int32_t track_id, cmn::MediaType media_type, cmn::MediaCodecId codec_id, const cmn::Timebase &timebase);
+
+		// Writes PAT/PMT/SDT periodically (0: Only at the beginning of the data)
+		// Unit: millisecond
+		void SetTablePeriod(int64_t period_ms);
+
+		// Starts a new data (segment) that begins with PAT/PMT/SDT
+		bool Prepare(const ov::String &service_name = "");
+		bool PrepareIfNeeded(const ov::String &service_name = "");
+
+		std::shared_ptr<const ov::Data> GetData() const;
+
+		// Get the packet pts of the track
+		// Unit: the timebase of the track
+		int64_t GetFirstPts(uint32_t track_id) const;
+		// Get the packet pts by MediaType
+		// Unit: the timebase of the track
+		int64_t GetFirstPts(cmn::MediaType type) const;
+
+		// Get the duration of the track
+		// Unit: the timebase of the track
+		int64_t GetDuration(uint32_t track_id) const;
+
+		bool WritePacket(const std::shared_ptr<const MediaPacket> &packet);
+
+		// Returns the data written since the last call and continues writing to a new buffer (without PAT/PMT/SDT)
+		std::shared_ptr<const ov::Data> PopData();
+
+		// Returns the data written since Prepare()
+		std::shared_ptr<const ov::Data> Finalize();
+
+	protected:
+		using TsPacket = std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE>;
+
+		struct Track
+		{
+			int32_t track_id = -1;
+			cmn::MediaType media_type = cmn::MediaType::Unknown;
+			cmn::MediaCodecId codec_id = cmn::MediaCodecId::None;
+			cmn::Timebase timebase;
+
+			uint16_t pid = 0;
+			uint8_t stream_id = 0;
+			uint8_t stream_type = 0;
+			uint8_t continuity_counter = 0;
+
+			// Unit: the timebase of the track
+			int64_t first_pts = -1LL;
+			int64_t duration = 0LL;
+		};
+
+		struct Table
+		{
+			uint16_t pid;
+			TsPacket packet;
+			uint8_t continuity_counter = 0;
+		};
+
+		// _mutex must be locked
+		void MakeTables(const ov::String &service_name);
+		void WriteTables();
+		bool WritePes(Track &track, const uint8_t *data, size_t length, int64_t pts, int64_t dts, bool is_key_frame);
+		// Writes a packet of the PCR PID that has only the adaptation field with the PCR
+		void WritePcrPacket(int64_t dts);
+		void AppendPacket(const TsPacket &packet);
+
+		mutable std::mutex _mutex;
+
+		std::vector<std::shared_ptr<Track>> _track_list;
+		// Key: MediaPacket.GetTrackId()
+		std::map<int32_t, std::shared_ptr<Track>> _track_map;
+		uint16_t _pcr_pid = 0x1FFF;
+		std::shared_ptr<Track> _pcr_track;
+		// The DTS that the last PCR was derived from (Unit: 90kHz)
+		int64_t _last_pcr_dts = -1LL;
+
+		ov::String _service_name;
+		bool _tables_updated = false;
+		std::vector<Table> _tables;
+
+		// Unit: 90kHz
+		int64_t _table_period = 0LL;
+		int64_t _last_table_dts = -1LL;
+
+		std::shared_ptr<ov::Data> _data;
+		// The size of the previous data is used to reserve the buffer
+		size_t _buffer_size = MPEGTS_PACKETIZER_DEFAULT_BUFFER_SIZE;
+	};
+}  // namespace mpegts
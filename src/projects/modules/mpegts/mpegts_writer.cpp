@@ -87,6 +87,8 @@ bool MpegtsWriter::SetPath(const ov::String path, const ov::String format)
 		_format_context = nullptr;
 	}
 
+	_packetizer = nullptr;
+
 	const AVOutputFormat *output_format = nullptr;
 
 	// If the format is nullptr, it is automatically set based on the extension.
@@ -111,6 +113,11 @@ bool MpegtsWriter::SetPath(const ov::String path, const ov::String format)
 		return false;
 	}
 
+	if (::strcmp(_format_context->oformat->name, "mpegts") == 0)
+	{
+		_packetizer = std::make_shared<mpegts::MpegTsPacketizer>();
+	}
+
 	return true;
 }
 
@@ -141,6 +148,20 @@ bool MpegtsWriter::Start()
 		}
 	}
 
+	if (_packetizer != nullptr)
+	{
+		// Write PAT/PMT/SDT every 100ms like the muxer of libavformat for the live streaming
+		_packetizer->SetTablePeriod(100);
+
+		if (_packetizer->Prepare() == false)
+		{
+			logte("Could not prepare the MPEG-TS packetizer");
+			return false;
+		}
+
+		return true;
+	}
+
 	if (avformat_write_header(_format_context, nullptr) < 0)
 	{
 		logte("Could not create header");
@@ -187,6 +208,19 @@ bool MpegtsWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::sh
 
 	AVStream *stream = nullptr;
 
+	if (_packetizer != nullptr)
+	{
+		if (_packetizer->AddTrack(track_id, media_type, track_info->GetCodecId(), track_info->GetTimeBase()) == false)
+		{
+			return false;
+		}
+
+		_track_map[track_id] = static_cast<int64_t>(_track_map.size());
+		_trackinfo_map[track_id] = track_info;
+
+		return true;
+	}
+
 	//Stream #0:0(und): Video: h264 (Constrained Baseline) ([7][0][0][0] / 0x0007), yuv420p, 640x360 [SAR 1:1 DAR 16:9], q=2-31, 683 kb/s, 24 fps, 24 tbr, 1k tbn, 90k tbc (default)
 	//Stream #0:0:     Video: h264, 1 reference frame ([7][0][0][0] / 0x0007), yuv420p, 1920x1080 (0x0) [SAR 1:1 DAR 16:9], 0/1, q=2-31, 2500 kb/s
 	// 	[12-02 17:03:03.131] I 25357 FFmpeg | third_parties.cpp:118  |     Stream #0:0
@@ -276,8 +310,15 @@ bool MpegtsWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::sh
 //	- H264 : AnnexB bitstream
 // 	- AAC : ASC(Audio Specific Config) bitstream
 
-bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data)
+bool MpegtsWriter::PutData(const std::shared_ptr<const MediaPacket> &packet)
 {
+	auto track_id = packet->GetTrackId();
+	auto pts = packet->GetPts();
+	auto dts = packet->GetDts();
+	auto flag = packet->GetFlag();
+	auto format = packet->GetBitstreamFormat();
+	auto data = packet->GetData();
+
 	std::unique_lock<std::mutex> mlock(_lock);
 
 	if (_format_context == nullptr)
@@ -294,6 +335,33 @@ bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPack
 	}
 	stream_index = iter->second;
 
+	if (_packetizer != nullptr)
+	{
+		if (_packetizer->WritePacket(packet) == false)
+		{
+			return false;
+		}
+
+		auto ts_data = _packetizer->PopData();
+
+		if ((ts_data != nullptr) && (ts_data->GetLength() > 0))
+		{
+			avio_write(_format_context->pb, ts_data->GetDataAs<uint8_t>(), static_cast<int>(ts_data->GetLength()));
+			avio_flush(_format_context->pb);
+
+			if (_format_context->pb->error < 0)
+			{
+				char errbuf[256];
+				av_strerror(_format_context->pb->error, errbuf, sizeof(errbuf));
+
+				logte("Send packet error(%d:%s)", _format_context->pb->error, errbuf);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	AVStream *stream = _format_context->streams[stream_index];
 	if (stream == nullptr)
 	{
@@ -325,7 +393,7 @@ bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPack
 			break;
 
 		case cmn::BitstreamFormat::H264_ANNEXB:
-			cdata = H264Converter::ConvertAnnexbToAvcc(cdata);
+			cdata = H264Converter::GetAvccData(packet);
 			av_packet.size = cdata->GetLength();
 			av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 			break;
@@ -336,7 +404,7 @@ bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPack
 			break;
 
 		case cmn::BitstreamFormat::AAC_ADTS:
-			cdata = AacConverter::ConvertAdtsToRaw(cdata, &length_list);
+			cdata = AacConverter::GetRawData(packet, &length_list);
 			av_packet.size = cdata->GetLength();
 			av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 			break;
@@ -356,7 +424,7 @@ bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPack
 			break;
 
 		case cmn::BitstreamFormat::AAC_ADTS:
-			cdata = AacConverter::ConvertAdtsToRaw(cdata, &length_list);
+			cdata = AacConverter::GetRawData(packet, &length_list);
 			av_packet.size = cdata->GetLength();
 			av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 			break;
@@ -3,6 +3,8 @@
 #include <base/mediarouter/media_buffer.h>
 #include <base/ovlibrary/ovlibrary.h>
 
+#include "mpegts_packetizer.h"
+
 extern "C"
 {
 #include <libavcodec/avcodec.h>
@@ -128,7 +130,7 @@ public:
 
 	bool AddTrack(cmn::MediaType media_type, int32_t track_id, std::shared_ptr<MpegtsTrackInfo> trackinfo);
 
-	bool PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data>& data);
+	bool PutData(const std::shared_ptr<const MediaPacket> &packet);
 
 	static void FFmpegLog(void* ptr, int level, const char* fmt, va_list vl);
 
@@ -138,6 +140,9 @@ private:
 
 	AVFormatContext* _format_context;
 
+	// Used instead of the muxer of libavformat if the format is mpegts (libavformat is used only for the output I/O)
+	std::shared_ptr<mpegts::MpegTsPacketizer> _packetizer;
+
 	// <MediaTrack.id, std::hsared_ptr<MpegtsTrackInfo>>
 	std::map<int32_t, std::shared_ptr<MpegtsTrackInfo>> _trackinfo_map;
 
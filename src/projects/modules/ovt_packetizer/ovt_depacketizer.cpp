@@ -29,6 +29,13 @@ bool OvtDepacketizer::AppendPacket(const std::shared_ptr<const ov::Data> &packet
 	return ParsePacket();
 }
 
+void OvtDepacketizer::Reset()
+{
+	_packet_buffer->Clear();
+	_message_buffer.Clear();
+	_media_packet_buffer.Clear();
+}
+
 bool OvtDepacketizer::ParsePacket()
 {
 	while(_packet_buffer->GetLength() >= OVT_FIXED_HEADER_SIZE)
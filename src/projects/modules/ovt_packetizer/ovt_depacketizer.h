@@ -18,6 +18,8 @@ public:
 
 	bool AppendPacket(const void *data, size_t length);
 	bool AppendPacket(const std::shared_ptr<const ov::Data> &packet);
+	// Discards the partially received message/media packet
+	void Reset();
 
 	bool IsAvailableMessage();
 	bool IsAvaliableMediaPacket();
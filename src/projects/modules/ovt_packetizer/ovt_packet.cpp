@@ -19,6 +19,24 @@ OvtPacket::OvtPacket()
 	_buffer[0] = OVT_VERSION << 6;
 }
 
+OvtPacket::OvtPacket(size_t payload_capacity)
+{
+	_version = OVT_VERSION;
+	_marker = 0;
+	_payload_type = 0;
+	_timestamp = 0;
+	_sequence_number = 0;
+	_session_id = 0;
+	_payload_length = 0;
+
+	_data = std::make_shared<ov::Data>();
+	_data->Reserve(OVT_FIXED_HEADER_SIZE + payload_capacity);
+	_data->SetLength(OVT_FIXED_HEADER_SIZE);
+	_buffer = _data->GetWritableDataAs<uint8_t>();
+
+	_buffer[0] = OVT_VERSION << 6;
+}
+
 OvtPacket::OvtPacket(const ov::Data &data)
 {
 	Load(data);
@@ -180,6 +198,22 @@ const std::shared_ptr<ov::Data>& OvtPacket::GetData() const
 	return _data;
 }
 
+std::shared_ptr<ov::Data> OvtPacket::MakeHeader(uint32_t session_id) const
+{
+	auto header = std::make_shared<ov::Data>(_buffer, OVT_FIXED_HEADER_SIZE);
+	ByteWriter<uint32_t>::WriteBigEndian(header->GetWritableDataAs<uint8_t>() + 12, session_id);
+
+	return header;
+}
+
+std::shared_ptr<const ov::Data> OvtPacket::GetPayloadData() const
+{
+	std::shared_ptr<const ov::Data> data = _data;
+
+	// Subdata() doesn't copy the buffer (copy-on-write)
+	return data->Subdata(OVT_FIXED_HEADER_SIZE, _payload_length);
+}
+
 void OvtPacket::SetMarker(bool marker_bit)
 {
 	_marker = marker_bit;
@@ -233,6 +267,28 @@ void OvtPacket::SetPayloadLength(size_t payload_length)
 	_data->SetLength(OVT_FIXED_HEADER_SIZE + payload_length);
 }
 
+bool OvtPacket::AppendPayload(const uint8_t *payload, size_t payload_length)
+{
+	size_t offset = OVT_FIXED_HEADER_SIZE + _payload_length;
+
+	if (offset + payload_length > _data->GetCapacity())
+	{
+		OV_ASSERT(false, "Data capacity must be greater than %ld (packet : %ld)",
+				_data->GetCapacity(), offset + payload_length);
+		return false;
+	}
+
+	SetPayloadLength(_payload_length + payload_length);
+
+	// SetLength() may reallocate the buffer
+	_buffer = _data->GetWritableDataAs<uint8_t>();
+	memcpy(&_buffer[offset], payload, payload_length);
+
+	_is_packet_available = true;
+
+	return true;
+}
+
 bool OvtPacket::SetPayload(const uint8_t *payload, size_t payload_length)
 {
 	if(OVT_FIXED_HEADER_SIZE + payload_length > _data->GetCapacity())
@@ -157,6 +157,8 @@ class OvtPacket
 {
 public:
 	OvtPacket();
+	// Reserves only the space for the header and payload_capacity bytes (instead of OVT_DEFAULT_MAX_PACKET_SIZE)
+	explicit OvtPacket(size_t payload_capacity);
 	OvtPacket(OvtPacket &src);
 	OvtPacket(const ov::Data &data);
 	virtual ~OvtPacket();
@@ -185,10 +187,18 @@ public:
 	void 		SetSessionId(uint32_t session_id);
 
 	bool 		SetPayload(const uint8_t *payload, size_t payload_size);
+	// Appends the data to the payload (The capacity must be reserved in advance)
+	bool 		AppendPayload(const uint8_t *payload, size_t payload_size);
 
 	const uint8_t* GetBuffer() const;
 	const std::shared_ptr<ov::Data>& GetData() const;
 
+	// Used to send the same packet to multiple sessions without copying the payload
+	// - MakeHeader() creates a copy of the header only (OVT_FIXED_HEADER_SIZE bytes) with the session id
+	// - GetPayloadData() returns the payload that refers to the buffer of this packet
+	std::shared_ptr<ov::Data> MakeHeader(uint32_t session_id) const;
+	std::shared_ptr<const ov::Data> GetPayloadData() const;
+
 private:
 	void 		SetPayloadLength(size_t payload_length);
 
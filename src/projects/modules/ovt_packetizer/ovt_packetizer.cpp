@@ -99,53 +99,57 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 
 	 *********************************************************************/
 
-	ov::Data payload;
-
-	// Header + Data
-	payload.SetLength(MEDIA_PACKET_HEADER_SIZE + media_packet->GetData()->GetLength());
-
-	auto buffer = payload.GetWritableDataAs<uint8_t>();
-
-	ByteWriter<uint32_t>::WriteBigEndian(&buffer[0], media_packet->GetTrackId());
-	ByteWriter<uint64_t>::WriteBigEndian(&buffer[4], media_packet->GetPts());
-	ByteWriter<uint64_t>::WriteBigEndian(&buffer[12], media_packet->GetDts());
-	ByteWriter<uint64_t>::WriteBigEndian(&buffer[20], media_packet->GetDuration());
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[28], static_cast<int8_t>(media_packet->GetMediaType()));
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[29], static_cast<int8_t>(media_packet->GetFlag()));
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[30], static_cast<int8_t>(media_packet->GetBitstreamFormat()));
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[31], static_cast<int8_t>(media_packet->GetPacketType()));
-	ByteWriter<uint32_t>::WriteBigEndian(&buffer[32], media_packet->GetData()->GetLength());
-
-	memcpy(&buffer[36], media_packet->GetData()->GetData(), media_packet->GetData()->GetLength());
-
+	// The media header is serialized separately and the frame data is copied into OvtPackets directly
+	// to avoid copying the whole frame into an intermediate buffer
+	uint8_t header[MEDIA_PACKET_HEADER_SIZE];
+	auto &media_data = media_packet->GetData();
+
+	ByteWriter<uint32_t>::WriteBigEndian(&header[0], media_packet->GetTrackId());
+	ByteWriter<uint64_t>::WriteBigEndian(&header[4], media_packet->GetPts());
+	ByteWriter<uint64_t>::WriteBigEndian(&header[12], media_packet->GetDts());
+	ByteWriter<uint64_t>::WriteBigEndian(&header[20], media_packet->GetDuration());
+	ByteWriter<uint8_t>::WriteBigEndian(&header[28], static_cast<int8_t>(media_packet->GetMediaType()));
+	ByteWriter<uint8_t>::WriteBigEndian(&header[29], static_cast<int8_t>(media_packet->GetFlag()));
+	ByteWriter<uint8_t>::WriteBigEndian(&header[30], static_cast<int8_t>(media_packet->GetBitstreamFormat()));
+	ByteWriter<uint8_t>::WriteBigEndian(&header[31], static_cast<int8_t>(media_packet->GetPacketType()));
+	ByteWriter<uint32_t>::WriteBigEndian(&header[32], media_data->GetLength());
+
+	auto data_buffer = media_data->GetDataAs<uint8_t>();
 	size_t max_payload_size = OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE;
-	size_t remain_payload_len = payload.GetLength();
+	size_t remain_payload_len = MEDIA_PACKET_HEADER_SIZE + media_data->GetLength();
+	// Offset in <header + data>
 	size_t offset = 0;
 
 	while(remain_payload_len != 0)
 	{
+		size_t payload_size = std::min(remain_payload_len, max_payload_size);
+
 		// Serialize
-		auto packet = std::make_shared<OvtPacket>();
+		auto packet = std::make_shared<OvtPacket>(payload_size);
 		// Session ID should be set in Session Level
 		packet->SetSessionId(0);
 		packet->SetPayloadType(OVT_PAYLOAD_TYPE_MEDIA_PACKET);
-		packet->SetMarker(false);
+		// The last packet of group has marker bit.
+		packet->SetMarker(remain_payload_len == payload_size);
 		packet->SetTimestamp(timestamp);
 
-		if(remain_payload_len > max_payload_size)
+		size_t end_offset = offset + payload_size;
+
+		if(offset < MEDIA_PACKET_HEADER_SIZE)
 		{
-			packet->SetPayload(&buffer[offset], max_payload_size);
-			offset += max_payload_size;
-			remain_payload_len -= max_payload_size;
+			size_t header_size = std::min(end_offset, static_cast<size_t>(MEDIA_PACKET_HEADER_SIZE)) - offset;
+			packet->AppendPayload(&header[offset], header_size);
+			offset += header_size;
 		}
-		else
+
+		if(offset < end_offset)
 		{
-			// The last packet of group has marker bit.
-			packet->SetMarker(true);
-			packet->SetPayload(&buffer[offset], remain_payload_len);
-			remain_payload_len = 0;
+			packet->AppendPayload(&data_buffer[offset - MEDIA_PACKET_HEADER_SIZE], end_offset - offset);
+			offset = end_offset;
 		}
 
+		remain_payload_len -= payload_size;
+
 		packet->SetSequenceNumber(_sequence_number++);
 
 		if(_stream != nullptr)
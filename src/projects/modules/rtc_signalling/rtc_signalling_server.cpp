@@ -230,7 +230,7 @@ bool RtcSignallingServer::SetWebSocketHandler(std::shared_ptr<http::svr::ws::Int
 
 			logti("New client is connected: %s", description.CStr());
 
-			auto uri = ov::Url::Parse(request->GetUri());
+			auto &uri = request->GetParsedUri();
 
 			if (uri == nullptr)
 			{
@@ -283,8 +283,15 @@ bool RtmpWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::shar
 //	- H264 : AnnexB bitstream
 // 	- AAC : ASC(Audio Specific Config) bitstream
 
-bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data)
+bool RtmpWriter::PutData(const std::shared_ptr<const MediaPacket> &packet)
 {
+	auto track_id = packet->GetTrackId();
+	auto pts = packet->GetPts();
+	auto dts = packet->GetDts();
+	auto flag = packet->GetFlag();
+	auto format = packet->GetBitstreamFormat();
+	auto data = packet->GetData();
+
 	std::unique_lock<std::mutex> mlock(_lock);
 
 	if (_format_context == nullptr)
@@ -332,7 +339,7 @@ bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 				break;
 
 			case cmn::BitstreamFormat::H264_ANNEXB:
-				cdata = H264Converter::ConvertAnnexbToAvcc(cdata);
+				cdata = H264Converter::GetAvccData(packet);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
@@ -343,7 +350,7 @@ bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 				break;
 
 			case cmn::BitstreamFormat::AAC_ADTS:
-				cdata = AacConverter::ConvertAdtsToRaw(cdata, &length_list);
+				cdata = AacConverter::GetRawData(packet, &length_list);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
@@ -363,7 +370,7 @@ bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 				break;
 
 			case cmn::BitstreamFormat::AAC_ADTS:
-				cdata = AacConverter::ConvertAdtsToRaw(cdata, &length_list);
+				cdata = AacConverter::GetRawData(packet, &length_list);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
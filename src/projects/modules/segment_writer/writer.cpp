@@ -752,8 +752,7 @@ bool Writer::WritePacket(const std::shared_ptr<const MediaPacket> &packet)
 			break;
 
 		case cmn::BitstreamFormat::H264_ANNEXB:
-			data = packet->GetData();
-			data = H264Converter::ConvertAnnexbToAvcc(data);
+			data = H264Converter::GetAvccData(packet);
 			length_list.push_back(data->GetLength());
 			break;
 
@@ -775,7 +774,7 @@ bool Writer::WritePacket(const std::shared_ptr<const MediaPacket> &packet)
 			}
 			else
 			{
-				data = AacConverter::ConvertAdtsToRaw(packet->GetData(), &length_list);
+				data = AacConverter::GetRawData(packet, &length_list);
 			}
 			break;
 		case cmn::BitstreamFormat::AAC_LATM:
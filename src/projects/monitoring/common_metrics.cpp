@@ -13,19 +13,31 @@ namespace mon
         _total_connections = 0;
 		_max_total_connections = 0;
 
-        _max_total_connection_time = std::chrono::system_clock::now();
-		_last_recv_time = std::chrono::system_clock::now();
-        _last_sent_time = std::chrono::system_clock::now();
+        auto now = GetCurrentTicks();
+
+        _max_total_connection_time = now;
+		_last_recv_time = now;
+        _last_sent_time = now;
 
         for(int i=0; i<static_cast<int8_t>(PublisherType::NumberOfPublishers); i++)
         {
             _publisher_metrics[i]._bytes_out = 0;
             _publisher_metrics[i]._connections = 0;
         }
-        _created_time = std::chrono::system_clock::now();
-        UpdateDate();
+        _created_time = TimeFromTicks(now);
+        UpdateDate(now);
     }
 
+	int64_t CommonMetrics::GetCurrentTicks()
+	{
+		return std::chrono::system_clock::now().time_since_epoch().count();
+	}
+
+	std::chrono::system_clock::time_point CommonMetrics::TimeFromTicks(int64_t ticks)
+	{
+		return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(ticks));
+	}
+
 	ov::String CommonMetrics::GetInfoString()
 	{
 		ov::String out_str;
@@ -61,16 +73,40 @@ namespace mon
         return std::chrono::duration_cast<std::chrono::seconds>(current - GetLastUpdatedTime()).count();
     }
 
-	const std::chrono::system_clock::time_point& CommonMetrics::GetCreatedTime() const
+	std::chrono::system_clock::time_point CommonMetrics::GetCreatedTime() const
 	{
 		return _created_time;
 	}
 
-    const std::chrono::system_clock::time_point& CommonMetrics::GetLastUpdatedTime() const
+    std::chrono::system_clock::time_point CommonMetrics::GetLastUpdatedTime() const
     {
-        return _last_updated_time;
+        return TimeFromTicks(_last_updated_time.load(std::memory_order_relaxed));
     }
 
+	CommonMetrics::Snapshot CommonMetrics::GetSnapshot() const
+	{
+		Snapshot snapshot;
+
+		snapshot.created_time = _created_time;
+		snapshot.last_updated_time = TimeFromTicks(_last_updated_time.load(std::memory_order_relaxed));
+
+		snapshot.total_bytes_in = _total_bytes_in.load(std::memory_order_relaxed);
+		snapshot.total_bytes_out = _total_bytes_out.load(std::memory_order_relaxed);
+		snapshot.total_connections = _total_connections.load(std::memory_order_relaxed);
+		snapshot.max_total_connections = _max_total_connections.load(std::memory_order_relaxed);
+		snapshot.max_total_connection_time = TimeFromTicks(_max_total_connection_time.load(std::memory_order_relaxed));
+		snapshot.last_recv_time = TimeFromTicks(_last_recv_time.load(std::memory_order_relaxed));
+		snapshot.last_sent_time = TimeFromTicks(_last_sent_time.load(std::memory_order_relaxed));
+
+		for (int i = 0; i < static_cast<int8_t>(PublisherType::NumberOfPublishers); i++)
+		{
+			snapshot.bytes_out[i] = _publisher_metrics[i]._bytes_out.load(std::memory_order_relaxed);
+			snapshot.connections[i] = _publisher_metrics[i]._connections.load(std::memory_order_relaxed);
+		}
+
+		return snapshot;
+	}
+
     uint64_t CommonMetrics::GetTotalBytesIn() const
 	{
 		return _total_bytes_in;
@@ -90,17 +126,17 @@ namespace mon
 	}
 	std::chrono::system_clock::time_point CommonMetrics::GetMaxTotalConnectionsTime() const
 	{
-		return _max_total_connection_time;
+		return TimeFromTicks(_max_total_connection_time.load(std::memory_order_relaxed));
 	}
 
 	std::chrono::system_clock::time_point CommonMetrics::GetLastRecvTime() const
 	{
-		return _last_recv_time;
+		return TimeFromTicks(_last_recv_time.load(std::memory_order_relaxed));
 	}
 
 	std::chrono::system_clock::time_point CommonMetrics::GetLastSentTime() const
 	{
-		return _last_sent_time;
+		return TimeFromTicks(_last_sent_time.load(std::memory_order_relaxed));
 	}
 
 	uint64_t CommonMetrics::GetBytesOut(PublisherType type) const
@@ -115,8 +151,10 @@ namespace mon
     void CommonMetrics::IncreaseBytesIn(uint64_t value)
 	{
 		_total_bytes_in += value;
-		_last_recv_time = std::chrono::system_clock::now();
-		UpdateDate();
+
+		auto now = GetCurrentTicks();
+		_last_recv_time.store(now, std::memory_order_relaxed);
+		UpdateDate(now);
 	}
 	void CommonMetrics::IncreaseBytesOut(PublisherType type, uint64_t value)
 	{
@@ -127,22 +165,29 @@ namespace mon
 		
 		_publisher_metrics[static_cast<int8_t>(type)]._bytes_out += value;
 		_total_bytes_out += value;
-		_last_sent_time = std::chrono::system_clock::now();
-		UpdateDate();
+
+		auto now = GetCurrentTicks();
+		_last_sent_time.store(now, std::memory_order_relaxed);
+		UpdateDate(now);
 	}
 
 	void CommonMetrics::OnSessionConnected(PublisherType type)
 	{
 		_publisher_metrics[static_cast<int8_t>(type)]._connections++;
-		_total_connections++;
+		auto total_connections = ++_total_connections;
+		auto now = GetCurrentTicks();
 
-		if (_total_connections.load() > _max_total_connections.load())
+		auto max_total_connections = _max_total_connections.load();
+		while (total_connections > max_total_connections)
 		{
-			_max_total_connections.exchange(_total_connections);
-			_max_total_connection_time = std::chrono::system_clock::now();
+			if (_max_total_connections.compare_exchange_weak(max_total_connections, total_connections))
+			{
+				_max_total_connection_time.store(now, std::memory_order_relaxed);
+				break;
+			}
 		}
 
-		UpdateDate();
+		UpdateDate(now);
 	}
 	void CommonMetrics::OnSessionDisconnected(PublisherType type)
 	{
@@ -163,6 +208,11 @@ namespace mon
     // Renew last updated time
     void CommonMetrics::UpdateDate()
     {
-        _last_updated_time = std::chrono::system_clock::now();
+        UpdateDate(GetCurrentTicks());
     }
+
+	void CommonMetrics::UpdateDate(int64_t now)
+	{
+		_last_updated_time.store(now, std::memory_order_relaxed);
+	}
 }
\ No newline at end of file
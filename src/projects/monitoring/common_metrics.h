@@ -13,12 +13,32 @@ namespace mon
 	class CommonMetrics
 	{
 	public:
+		// Values of the metrics at a moment, read without calling the getters one by one
+		struct Snapshot
+		{
+			std::chrono::system_clock::time_point created_time;
+			std::chrono::system_clock::time_point last_updated_time;
+
+			uint64_t total_bytes_in = 0;
+			uint64_t total_bytes_out = 0;
+			uint32_t total_connections = 0;
+			uint32_t max_total_connections = 0;
+			std::chrono::system_clock::time_point max_total_connection_time;
+			std::chrono::system_clock::time_point last_recv_time;
+			std::chrono::system_clock::time_point last_sent_time;
+
+			uint64_t bytes_out[static_cast<int8_t>(PublisherType::NumberOfPublishers)] = {};
+			uint32_t connections[static_cast<int8_t>(PublisherType::NumberOfPublishers)] = {};
+		};
+
 		virtual ov::String GetInfoString();
 		virtual void ShowInfo();
 
 		uint32_t GetUnusedTimeSec() const;
-		const std::chrono::system_clock::time_point& GetCreatedTime() const;
-		const std::chrono::system_clock::time_point& GetLastUpdatedTime() const;
+		std::chrono::system_clock::time_point GetCreatedTime() const;
+		std::chrono::system_clock::time_point GetLastUpdatedTime() const;
+
+		Snapshot GetSnapshot() const;
 		
 		virtual uint64_t GetTotalBytesIn() const;
 		virtual uint64_t GetTotalBytesOut() const;
@@ -42,9 +62,14 @@ namespace mon
 
 		// Renew last updated time
 		void UpdateDate();
+		void UpdateDate(int64_t now);
+
+		// The times are updated by many threads at once, so they are kept as the ticks of std::chrono::system_clock
+		static int64_t GetCurrentTicks();
+		static std::chrono::system_clock::time_point TimeFromTicks(int64_t ticks);
 
 		std::chrono::system_clock::time_point _created_time;
-		std::chrono::system_clock::time_point _last_updated_time;
+		std::atomic<int64_t> _last_updated_time;
 
 		// From Provider
 		std::atomic<uint64_t> _total_bytes_in;
@@ -55,10 +80,9 @@ namespace mon
 		std::atomic<uint32_t> _total_connections;
 		std::atomic<uint32_t> _max_total_connections;
 		// Time to reach maximum number of connections. 
-		// TODO(Getroot): Does it need mutex? Check!
-		std::chrono::system_clock::time_point	_max_total_connection_time;
-		std::chrono::system_clock::time_point	_last_recv_time;
-		std::chrono::system_clock::time_point	_last_sent_time;
+		std::atomic<int64_t> _max_total_connection_time;
+		std::atomic<int64_t> _last_recv_time;
+		std::atomic<int64_t> _last_sent_time;
 
 		// From Publishers
 		class PublisherMetrics
@@ -146,271 +146,373 @@ namespace mon
 
 	ov::String Event::SerializeToJson() const
 	{
-		Json::Value json_root;
+		// The event is written directly into the string without building Json::Value tree
+		ov::JsonWriter writer;
+
+		writer.BeginObject();
 
 		// Fill common values
-		json_root["eventVersion"] = EVENT_VERSION;
-		json_root["timestampMillis"] = _creation_time_msec;
-		json_root["userKey"] = _server_metric->GetConfig()->GetAnalytics().GetUserKey().CStr();
-		json_root["serverID"] = _server_metric->GetConfig()->GetID().CStr();
-		
+		writer.Member("eventVersion", EVENT_VERSION);
+		writer.Member("timestampMillis", _creation_time_msec);
+		writer.Member("userKey", _server_metric->GetConfig()->GetAnalytics().GetUserKey());
+		writer.Member("serverID", _server_metric->GetConfig()->GetID());
+
 		// Fill root["event"]
-		Json::Value &json_event = json_root["event"];
-		json_event["type"] = GetTypeString().CStr();
+		writer.Key("event").BeginObject();
+		writer.Member("type", GetTypeString());
 		if(_message.IsEmpty() == false)
 		{
-			json_event["message"] = _message.CStr();
+			writer.Member("message", _message);
 		}
-		
-		Json::Value &json_producer = json_event["producer"];
-		FillProducer(json_producer);
+
+		writer.Key("producer");
+		FillProducer(writer);
+		writer.EndObject();
 
 		// Fill root["data"]
-		Json::Value &json_data = json_root["data"];
+		writer.Key("data");
 
 		if(_category == EventCategory::StreamEventType)
 		{
+			writer.BeginObject();
+
 			//TODO(Getroot): Implement this
-			json_data["dataType"] = "Not Implemented";
+			writer.Member("dataType", "Not Implemented");
+
+			writer.Key("serverInfo");
+			FillServerInfo(writer);
 
-			Json::Value &json_server_info = json_data["serverInfo"];
-			FillServerInfo(json_server_info);
+			writer.EndObject();
 		}
 		else if(_category == EventCategory::StatisticsEventType)
 		{
-			Json::Value &json_server_stat = json_data["serverStat"];
-			FillServerStatistics(json_server_stat);
-		}
+			writer.BeginObject();
+
+			writer.Key("serverStat");
+			FillServerStatistics(writer);
 
-		Json::StreamWriterBuilder builder;
-		/* 
-			Default StreamWriterBuilder settings
+			writer.EndObject();
+		}
+		else
+		{
+			writer.Null();
+		}
 
-		  	(*settings)["commentStyle"] = "All";
-			(*settings)["indentation"] = "\t";
-			(*settings)["enableYAMLCompatibility"] = false;
-			(*settings)["dropNullPlaceholders"] = false;
-			(*settings)["useSpecialFloats"] = false;
-			(*settings)["emitUTF8"] = false;
-			(*settings)["precision"] = 17;
-			(*settings)["precisionType"] = "significant";
-		*/
+		writer.EndObject();
 
-		logtd("%s", json_root.toStyledString().c_str());
+		logtd("%s", writer.GetString().CStr());
 
-		builder["indentation"] = "";
-		return Json::writeString(builder, json_root).c_str();
+		return writer.GetString();
 	}
 
-	bool Event::FillProducer(Json::Value &json_producer) const
+	bool Event::FillProducer(ov::JsonWriter &writer) const
 	{
-		json_producer["serverID"] = _server_metric->GetConfig()->GetID().CStr();
+		writer.BeginObject();
+
+		writer.Member("serverID", _server_metric->GetConfig()->GetID());
 
 		switch(_extra_metric_type)
 		{
 			case ExtraMetricType::HostMetric:
-				FillProducer(json_producer, _host_metric);
+				FillProducer(writer, _host_metric);
 				break;
 			case ExtraMetricType::AppMetric:
-				FillProducer(json_producer, _app_metric);
+				FillProducer(writer, _app_metric);
 				break;
 			case ExtraMetricType::StreamMetric:
-				FillProducer(json_producer, _stream_metric);
+				FillProducer(writer, _stream_metric);
 				break;
 			case ExtraMetricType::None:
 			default:
 				break;
 		}
 
+		writer.EndObject();
+
 		return true;
 	}
 
-	bool Event::FillProducer(Json::Value &jsonProducer, const std::shared_ptr<HostMetrics> &host_metric) const
+	bool Event::FillProducer(ov::JsonWriter &writer, const std::shared_ptr<HostMetrics> &host_metric) const
 	{
-		jsonProducer["serverID"] = _server_metric->GetConfig()->GetID().CStr();
-		jsonProducer["hostID"] = host_metric->GetUUID().CStr();
+		// serverID is written by FillProducer(writer)
+		writer.Member("hostID", host_metric->GetUUID());
 		return true;
 	}
 
-	bool Event::FillProducer(Json::Value &jsonProducer, const std::shared_ptr<ApplicationMetrics> &app_metric) const
+	bool Event::FillProducer(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const
 	{
-		FillProducer(jsonProducer, app_metric->GetHostMetrics());
-		jsonProducer["appID"] = app_metric->GetUUID().CStr();
+		FillProducer(writer, app_metric->GetHostMetrics());
+		writer.Member("appID", app_metric->GetUUID());
 		return true;
 	}
 
-	bool Event::FillProducer(Json::Value &jsonProducer, const std::shared_ptr<StreamMetrics> &stream_metric) const
+	bool Event::FillProducer(ov::JsonWriter &writer, const std::shared_ptr<StreamMetrics> &stream_metric) const
 	{
-		FillProducer(jsonProducer, stream_metric->GetApplicationMetrics());
-		jsonProducer["streamID"] = stream_metric->GetUUID().CStr();
+		FillProducer(writer, stream_metric->GetApplicationMetrics());
+		writer.Member("streamID", stream_metric->GetUUID());
 		return true;
 	}
 
-	bool Event::FillServerInfo(Json::Value &json_server) const
+	bool Event::FillServerInfo(ov::JsonWriter &writer) const
 	{
-		json_server["serverID"] = _server_metric->GetConfig()->GetID().CStr();
-		json_server["serverName"] = _server_metric->GetConfig()->GetName().CStr();
-		json_server["serverVersion"] = info::OmeVersion::GetInstance()->ToString().CStr();
-		json_server["startedTime"] = ov::Converter::ToISO8601String(std::chrono::system_clock::now()).CStr();	
-		json_server["bind"] = _server_metric->GetConfig()->GetBind().ToJson();
+		writer.BeginObject();
+
+		writer.Member("serverID", _server_metric->GetConfig()->GetID());
+		writer.Member("serverName", _server_metric->GetConfig()->GetName());
+		writer.Member("serverVersion", info::OmeVersion::GetInstance()->ToString());
+		writer.Member("startedTime", ov::Converter::ToISO8601String(std::chrono::system_clock::now()));
+		writer.Member("bind", _server_metric->GetConfig()->GetBind().ToJson());
 
-		Json::Value &json_host = json_server["host"];
+		writer.Key("host");
 		switch(_extra_metric_type)
 		{
 			case ExtraMetricType::HostMetric:
-				FillHostInfo(json_host, _host_metric);
+				writer.BeginObject();
+				FillHostInfo(writer, _host_metric);
+				writer.EndObject();
 				break;
 			case ExtraMetricType::AppMetric:
-				FillHostAppInfo(json_host, _app_metric);
+				writer.BeginObject();
+				FillHostAppInfo(writer, _app_metric);
+				writer.EndObject();
 				break;
 			case ExtraMetricType::StreamMetric:
-				FillHostAppStreamInfo(json_host, _stream_metric);
+				writer.BeginObject();
+				FillHostAppStreamInfo(writer, _stream_metric);
+				writer.EndObject();
 				break;
 			case ExtraMetricType::None:
 			default:
+				writer.Null();
 				break;
 		}
 
+		writer.EndObject();
+
 		return true;
 	}
 
-	bool Event::FillHostInfo(Json::Value &json_host, const std::shared_ptr<HostMetrics> &host_metric) const
+	bool Event::FillHostInfo(ov::JsonWriter &writer, const std::shared_ptr<HostMetrics> &host_metric) const
 	{
-		json_host["hostID"] = host_metric->GetUUID().CStr();
-		json_host["name"] = host_metric->GetName().CStr();
-		json_host["createdTime"] = ov::Converter::ToISO8601String(host_metric->CommonMetrics::GetCreatedTime()).CStr();
-		json_host["distribution"] = host_metric->GetDistribution().IsEmpty()?"ovenmediaengine.com":host_metric->GetDistribution().CStr();
-		json_host["hostNames"] = host_metric->GetHost().ToJson();
+		writer.Member("hostID", host_metric->GetUUID());
+		writer.Member("name", host_metric->GetName());
+		writer.Member("createdTime", ov::Converter::ToISO8601String(host_metric->CommonMetrics::GetCreatedTime()));
+		writer.Member("distribution", host_metric->GetDistribution().IsEmpty() ? "ovenmediaengine.com" : host_metric->GetDistribution().CStr());
+		writer.Member("hostNames", host_metric->GetHost().ToJson());
 
 		return true;
 	}
 
-	bool Event::FillHostAppInfo(Json::Value &json_host, const std::shared_ptr<ApplicationMetrics> &app_metric) const
+	bool Event::FillAppInfo(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const
 	{
-		auto host_metric = app_metric->GetHostMetrics();
-		FillHostInfo(json_host, host_metric);
+		writer.Member("appID", app_metric->GetUUID());
+		writer.Member("name", app_metric->GetName().CStr());
+		writer.Member("createdTime", ov::Converter::ToISO8601String(app_metric->CommonMetrics::GetCreatedTime()));
+		writer.Member("outputProfiles", app_metric->GetConfig().GetOutputProfiles().ToJson());
+		writer.Member("providers", app_metric->GetConfig().GetProviders().ToJson());
+		writer.Member("publishers", app_metric->GetConfig().GetPublishers().ToJson());
 
-		Json::Value json_app;
-		json_app["appID"] = app_metric->GetUUID().CStr();
-		json_app["name"] = app_metric->GetName().CStr();
-		json_app["createdTime"] = ov::Converter::ToISO8601String(app_metric->CommonMetrics::GetCreatedTime()).CStr();
-		json_app["outputProfiles"] = app_metric->GetConfig().GetOutputProfiles().ToJson();
-		json_app["providers"] = app_metric->GetConfig().GetProviders().ToJson();
-		json_app["publishers"] = app_metric->GetConfig().GetPublishers().ToJson();
+		return true;
+	}
+
+	bool Event::FillHostAppInfo(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const
+	{
+		FillHostInfo(writer, app_metric->GetHostMetrics());
 
-		json_host["app"] = json_app;
+		writer.Key("app").BeginObject();
+		FillAppInfo(writer, app_metric);
+		writer.EndObject();
 
 		return true;
 	}
 
-	bool Event::FillHostAppStreamInfo(Json::Value &json_host, const std::shared_ptr<StreamMetrics> &stream_metric) const
+	bool Event::FillHostAppStreamInfo(ov::JsonWriter &writer, const std::shared_ptr<StreamMetrics> &stream_metric) const
 	{
 		auto app_metric = stream_metric->GetApplicationMetrics();
-		FillHostAppInfo(json_host, app_metric);
+		FillHostInfo(writer, app_metric->GetHostMetrics());
 
-		Json::Value &json_stream = json_host["app"]["stream"];
+		writer.Key("app").BeginObject();
+		FillAppInfo(writer, app_metric);
 
-		json_stream["streamID"] = stream_metric->GetUUID().CStr();
-		json_stream["name"] = stream_metric->GetName().CStr();
-		json_stream["createdTime"] = ov::Converter::ToISO8601String(stream_metric->CommonMetrics::GetCreatedTime()).CStr();
+		writer.Key("stream").BeginObject();
+
+		writer.Member("streamID", stream_metric->GetUUID());
+		writer.Member("name", stream_metric->GetName());
+		writer.Member("createdTime", ov::Converter::ToISO8601String(stream_metric->CommonMetrics::GetCreatedTime()));
 		
-		Json::Value &json_source = json_stream["source"];
+		writer.Key("source").BeginObject();
 
 		// OVT, RTSPPull, RTMP, WEBRTC, SRT, MPEG-TS
-		json_source["type"] = StringFromStreamSourceType(stream_metric->GetSourceType()).CStr();
-		json_source["address"] = stream_metric->GetMediaSource().CStr();
+		writer.Member("type", StringFromStreamSourceType(stream_metric->GetSourceType()));
+		writer.Member("address", stream_metric->GetMediaSource());
 
 		// If stream_metric is from OVT provider, originUUID is UUID of origin server's stream
 		if(stream_metric->GetOriginStreamUUID().IsEmpty())
 		{
 			// This stream itself is the origin stream
-			json_source["streamID"] = stream_metric->GetUUID().CStr();
+			writer.Member("streamID", stream_metric->GetUUID());
 		}
 		else
 		{
-			json_source["streamID"] = stream_metric->GetOriginStreamUUID().CStr();
+			writer.Member("streamID", stream_metric->GetOriginStreamUUID());
 		}
 
-		json_stream["tracks"] = serdes::JsonFromTracks(stream_metric->GetTracks());
+		writer.EndObject();
+
+		writer.Member("tracks", serdes::JsonFromTracks(stream_metric->GetTracks()));
 
 		if(stream_metric->GetLinkedOutputStreamMetrics().empty() == false)
 		{
-			Json::Value &json_outputs = json_stream["outputs"];
+			writer.Key("outputs").BeginArray();
 
 			for(const auto &output_stream_metric : stream_metric->GetLinkedOutputStreamMetrics())
 			{
-				Json::Value json_output_stream;
+				writer.BeginObject();
 
-				json_output_stream["streamID"] = output_stream_metric->GetUUID().CStr();
-				json_output_stream["name"] = output_stream_metric->GetName().CStr();
-				json_output_stream["createdTime"] = ov::Converter::ToISO8601String(output_stream_metric->CommonMetrics::GetCreatedTime()).CStr();
-				json_output_stream["tracks"] = serdes::JsonFromTracks(output_stream_metric->GetTracks());
+				writer.Member("streamID", output_stream_metric->GetUUID());
+				writer.Member("name", output_stream_metric->GetName());
+				writer.Member("createdTime", ov::Converter::ToISO8601String(output_stream_metric->CommonMetrics::GetCreatedTime()));
+				writer.Member("tracks", serdes::JsonFromTracks(output_stream_metric->GetTracks()));
 
-				json_outputs.append(json_output_stream);
+				writer.EndObject();
 			}
+
+			writer.EndArray();
 		}
 
+		// stream
+		writer.EndObject();
+		// app
+		writer.EndObject();
+
 		return true;
 	}
 
-	bool Event::FillServerStatistics(Json::Value &json_server_stat) const
+	bool Event::FillServerStatistics(ov::JsonWriter &writer) const
 	{
-		json_server_stat["serverID"] = _server_metric->GetConfig()->GetID().CStr();
-		json_server_stat["serverName"] = _server_metric->GetConfig()->GetName().CStr();
-		json_server_stat["stat"] = serdes::JsonFromMetrics(_server_metric);
-		Json::Value &json_hosts = json_server_stat["hosts"];
+		writer.BeginObject();
 
-		for(const auto& [host_key, host_metric] : _server_metric->GetHostMetricsList())
+		writer.Member("serverID", _server_metric->GetConfig()->GetID());
+		writer.Member("serverName", _server_metric->GetConfig()->GetName());
+		writer.Key("stat");
+		serdes::WriteMetrics(writer, _server_metric);
+
+		// The empty lists are written as null like the Json::Value that was referenced but not filled
+		auto host_metrics_list = _server_metric->GetHostMetricsList();
+		if(host_metrics_list.empty())
 		{
-			Json::Value json_host;
+			writer.Key("hosts").Null();
+		}
+		else
+		{
+			writer.Key("hosts").BeginArray();
+
+			for(const auto& [host_key, host_metric] : host_metrics_list)
+			{
+				writer.BeginObject();
 
-			json_host["hostID"] = host_metric->GetUUID().CStr();
-			json_host["hostName"] = host_metric->GetName().CStr();
-			json_host["distribution"] = host_metric->GetDistribution().CStr();
-			json_host["stat"] = serdes::JsonFromMetrics(host_metric);
+				writer.Member("hostID", host_metric->GetUUID());
+				writer.Member("hostName", host_metric->GetName());
+				writer.Member("distribution", host_metric->GetDistribution());
+				writer.Key("stat");
+				serdes::WriteMetrics(writer, host_metric);
 
-			Json::Value &json_apps = json_host["apps"];
+				FillApplicationStatistics(writer, host_metric);
+
+				writer.EndObject();
+			}
+
+			writer.EndArray();
+		}
 
-			for(const auto& [app_key, app_metric] : host_metric->GetApplicationMetricsList())
+		writer.EndObject();
+
+		return true;
+	}
+
+	void Event::FillApplicationStatistics(ov::JsonWriter &writer, const std::shared_ptr<HostMetrics> &host_metric) const
+	{
+		auto app_metrics_list = host_metric->GetApplicationMetricsList();
+		if(app_metrics_list.empty())
+		{
+			writer.Key("apps").Null();
+			return;
+		}
+
+		writer.Key("apps").BeginArray();
+
+		for(const auto& [app_key, app_metric] : app_metrics_list)
+		{
+			writer.BeginObject();
+
+			writer.Member("appID", app_metric->GetUUID());
+			writer.Member("appName", app_metric->GetName().CStr());
+			writer.Key("stat");
+			serdes::WriteMetrics(writer, app_metric);
+
+			FillStreamStatistics(writer, app_metric);
+
+			writer.EndObject();
+		}
+
+		writer.EndArray();
+	}
+
+	void Event::FillStreamStatistics(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const
+	{
+		std::vector<std::shared_ptr<StreamMetrics>> input_stream_metrics_list;
+		for(const auto& [stream_key, stream_metric] : app_metric->GetStreamMetricsMap())
+		{
+			if(stream_metric->IsInputStream())
 			{
-				Json::Value json_app;
+				input_stream_metrics_list.push_back(stream_metric);
+			}
+		}
 
-				json_app["appID"] = app_metric->GetUUID().CStr();
-				json_app["appName"] = app_metric->GetName().CStr();
-				json_app["stat"] = serdes::JsonFromMetrics(app_metric);
+		if(input_stream_metrics_list.empty())
+		{
+			writer.Key("streams").Null();
+			return;
+		}
+
+		writer.Key("streams").BeginArray();
+
+		for(const auto& stream_metric : input_stream_metrics_list)
+		{
+			writer.BeginObject();
 
-				Json::Value &json_streams = json_app["streams"];
-				for(const auto& [stream_key, stream_metric] : app_metric->GetStreamMetricsMap())
+			writer.Member("streamID", stream_metric->GetUUID());
+			writer.Member("streamName", stream_metric->GetName());
+			writer.Key("stat");
+			serdes::WriteMetrics(writer, stream_metric);
+
+			auto output_stream_metrics_list = stream_metric->GetLinkedOutputStreamMetrics();
+			if(output_stream_metrics_list.empty())
+			{
+				writer.Key("outputs").Null();
+			}
+			else
+			{
+				writer.Key("outputs").BeginArray();
+
+				for(const auto& output_stream_metric : output_stream_metrics_list)
 				{
-					if(stream_metric->IsInputStream())
-					{
-						Json::Value json_stream;
-						json_stream["streamID"] = stream_metric->GetUUID().CStr();
-						json_stream["streamName"] = stream_metric->GetName().CStr();
-						json_stream["stat"] = serdes::JsonFromMetrics(stream_metric);
-
-						Json::Value &json_output_streams = json_stream["outputs"];
-						for(const auto& output_stream_metric : stream_metric->GetLinkedOutputStreamMetrics())
-						{
-							Json::Value json_output_stream;
-
-							json_output_stream["streamID"] = output_stream_metric->GetUUID().CStr();
-							json_output_stream["streamName"] = output_stream_metric->GetName().CStr();
-							json_output_stream["stat"] = serdes::JsonFromMetrics(output_stream_metric);
-
-							json_output_streams.append(json_output_stream);
-						}
-						
-						json_streams.append(json_stream);
-					}
+					writer.BeginObject();
+
+					writer.Member("streamID", output_stream_metric->GetUUID());
+					writer.Member("streamName", output_stream_metric->GetName());
+					writer.Key("stat");
+					serdes::WriteMetrics(writer, output_stream_metric);
+
+					writer.EndObject();
 				}
 
-				json_apps.append(json_app);
+				writer.EndArray();
 			}
 
-			json_hosts.append(json_host);
+			writer.EndObject();
 		}
 
-		return true;
+		writer.EndArray();
 	}
 }
\ No newline at end of file
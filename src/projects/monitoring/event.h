@@ -49,18 +49,22 @@ namespace mon
 	private:
 
 		// Use _extra_metric_type
-		bool FillProducer(Json::Value &json_producer) const;
-		bool FillProducer(Json::Value &json_producer, const std::shared_ptr<HostMetrics> &host_metric) const;
-		bool FillProducer(Json::Value &json_producer, const std::shared_ptr<ApplicationMetrics> &app_metric) const;
-		bool FillProducer(Json::Value &json_producer, const std::shared_ptr<StreamMetrics> &stream_metric) const;
+		bool FillProducer(ov::JsonWriter &writer) const;
+		bool FillProducer(ov::JsonWriter &writer, const std::shared_ptr<HostMetrics> &host_metric) const;
+		bool FillProducer(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const;
+		bool FillProducer(ov::JsonWriter &writer, const std::shared_ptr<StreamMetrics> &stream_metric) const;
 
 		// Use _extra_metric_type
-		bool FillServerInfo(Json::Value &json_server) const;
-		bool FillHostInfo(Json::Value &json_host, const std::shared_ptr<HostMetrics> &host_metric) const;
-		bool FillHostAppInfo(Json::Value &json_host, const std::shared_ptr<ApplicationMetrics> &app_metric) const;
-		bool FillHostAppStreamInfo(Json::Value &json_host, const std::shared_ptr<StreamMetrics> &stream_metric) const;
-
-		bool FillServerStatistics(Json::Value &json_stat) const;
+		bool FillServerInfo(ov::JsonWriter &writer) const;
+		// Write the members of the object
+		bool FillHostInfo(ov::JsonWriter &writer, const std::shared_ptr<HostMetrics> &host_metric) const;
+		bool FillAppInfo(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const;
+		bool FillHostAppInfo(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const;
+		bool FillHostAppStreamInfo(ov::JsonWriter &writer, const std::shared_ptr<StreamMetrics> &stream_metric) const;
+
+		bool FillServerStatistics(ov::JsonWriter &writer) const;
+		void FillApplicationStatistics(ov::JsonWriter &writer, const std::shared_ptr<HostMetrics> &host_metric) const;
+		void FillStreamStatistics(ov::JsonWriter &writer, const std::shared_ptr<ApplicationMetrics> &app_metric) const;
 
 		enum class EventCategory
 		{
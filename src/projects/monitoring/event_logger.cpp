@@ -3,17 +3,54 @@
 namespace mon
 {
 	EventLogger::EventLogger()
-		: _log_writer(DEFAULT_EVENT_LOG_FILE_NAME, true)
+		: _log_writer(DEFAULT_EVENT_LOG_FILE_NAME, true),
+		  _async_writer("EventLogger", [this](const std::vector<ov::LogAsyncWriter::Entry> &entries, uint64_t dropped_count) {
+			  OnAsyncEvents(entries);
+		  })
 	{
 	}
 
+	EventLogger::~EventLogger()
+	{
+		_async_writer.Stop();
+	}
+
 	void EventLogger::SetLogPath(const ov::String &log_path)
 	{
 		_log_writer.SetLogPath(log_path.CStr());
 	}
 
+	void EventLogger::SetAsync(bool is_async, size_t buffer_size)
+	{
+		_async_writer.Stop();
+
+		if (is_async)
+		{
+			_async_writer.Start((buffer_size > 0) ? buffer_size : OV_LOG_ASYNC_DEFAULT_BUFFER_SIZE);
+		}
+	}
+
 	void EventLogger::Write(const Event &event)
 	{
-		_log_writer.Write(event.SerializeToJson().CStr(), event.GetCreationTimeMSec()/1000);
+		auto json = event.SerializeToJson();
+		std::time_t time = event.GetCreationTimeMSec() / 1000;
+
+		// The event forwarder reads the events from the file, so an event is not dropped even if the buffer is full
+		if (_async_writer.Push(OVLogLevelInformation, time, std::move(json)) == ov::LogAsyncWriter::PushResult::Pushed)
+		{
+			return;
+		}
+
+		_log_writer.Write(json.CStr(), time);
+	}
+
+	void EventLogger::OnAsyncEvents(const std::vector<ov::LogAsyncWriter::Entry> &entries)
+	{
+		for (const auto &entry : entries)
+		{
+			_log_writer.Write(entry.message.CStr(), entry.time, false);
+		}
+
+		_log_writer.Flush();
 	}
 }
\ No newline at end of file
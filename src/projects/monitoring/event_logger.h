@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base/ovlibrary/ovlibrary.h"
+#include "base/ovlibrary/log_async_writer.h"
 #include "base/ovlibrary/log_write.h"
 #include "event.h"
 
@@ -12,12 +13,18 @@ namespace mon
 	{
 	public:
 		EventLogger();
+		~EventLogger();
+
 		void SetLogPath(const ov::String &log_path);
+		// Writes the events in a background thread
+		void SetAsync(bool is_async, size_t buffer_size);
 
-		//TODO(Getroot): Later, it may need to queue events
 		void Write(const Event &event);
 
 	private:
+		void OnAsyncEvents(const std::vector<ov::LogAsyncWriter::Entry> &entries);
+
 		ov::LogWrite _log_writer;
+		ov::LogAsyncWriter _async_writer;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,167 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mon
+{
+	ov::String StringFromLatencyStage(LatencyStage stage)
+	{
+		switch (stage)
+		{
+			case LatencyStage::MediaRouterInbound:
+				return "mediaRouterInbound";
+			case LatencyStage::TranscoderOutput:
+				return "transcoderOutput";
+			case LatencyStage::MediaRouterOutbound:
+				return "mediaRouterOutbound";
+			case LatencyStage::LLHlsPartReady:
+				return "llhlsPartReady";
+			case LatencyStage::RtpPacketized:
+				return "rtpPacketized";
+			case LatencyStage::SessionSend:
+				return "sessionSend";
+			case LatencyStage::NumberOfStages:
+				break;
+		}
+
+		return "unknown";
+	}
+
+	size_t LatencyHistogram::GetBucketIndex(int64_t value)
+	{
+		if (value < static_cast<int64_t>(SUB_BUCKET_COUNT))
+		{
+			return (value > 0) ? static_cast<size_t>(value) : 0;
+		}
+
+		// Position of the most significant bit (>= LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+		int msb = 63 - __builtin_clzll(static_cast<uint64_t>(value));
+
+		if (msb >= LATENCY_HISTOGRAM_MAX_BITS)
+		{
+			return BUCKET_COUNT - 1;
+		}
+
+		auto shift = msb - LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+		auto sub_bucket = (static_cast<uint64_t>(value) >> shift) & (SUB_BUCKET_COUNT - 1);
+
+		return SUB_BUCKET_COUNT + (shift * SUB_BUCKET_COUNT) + sub_bucket;
+	}
+
+	int64_t LatencyHistogram::GetBucketValue(size_t index)
+	{
+		if (index < SUB_BUCKET_COUNT)
+		{
+			return static_cast<int64_t>(index);
+		}
+
+		auto shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+		auto sub_bucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+
+		auto lower = static_cast<int64_t>(SUB_BUCKET_COUNT + sub_bucket) << shift;
+		auto width = static_cast<int64_t>(1) << shift;
+
+		return lower + (width / 2);
+	}
+
+	void LatencyHistogram::Record(int64_t latency_us)
+	{
+		// The wall clock may go backwards
+		latency_us = std::max<int64_t>(latency_us, 0);
+
+		_buckets[GetBucketIndex(latency_us)].fetch_add(1, std::memory_order_relaxed);
+		_count.fetch_add(1, std::memory_order_relaxed);
+		_sum_us.fetch_add(latency_us, std::memory_order_relaxed);
+
+		auto min_us = _min_us.load(std::memory_order_relaxed);
+		while ((latency_us < min_us) && (_min_us.compare_exchange_weak(min_us, latency_us, std::memory_order_relaxed) == false))
+		{
+		}
+
+		auto max_us = _max_us.load(std::memory_order_relaxed);
+		while ((latency_us > max_us) && (_max_us.compare_exchange_weak(max_us, latency_us, std::memory_order_relaxed) == false))
+		{
+		}
+	}
+
+	LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const
+	{
+		Snapshot snapshot;
+
+		std::array<uint64_t, BUCKET_COUNT> buckets;
+		uint64_t count = 0;
+
+		for (size_t index = 0; index < BUCKET_COUNT; index++)
+		{
+			buckets[index] = _buckets[index].load(std::memory_order_relaxed);
+			count += buckets[index];
+		}
+
+		if (count == 0)
+		{
+			return snapshot;
+		}
+
+		snapshot.count = count;
+		snapshot.min_us = _min_us.load(std::memory_order_relaxed);
+		snapshot.max_us = _max_us.load(std::memory_order_relaxed);
+		if (snapshot.min_us > snapshot.max_us)
+		{
+			// Record() is in progress
+			snapshot.min_us = snapshot.max_us;
+		}
+		snapshot.sum_us = _sum_us.load(std::memory_order_relaxed);
+		snapshot.mean_us = snapshot.sum_us / static_cast<int64_t>(std::max<uint64_t>(_count.load(std::memory_order_relaxed), 1));
+
+		struct Percentile
+		{
+			double ratio;
+			int64_t *value;
+		};
+
+		Percentile percentiles[] = {
+			{0.5, &snapshot.p50_us},
+			{0.9, &snapshot.p90_us},
+			{0.99, &snapshot.p99_us},
+			{0.999, &snapshot.p999_us}};
+
+		size_t percentile_index = 0;
+		uint64_t accumulated = 0;
+
+		for (size_t index = 0; (index < BUCKET_COUNT) && (percentile_index < OV_COUNTOF(percentiles)); index++)
+		{
+			accumulated += buckets[index];
+
+			while ((percentile_index < OV_COUNTOF(percentiles)) && (accumulated >= static_cast<uint64_t>(std::ceil(percentiles[percentile_index].ratio * count))) && (accumulated > 0))
+			{
+				// The approximated value must not be out of the recorded range
+				*(percentiles[percentile_index].value) = std::clamp(GetBucketValue(index), snapshot.min_us, snapshot.max_us);
+				percentile_index++;
+			}
+		}
+
+		return snapshot;
+	}
+
+	void LatencyHistogram::Reset()
+	{
+		for (auto &bucket : _buckets)
+		{
+			bucket = 0;
+		}
+
+		_count = 0;
+		_sum_us = 0;
+		_min_us = INT64_MAX;
+		_max_us = 0;
+	}
+}  // namespace mon
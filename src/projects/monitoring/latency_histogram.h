@@ -0,0 +1,84 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <array>
+#include <atomic>
+
+// Each power of two range is divided into 2^LATENCY_HISTOGRAM_SUB_BUCKET_BITS buckets (relative error < 6.25%)
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS (4)
+// Latencies longer than 2^LATENCY_HISTOGRAM_MAX_BITS microseconds (about 68 seconds) are recorded in the last bucket
+#define LATENCY_HISTOGRAM_MAX_BITS (36)
+
+namespace mon
+{
+	// The points where the latency from the ingest is measured
+	enum class LatencyStage : uint8_t
+	{
+		// The packet is delivered to the transcoder by MediaRouter
+		MediaRouterInbound = 0,
+		// The encoded packet is produced by the transcoder
+		TranscoderOutput,
+		// The packet is delivered to the publishers by MediaRouter
+		MediaRouterOutbound,
+		// The LL-HLS partial segment that contains the packet is ready to be served
+		LLHlsPartReady,
+		// The packet is packetized into RTP packets
+		RtpPacketized,
+		// The packet is delivered to the sessions
+		SessionSend,
+
+		NumberOfStages
+	};
+
+	ov::String StringFromLatencyStage(LatencyStage stage);
+
+	// A lock-free histogram of the latencies in microseconds with log-linear buckets (like HdrHistogram),
+	// so the recording costs only a few atomic increments regardless of the range of the values
+	class LatencyHistogram
+	{
+	public:
+		struct Snapshot
+		{
+			uint64_t count = 0;
+			int64_t min_us = 0;
+			int64_t max_us = 0;
+			int64_t mean_us = 0;
+			int64_t sum_us = 0;
+			int64_t p50_us = 0;
+			int64_t p90_us = 0;
+			int64_t p99_us = 0;
+			int64_t p999_us = 0;
+		};
+
+		void Record(int64_t latency_us);
+
+		// The values can be slightly inconsistent with each other if Record() is called at the same time
+		Snapshot GetSnapshot() const;
+
+		void Reset();
+
+	protected:
+		static constexpr size_t SUB_BUCKET_COUNT = (1 << LATENCY_HISTOGRAM_SUB_BUCKET_BITS);
+		static constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT + (LATENCY_HISTOGRAM_MAX_BITS - LATENCY_HISTOGRAM_SUB_BUCKET_BITS) * SUB_BUCKET_COUNT;
+
+		static size_t GetBucketIndex(int64_t value);
+		// Returns the middle of the range of the bucket
+		static int64_t GetBucketValue(size_t index);
+
+		std::array<std::atomic<uint64_t>, BUCKET_COUNT> _buckets{};
+
+		std::atomic<uint64_t> _count{0};
+		std::atomic<int64_t> _sum_us{0};
+		std::atomic<int64_t> _min_us{INT64_MAX};
+		std::atomic<int64_t> _max_us{0};
+	};
+}  // namespace mon
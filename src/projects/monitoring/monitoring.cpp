@@ -10,6 +10,7 @@ namespace mon
 {
 	void Monitoring::Release()
 	{
+		_prometheus_exporter.Stop();
 		OV_SAFE_RESET(_server_metric, nullptr, _server_metric->Release(), _server_metric);
 		_forwarder.Stop();
 	}
@@ -64,10 +65,21 @@ namespace mon
 		_forwarder.SetLogPath(log_path);
 	}	
 
+	void Monitoring::SetLogAsync(bool is_async, size_t buffer_size)
+	{
+		_logger.SetAsync(is_async, buffer_size);
+	}
+
 	void Monitoring::OnServerStarted(const std::shared_ptr<const cfg::Server> &server_config)
 	{
 		_server_metric = std::make_shared<ServerMetrics>(server_config);
 		_is_analytics_on = _server_metric->GetConfig()->GetAnalytics().IsParsed();
+		_is_latency_tracing_on = server_config->GetModules().GetLatencyTracing().IsEnabled();
+
+		if (_is_latency_tracing_on)
+		{
+			logti("Latency tracing is enabled");
+		}
 
 		logti("%s(%s) ServerMetric has been started for monitoring - %s",
 			server_config->GetName().CStr(), server_config->GetID().CStr(),
@@ -406,4 +418,20 @@ namespace mon
 		stream_metric->OnSessionsDisconnected(type, number_of_sessions);
 	}
 
+	void Monitoring::RecordLatency(const info::Stream &stream_info, LatencyStage stage, int64_t ingest_time_us)
+	{
+		if (ingest_time_us <= 0)
+		{
+			return;
+		}
+
+		auto stream_metric = GetStreamMetrics(stream_info);
+		if(stream_metric == nullptr)
+		{
+			return;
+		}
+
+		stream_metric->RecordLatency(stage, static_cast<int64_t>(ov::Clock::NowUSec()) - ingest_time_us);
+	}
+
 }  // namespace mon
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "server_metrics.h"
 #include "event_logger.h"
 #include "event_forwarder.h"
+#include "prometheus_exporter.h"
 
 #define MonitorInstance				mon::Monitoring::GetInstance()
 #define HostMetrics(info)			mon::Monitoring::GetInstance()->GetHostMetrics(info);
@@ -29,18 +30,29 @@ namespace mon
 		void Release();
 
 		void SetLogPath(const ov::String &log_path);
+		void SetLogAsync(bool is_async, size_t buffer_size);
 
 		bool IsAnalyticsOn()
 		{
 			return _is_analytics_on;
 		}
 
+		bool IsLatencyTracingOn() const
+		{
+			return _is_latency_tracing_on;
+		}
+
 		std::shared_ptr<ServerMetrics> GetServerMetrics();
 		std::map<uint32_t, std::shared_ptr<HostMetrics>> GetHostMetricsList();
 		std::shared_ptr<HostMetrics> GetHostMetrics(const info::Host &host_info);
         std::shared_ptr<ApplicationMetrics> GetApplicationMetrics(const info::Application &app_info);
         std::shared_ptr<StreamMetrics>  GetStreamMetrics(const info::Stream &stream_info);
 
+		PrometheusExporter &GetPrometheusExporter()
+		{
+			return _prometheus_exporter;
+		}
+
 		// Events
 		void OnServerStarted(const std::shared_ptr<const cfg::Server> &server_config);
 		bool OnHostCreated(const info::Host &host_info);
@@ -57,12 +69,18 @@ namespace mon
 		void OnSessionDisconnected(const info::Stream &stream_info, PublisherType type);
 		void OnSessionsDisconnected(const info::Stream &stream_info, PublisherType type, uint64_t number_of_sessions);
 
+		// Records the time elapsed since ingest_time_us (see MediaPacket::GetIngestTime()).
+		// Nothing is recorded if ingest_time_us is 0
+		void RecordLatency(const info::Stream &stream_info, LatencyStage stage, int64_t ingest_time_us);
+
 	private:
 		ov::DelayQueue _timer{"MonLogTimer"};
 		std::shared_ptr<ServerMetrics> _server_metric = nullptr;
 		EventLogger	_logger;
 		EventForwarder _forwarder;
+		PrometheusExporter _prometheus_exporter;
 		bool _is_analytics_on = false;
+		bool _is_latency_tracing_on = false;
 
 	};
 }  // namespace mon
\ No newline at end of file
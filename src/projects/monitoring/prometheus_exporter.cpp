@@ -0,0 +1,348 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "prometheus_exporter.h"
+
+#include <cinttypes>
+
+#include "monitoring.h"
+#include "monitoring_private.h"
+
+namespace mon
+{
+	namespace
+	{
+		// Escapes the label value (backslash, double-quote and line feed must be escaped)
+		ov::String EscapeLabelValue(const ov::String &value)
+		{
+			ov::String escaped;
+			escaped.SetCapacity(value.GetLength());
+
+			for (size_t index = 0; index < value.GetLength(); index++)
+			{
+				auto character = value.Get(index);
+
+				switch (character)
+				{
+					case '\\':
+						escaped.Append("\\\\");
+						break;
+					case '"':
+						escaped.Append("\\\"");
+						break;
+					case '\n':
+						escaped.Append("\\n");
+						break;
+					default:
+						escaped.Append(character);
+						break;
+				}
+			}
+
+			return escaped;
+		}
+
+		// The samples of a family must be grouped together, so each family has its own buffer
+		class MetricFamily
+		{
+		public:
+			MetricFamily(ov::String name, const char *type, const char *help)
+				: _name(std::move(name))
+			{
+				_text.AppendFormat("# HELP %s %s\n# TYPE %s %s\n", _name.CStr(), help, _name.CStr(), type);
+			}
+
+			// suffix: Used for the samples of the summary (e.g. "_sum", "_count")
+			void Append(const ov::String &labels, uint64_t value, const char *suffix = "")
+			{
+				if (labels.IsEmpty())
+				{
+					_text.AppendFormat("%s%s %" PRIu64 "\n", _name.CStr(), suffix, value);
+				}
+				else
+				{
+					_text.AppendFormat("%s%s{%s} %" PRIu64 "\n", _name.CStr(), suffix, labels.CStr(), value);
+				}
+			}
+
+			void Append(const ov::String &labels, double value, const char *suffix = "")
+			{
+				if (labels.IsEmpty())
+				{
+					_text.AppendFormat("%s%s %.6f\n", _name.CStr(), suffix, value);
+				}
+				else
+				{
+					_text.AppendFormat("%s%s{%s} %.6f\n", _name.CStr(), suffix, labels.CStr(), value);
+				}
+			}
+
+			const ov::String &GetText() const
+			{
+				return _text;
+			}
+
+		protected:
+			ov::String _name;
+			ov::String _text;
+		};
+
+		// The families of the metrics that all levels (server, vhost, app, stream) have
+		class CommonMetricFamilies
+		{
+		public:
+			explicit CommonMetricFamilies(const char *level)
+				: _bytes_in(ov::String::FormatString("ome_%s_bytes_in_total", level), "counter", "Total bytes received"),
+				  _bytes_out(ov::String::FormatString("ome_%s_bytes_out_total", level), "counter", "Total bytes sent"),
+				  _connections(ov::String::FormatString("ome_%s_connections", level), "gauge", "Number of the current connections"),
+				  _max_connections(ov::String::FormatString("ome_%s_max_connections", level), "gauge", "Maximum number of the connections"),
+				  _publisher_bytes_out(ov::String::FormatString("ome_%s_publisher_bytes_out_total", level), "counter", "Total bytes sent by the publisher"),
+				  _publisher_connections(ov::String::FormatString("ome_%s_publisher_connections", level), "gauge", "Number of the current connections of the publisher")
+			{
+			}
+
+			// If skip_idle_publishers is true, the publishers that have never sent any data are omitted to reduce the size of the snapshot
+			void Append(const ov::String &labels, const CommonMetrics &metrics, bool skip_idle_publishers)
+			{
+				auto snapshot = metrics.GetSnapshot();
+
+				_bytes_in.Append(labels, snapshot.total_bytes_in);
+				_bytes_out.Append(labels, snapshot.total_bytes_out);
+				_connections.Append(labels, static_cast<uint64_t>(snapshot.total_connections));
+				_max_connections.Append(labels, static_cast<uint64_t>(snapshot.max_total_connections));
+
+				auto separator = labels.IsEmpty() ? "" : ",";
+
+				for (int index = static_cast<int>(PublisherType::Unknown) + 1; index < static_cast<int>(PublisherType::NumberOfPublishers); index++)
+				{
+					auto type = static_cast<PublisherType>(index);
+					auto bytes_out = snapshot.bytes_out[index];
+					uint64_t connections = snapshot.connections[index];
+
+					if (skip_idle_publishers && (bytes_out == 0) && (connections == 0))
+					{
+						continue;
+					}
+
+					auto publisher_labels = ov::String::FormatString("%s%spublisher=\"%s\"", labels.CStr(), separator, StringFromPublisherType(type).CStr());
+
+					_publisher_bytes_out.Append(publisher_labels, bytes_out);
+					_publisher_connections.Append(publisher_labels, connections);
+				}
+			}
+
+			void AppendTo(ov::String *text) const
+			{
+				text->Append(_bytes_in.GetText());
+				text->Append(_bytes_out.GetText());
+				text->Append(_connections.GetText());
+				text->Append(_max_connections.GetText());
+				text->Append(_publisher_bytes_out.GetText());
+				text->Append(_publisher_connections.GetText());
+			}
+
+		protected:
+			MetricFamily _bytes_in;
+			MetricFamily _bytes_out;
+			MetricFamily _connections;
+			MetricFamily _max_connections;
+			MetricFamily _publisher_bytes_out;
+			MetricFamily _publisher_connections;
+		};
+
+		// Appends the latency histograms of the stream as summaries
+		void AppendLatencies(MetricFamily *family, const ov::String &labels, const StreamMetrics &metrics)
+		{
+			for (int index = 0; index < static_cast<int>(LatencyStage::NumberOfStages); index++)
+			{
+				auto stage = static_cast<LatencyStage>(index);
+				auto snapshot = metrics.GetLatencyHistogram(stage).GetSnapshot();
+
+				if (snapshot.count == 0)
+				{
+					continue;
+				}
+
+				auto stage_labels = ov::String::FormatString("%s,stage=\"%s\"", labels.CStr(), StringFromLatencyStage(stage).CStr());
+
+				family->Append(ov::String::FormatString("%s,quantile=\"0.5\"", stage_labels.CStr()), snapshot.p50_us / 1000000.0);
+				family->Append(ov::String::FormatString("%s,quantile=\"0.9\"", stage_labels.CStr()), snapshot.p90_us / 1000000.0);
+				family->Append(ov::String::FormatString("%s,quantile=\"0.99\"", stage_labels.CStr()), snapshot.p99_us / 1000000.0);
+				family->Append(ov::String::FormatString("%s,quantile=\"0.999\"", stage_labels.CStr()), snapshot.p999_us / 1000000.0);
+				family->Append(stage_labels, snapshot.sum_us / 1000000.0, "_sum");
+				family->Append(stage_labels, snapshot.count, "_count");
+			}
+		}
+
+		struct QueueStat
+		{
+			uint64_t count = 0;
+			uint64_t size = 0;
+			uint64_t peak = 0;
+		};
+	}  // namespace
+
+	PrometheusExporter::~PrometheusExporter()
+	{
+		Stop();
+	}
+
+	std::shared_ptr<const ov::String> PrometheusExporter::GetSnapshot()
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_snapshot_mutex);
+
+			if (_snapshot != nullptr)
+			{
+				return _snapshot;
+			}
+		}
+
+		// The exporter is used for the first time
+		UpdateSnapshot();
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_timer_mutex);
+
+			if (_is_timer_started == false)
+			{
+				_timer.Push(
+					[this](void *parameter) -> ov::DelayQueueAction {
+						UpdateSnapshot();
+						return ov::DelayQueueAction::Repeat;
+					},
+					PROMETHEUS_EXPORTER_REFRESH_INTERVAL_MSEC);
+
+				_is_timer_started = _timer.Start();
+			}
+		}
+
+		std::lock_guard<std::mutex> lock_guard(_snapshot_mutex);
+		return _snapshot;
+	}
+
+	void PrometheusExporter::Stop()
+	{
+		std::lock_guard<std::mutex> lock_guard(_timer_mutex);
+
+		if (_is_timer_started)
+		{
+			_timer.Stop();
+			_timer.Clear();
+			_is_timer_started = false;
+		}
+	}
+
+	void PrometheusExporter::UpdateSnapshot()
+	{
+		auto snapshot = MakeSnapshot(MonitorInstance->GetServerMetrics());
+
+		std::lock_guard<std::mutex> lock_guard(_snapshot_mutex);
+		_snapshot = std::move(snapshot);
+	}
+
+	std::shared_ptr<const ov::String> PrometheusExporter::MakeSnapshot(const std::shared_ptr<ServerMetrics> &server_metrics) const
+	{
+		ov::StopWatch stop_watch;
+		stop_watch.Start();
+
+		auto text = std::make_shared<ov::String>();
+
+		MetricFamily uptime("ome_server_uptime_seconds", "gauge", "Elapsed time since the server was started");
+
+		CommonMetricFamilies server_families("server");
+		CommonMetricFamilies vhost_families("vhost");
+		CommonMetricFamilies app_families("app");
+		CommonMetricFamilies stream_families("stream");
+		MetricFamily stream_latency("ome_stream_latency_seconds", "summary", "Latency from the ingest to each stage (only if the latency tracing is enabled)");
+
+		if (server_metrics != nullptr)
+		{
+			auto uptime_sec = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now() - server_metrics->GetServerStartedTime()).count();
+			uptime.Append(ov::String(), static_cast<uint64_t>(std::max<int64_t>(uptime_sec, 0)));
+
+			server_families.Append(ov::String(), *server_metrics, false);
+
+			for (const auto &host_item : server_metrics->GetHostMetricsList())
+			{
+				auto &host_metrics = host_item.second;
+				auto vhost_labels = ov::String::FormatString("vhost=\"%s\"", EscapeLabelValue(host_metrics->GetName()).CStr());
+
+				vhost_families.Append(vhost_labels, *host_metrics, false);
+
+				for (const auto &app_item : host_metrics->GetApplicationMetricsList())
+				{
+					auto &app_metrics = app_item.second;
+					auto app_labels = ov::String::FormatString("%s,app=\"%s\"", vhost_labels.CStr(), EscapeLabelValue(app_metrics->GetName().GetAppName()).CStr());
+
+					app_families.Append(app_labels, *app_metrics, false);
+
+					for (const auto &stream_item : app_metrics->GetStreamMetricsMap())
+					{
+						auto &stream_metrics = stream_item.second;
+
+						// The metrics of the output streams are accumulated to the input stream
+						if (stream_metrics->GetLinkedInputStream() != nullptr)
+						{
+							continue;
+						}
+
+						auto stream_labels = ov::String::FormatString("%s,stream=\"%s\"", app_labels.CStr(), EscapeLabelValue(stream_metrics->GetName()).CStr());
+
+						stream_families.Append(stream_labels, *stream_metrics, true);
+						AppendLatencies(&stream_latency, stream_labels, *stream_metrics);
+					}
+				}
+			}
+		}
+
+		// Queues that have the same alias (e.g. the queue of each session) are aggregated
+		std::map<ov::String, QueueStat> queue_stats;
+
+		ov::QueueRegistry::ForEach([&queue_stats](const ov::QueueInterface &queue) {
+			auto &stat = queue_stats[queue.GetAlias()];
+
+			stat.count++;
+			stat.size += queue.Size();
+			stat.peak = std::max<uint64_t>(stat.peak, queue.GetPeak());
+		});
+
+		MetricFamily queue_count("ome_queue_count", "gauge", "Number of the queues");
+		MetricFamily queue_size("ome_queue_size", "gauge", "Number of the items in the queues");
+		MetricFamily queue_peak_size("ome_queue_peak_size", "gauge", "Maximum number of the items in a queue");
+
+		for (const auto &[alias, stat] : queue_stats)
+		{
+			auto labels = ov::String::FormatString("queue=\"%s\"", EscapeLabelValue(alias).CStr());
+
+			queue_count.Append(labels, stat.count);
+			queue_size.Append(labels, stat.size);
+			queue_peak_size.Append(labels, stat.peak);
+		}
+
+		MetricFamily log_dropped("ome_log_dropped_total", "counter", "Number of the log messages dropped by the asynchronous logger");
+		log_dropped.Append(ov::String(), ov_log_get_dropped_count());
+
+		text->Append(uptime.GetText());
+		server_families.AppendTo(text.get());
+		vhost_families.AppendTo(text.get());
+		app_families.AppendTo(text.get());
+		stream_families.AppendTo(text.get());
+		text->Append(stream_latency.GetText());
+		text->Append(queue_count.GetText());
+		text->Append(queue_size.GetText());
+		text->Append(queue_peak_size.GetText());
+		text->Append(log_dropped.GetText());
+
+		MetricFamily snapshot_duration("ome_metrics_snapshot_duration_seconds", "gauge", "Time taken to generate this snapshot");
+		snapshot_duration.Append(ov::String(), static_cast<double>(stop_watch.Elapsed()) / 1000.0);
+		text->Append(snapshot_duration.GetText());
+
+		return text;
+	}
+}  // namespace mon
@@ -0,0 +1,49 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <mutex>
+
+// Interval to regenerate the snapshot of the metrics
+#define PROMETHEUS_EXPORTER_REFRESH_INTERVAL_MSEC (5 * 1000)
+// Content-Type of the Prometheus text exposition format
+#define PROMETHEUS_EXPORTER_CONTENT_TYPE "text/plain; version=0.0.4; charset=utf-8"
+
+namespace mon
+{
+	class ServerMetrics;
+
+	// Generates the metrics in the Prometheus text exposition format.
+	// The text is regenerated periodically by a timer thread, so a scrape only copies the last snapshot
+	// regardless of the number of the streams, and never walks the metrics tree on the request thread.
+	class PrometheusExporter
+	{
+	public:
+		~PrometheusExporter();
+
+		// Returns the last snapshot.
+		// The first call generates the snapshot synchronously and starts the refresh timer.
+		std::shared_ptr<const ov::String> GetSnapshot();
+
+		void Stop();
+
+	protected:
+		std::shared_ptr<const ov::String> MakeSnapshot(const std::shared_ptr<ServerMetrics> &server_metrics) const;
+		void UpdateSnapshot();
+
+		std::mutex _snapshot_mutex;
+		std::shared_ptr<const ov::String> _snapshot;
+
+		std::mutex _timer_mutex;
+		bool _is_timer_started = false;
+		ov::DelayQueue _timer{"MonPromExport"};
+	};
+}  // namespace mon
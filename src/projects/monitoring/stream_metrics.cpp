@@ -95,6 +95,27 @@ namespace mon
 		}
 	}
 
+	void StreamMetrics::RecordLatency(LatencyStage stage, int64_t latency_us)
+	{
+		_latency_histograms[static_cast<size_t>(stage)].Record(latency_us);
+
+		// If this stream is child then send event to parent
+		auto origin_stream_info = GetLinkedInputStream();
+		if(origin_stream_info != nullptr)
+		{
+			auto origin_stream_metric = _app_metrics->GetStreamMetrics(*origin_stream_info);
+			if(origin_stream_metric != nullptr)
+			{
+				origin_stream_metric->RecordLatency(stage, latency_us);
+			}
+		}
+	}
+
+	const LatencyHistogram &StreamMetrics::GetLatencyHistogram(LatencyStage stage) const
+	{
+		return _latency_histograms[static_cast<size_t>(stage)];
+	}
+
 	void StreamMetrics::OnSessionConnected(PublisherType type)
 	{
 		CommonMetrics::OnSessionConnected(type);
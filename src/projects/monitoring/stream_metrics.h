@@ -9,6 +9,7 @@
 #include "base/info/info.h"
 #include "base/info/stream.h"
 #include "common_metrics.h"
+#include "latency_histogram.h"
 
 namespace mon
 {
@@ -53,11 +54,19 @@ namespace mon
 		void OnSessionConnected(PublisherType type) override;
 		void OnSessionDisconnected(PublisherType type) override;
 		void OnSessionsDisconnected(PublisherType type, uint64_t number_of_sessions) override;
+
+		// The latency is also recorded to the input stream
+		void RecordLatency(LatencyStage stage, int64_t latency_us);
+		const LatencyHistogram &GetLatencyHistogram(LatencyStage stage) const;
+
 	private:
 		// Related to origin, From Provider
 		std::atomic<int64_t> _connection_time_to_origin_msec = 0;
 		std::atomic<int64_t> _subscribe_time_from_origin_msec = 0;
 
+		// Latency from the ingest to each stage
+		std::array<LatencyHistogram, static_cast<size_t>(LatencyStage::NumberOfStages)> _latency_histograms;
+
 		// If this stream is from Provider(input stream) it has multiple output streams
 		std::vector<std::shared_ptr<StreamMetrics>> _output_stream_metrics;
 
@@ -10,4 +10,5 @@
 
 #include "enums.h"
 #include "interfaces.h"
+#include "pull_request_tracker.h"
 #include "structures.h"
@@ -0,0 +1,230 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "domain_matcher.h"
+
+// To prevent the cache from growing indefinitely with arbitrary Host headers
+#define MAX_DOMAIN_CACHE_SIZE 4096
+
+namespace ocst
+{
+	void DomainMatcher::Clear()
+	{
+		_next_order = 0;
+
+		_exact_map.clear();
+		_wildcard_trie.children.clear();
+		_wildcard_trie.wildcard.reset();
+		_catch_all.reset();
+		_pattern_list.clear();
+
+		auto lock_guard = std::lock_guard(_cache_mutex);
+		_cache.clear();
+	}
+
+	void DomainMatcher::AddPattern(const ov::String &pattern, size_t value)
+	{
+		Entry entry;
+		entry.order = _next_order++;
+		entry.value = value;
+
+		if ((pattern.IndexOf('*') < 0) && (pattern.IndexOf('?') < 0))
+		{
+			// emplace() keeps the earlier one if the name is duplicated
+			_exact_map.emplace(pattern, entry);
+		}
+		else if (pattern == "*")
+		{
+			if (_catch_all.has_value() == false)
+			{
+				_catch_all = entry;
+			}
+		}
+		else if (pattern.HasPrefix("*.") && (pattern.IndexOf('*', 1) < 0) && (pattern.IndexOf('?') < 0))
+		{
+			auto labels = pattern.Substring(2).Split(".");
+			auto node = &_wildcard_trie;
+
+			for (auto label = labels.rbegin(); label != labels.rend(); ++label)
+			{
+				auto &child = node->children[*label];
+				if (child == nullptr)
+				{
+					child = std::make_shared<TrieNode>();
+				}
+
+				node = child.get();
+			}
+
+			if (node->wildcard.has_value() == false)
+			{
+				node->wildcard = entry;
+			}
+		}
+		else
+		{
+			_pattern_list.emplace_back(pattern, entry);
+		}
+
+		auto lock_guard = std::lock_guard(_cache_mutex);
+		_cache.clear();
+	}
+
+	bool DomainMatcher::Match(const ov::String &domain, size_t *value) const
+	{
+		std::optional<Entry> matched;
+
+		{
+			auto lock_guard = std::shared_lock(_cache_mutex);
+			auto item = _cache.find(domain);
+
+			if (item != _cache.end())
+			{
+				matched = item->second;
+				lock_guard.unlock();
+
+				if (matched.has_value() && (value != nullptr))
+				{
+					*value = matched->value;
+				}
+
+				return matched.has_value();
+			}
+		}
+
+		matched = MatchInternal(domain);
+
+		{
+			auto lock_guard = std::lock_guard(_cache_mutex);
+
+			if (_cache.size() >= MAX_DOMAIN_CACHE_SIZE)
+			{
+				_cache.clear();
+			}
+
+			_cache[domain] = matched;
+		}
+
+		if (matched.has_value() && (value != nullptr))
+		{
+			*value = matched->value;
+		}
+
+		return matched.has_value();
+	}
+
+	std::optional<DomainMatcher::Entry> DomainMatcher::MatchInternal(const ov::String &domain) const
+	{
+		std::optional<Entry> matched;
+
+		auto exact_item = _exact_map.find(domain);
+		if (exact_item != _exact_map.end())
+		{
+			matched = exact_item->second;
+		}
+
+		SelectEarlier(_catch_all, &matched);
+
+		if (_wildcard_trie.children.empty() == false)
+		{
+			auto labels = domain.Split(".");
+			auto node = &_wildcard_trie;
+			size_t depth = 0;
+
+			for (auto label = labels.rbegin(); label != labels.rend(); ++label)
+			{
+				auto child = node->children.find(*label);
+				if (child == node->children.end())
+				{
+					break;
+				}
+
+				node = child->second.get();
+				depth++;
+
+				// "*.airensoft.com" needs at least one more label before ".airensoft.com"
+				if (depth < labels.size())
+				{
+					SelectEarlier(node->wildcard, &matched);
+				}
+			}
+		}
+
+		for (auto &[pattern, entry] : _pattern_list)
+		{
+			if (matched.has_value() && (matched->order < entry.order))
+			{
+				// _pattern_list is ordered, so the rest cannot be selected
+				break;
+			}
+
+			if (MatchWildcard(pattern.CStr(), domain.CStr()))
+			{
+				matched = entry;
+				break;
+			}
+		}
+
+		return matched;
+	}
+
+	bool DomainMatcher::MatchWildcard(const char *pattern, const char *str)
+	{
+		while (*pattern != '\0')
+		{
+			switch (*pattern)
+			{
+				case '*':
+					// Try to match the rest of the pattern at every position
+					while (true)
+					{
+						if (MatchWildcard(pattern + 1, str))
+						{
+							return true;
+						}
+
+						if (*str == '\0')
+						{
+							return false;
+						}
+
+						str++;
+					}
+
+				case '?':
+					return MatchWildcard(pattern + 1, str) ||
+						   ((*str != '\0') && MatchWildcard(pattern + 1, str + 1));
+
+				default:
+					if (*pattern != *str)
+					{
+						return false;
+					}
+
+					pattern++;
+					str++;
+					break;
+			}
+		}
+
+		return (*str == '\0');
+	}
+
+	void DomainMatcher::SelectEarlier(const std::optional<Entry> &candidate, std::optional<Entry> *matched)
+	{
+		if (candidate.has_value() == false)
+		{
+			return;
+		}
+
+		if ((matched->has_value() == false) || (candidate->order < (*matched)->order))
+		{
+			*matched = candidate;
+		}
+	}
+}  // namespace ocst
@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <optional>
+#include <unordered_map>
+
+namespace ocst
+{
+	// Matches a domain name against the host names in the configuration (eg: airensoft.com, *.airensoft.com, *)
+	//
+	// - Exact names are found with a hash lookup
+	// - "*.<domain>" names are found by walking a trie of the reversed labels
+	// - Other wildcard names (eg: "ome?.airensoft.com") are matched one by one
+	//
+	// If several names match, the name added first wins (same as the order of <Host><Names>).
+	// The results are cached until the matcher is rebuilt.
+	class DomainMatcher
+	{
+	public:
+		void Clear();
+
+		// `value` is returned by Match() when the `pattern` matches
+		void AddPattern(const ov::String &pattern, size_t value);
+
+		bool Match(const ov::String &domain, size_t *value) const;
+
+	protected:
+		struct Entry
+		{
+			size_t order = 0;
+			size_t value = 0;
+		};
+
+		struct TrieNode
+		{
+			std::unordered_map<ov::String, std::shared_ptr<TrieNode>> children;
+			// Set if "*.<labels to this node>" is configured
+			std::optional<Entry> wildcard;
+		};
+
+		std::optional<Entry> MatchInternal(const ov::String &domain) const;
+
+		// '*' matches any sequence, '?' matches zero or one character
+		static bool MatchWildcard(const char *pattern, const char *str);
+		static void SelectEarlier(const std::optional<Entry> &candidate, std::optional<Entry> *matched);
+
+		size_t _next_order = 0;
+
+		std::unordered_map<ov::String, Entry> _exact_map;
+		TrieNode _wildcard_trie;
+		// "*"
+		std::optional<Entry> _catch_all;
+		// The names that cannot be placed in the above
+		std::vector<std::pair<ov::String, Entry>> _pattern_list;
+
+		mutable std::shared_mutex _cache_mutex;
+		mutable std::unordered_map<ov::String, std::optional<Entry>> _cache;
+	};
+}  // namespace ocst
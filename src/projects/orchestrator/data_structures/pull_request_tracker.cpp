@@ -0,0 +1,108 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "pull_request_tracker.h"
+
+#include "../orchestrator_private.h"
+
+namespace ocst
+{
+	PullRequestTracker::PullRequestTracker(int wait_timeout_ms, int negative_cache_ttl_ms)
+		: _wait_timeout(wait_timeout_ms),
+		  _negative_cache_ttl(negative_cache_ttl_ms)
+	{
+	}
+
+	bool PullRequestTracker::IsNegativeCached(const ov::String &key, const std::chrono::steady_clock::time_point &now)
+	{
+		auto failure = _failure_map.find(key);
+
+		if (failure == _failure_map.end())
+		{
+			return false;
+		}
+
+		if (failure->second <= now)
+		{
+			// Expired
+			_failure_map.erase(failure);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool PullRequestTracker::Pull(const ov::String &key, bool use_negative_cache, const PullFunction &pull_function)
+	{
+		std::shared_ptr<PullingItem> item;
+
+		{
+			auto lock = std::unique_lock(_mutex);
+
+			if (use_negative_cache && IsNegativeCached(key, std::chrono::steady_clock::now()))
+			{
+				logtd("The previous pull of %s failed recently, skipping", key.CStr());
+				return false;
+			}
+
+			auto pulling_item = _pulling_map.find(key);
+
+			if (pulling_item != _pulling_map.end())
+			{
+				// Another request is pulling the stream - wait for the result
+				item = pulling_item->second;
+
+				logti("Waiting for the pull of %s in progress", key.CStr());
+
+				if (item->condition.wait_for(lock, _wait_timeout, [&item]() -> bool { return item->completed; }) == false)
+				{
+					logtw("Timed out while waiting for the pull of %s (%lld ms)", key.CStr(), static_cast<long long>(_wait_timeout.count()));
+					return false;
+				}
+
+				return item->result;
+			}
+
+			item = std::make_shared<PullingItem>();
+			_pulling_map[key] = item;
+		}
+
+		auto result = pull_function();
+
+		{
+			auto lock = std::lock_guard(_mutex);
+
+			item->completed = true;
+			item->result = result;
+			_pulling_map.erase(key);
+
+			if (use_negative_cache && (result == false))
+			{
+				_failure_map[key] = std::chrono::steady_clock::now() + _negative_cache_ttl;
+			}
+		}
+
+		item->condition.notify_all();
+
+		return result;
+	}
+
+	void PullRequestTracker::Invalidate(const ov::String &key)
+	{
+		auto lock = std::lock_guard(_mutex);
+
+		_failure_map.erase(key);
+	}
+
+	void PullRequestTracker::Clear()
+	{
+		auto lock = std::lock_guard(_mutex);
+
+		_failure_map.clear();
+	}
+}  // namespace ocst
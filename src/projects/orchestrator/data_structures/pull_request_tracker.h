@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <unordered_map>
+
+// How long the subsequent requests wait for the pull that is already in progress
+#define OCST_PULL_REQUEST_WAIT_TIMEOUT_MS (10 * 1000)
+// How long a failed pull is remembered. Requests for the stream fail immediately during this period.
+#define OCST_PULL_REQUEST_NEGATIVE_CACHE_TTL_MS (3 * 1000)
+
+namespace ocst
+{
+	// Coalesces concurrent pull requests for the same stream (single-flight)
+	//
+	// The first request for a key performs the pull, and the requests that arrive while it is in progress
+	// wait for it and share its result instead of contacting the origin again.
+	// Failed pulls are remembered for a while (negative cache), so a burst of viewers for a stream
+	// that does not exist in the origin doesn't hammer the origin.
+	class PullRequestTracker
+	{
+	public:
+		using PullFunction = std::function<bool()>;
+
+		PullRequestTracker(int wait_timeout_ms = OCST_PULL_REQUEST_WAIT_TIMEOUT_MS, int negative_cache_ttl_ms = OCST_PULL_REQUEST_NEGATIVE_CACHE_TTL_MS);
+
+		// Calls `pull_function` if there is no pull in progress for the `key`.
+		// Otherwise, waits for the pull in progress and returns its result.
+		//
+		// @param use_negative_cache If true, fails immediately while the previous failure for the `key` is cached,
+		//                           and the failure of this pull is cached
+		//
+		// @return The result of the pull (false if timed out while waiting)
+		bool Pull(const ov::String &key, bool use_negative_cache, const PullFunction &pull_function);
+
+		// Forget the cached failure (eg: the stream is created by another path)
+		void Invalidate(const ov::String &key);
+		void Clear();
+
+	protected:
+		struct PullingItem
+		{
+			bool completed = false;
+			bool result = false;
+			std::condition_variable condition;
+		};
+
+		bool IsNegativeCached(const ov::String &key, const std::chrono::steady_clock::time_point &now);
+
+		std::chrono::milliseconds _wait_timeout;
+		std::chrono::milliseconds _negative_cache_ttl;
+
+		std::mutex _mutex;
+		// key: <vhost#app/stream>, value: the pull in progress
+		std::unordered_map<ov::String, std::shared_ptr<PullingItem>> _pulling_map;
+		// key: <vhost#app/stream>, value: the time the cached failure expires
+		std::unordered_map<ov::String, std::chrono::steady_clock::time_point> _failure_map;
+	};
+}  // namespace ocst
@@ -64,7 +64,6 @@ namespace ocst
 		: name(name),
 		  state(ItemState::New)
 	{
-		UpdateRegex();
 	}
 
 	bool Host::IsValid() const
@@ -72,31 +71,6 @@ namespace ocst
 		return state != ItemState::Unknown;
 	}
 
-	bool Host::UpdateRegex()
-	{
-		// Escape special characters: '[', '\', '.', '/', '+', '{', '}', '$', '^', '|' to \<char>
-		auto special_characters = std::regex(R"([[\\.\/+{}$^|])");
-		ov::String escaped = std::regex_replace(name.CStr(), special_characters, R"(\$&)").c_str();
-		// Change '*'/'?' to .<char>
-		escaped = escaped.Replace(R"(*)", R"(.*)");
-		escaped = escaped.Replace(R"(?)", R"(.?)");
-		escaped.Prepend("^");
-		escaped.Append("$");
-
-		std::regex expression;
-
-		try
-		{
-			regex_for_domain = std::regex(escaped);
-		}
-		catch (std::exception &e)
-		{
-			return false;
-		}
-
-		return true;
-	}
-
 	//--------------------------------------------------------------------
 	// Application
 	//--------------------------------------------------------------------
@@ -167,6 +141,28 @@ namespace ocst
 		}
 	}
 
+	void VirtualHost::UpdateHostMatcher()
+	{
+		host_matcher.Clear();
+
+		for (size_t index = 0; index < host_list.size(); index++)
+		{
+			host_matcher.AddPattern(host_list[index].name, index);
+		}
+	}
+
+	Host *VirtualHost::FindHost(const ov::String &host_name)
+	{
+		size_t index;
+
+		if (host_matcher.Match(host_name, &index) && (index < host_list.size()))
+		{
+			return &(host_list[index]);
+		}
+
+		return nullptr;
+	}
+
 	bool VirtualHost::MarkAllAs(ItemState expected_old_state, ItemState state)
 	{
 		if (this->state != expected_old_state)
@@ -11,8 +11,8 @@
 #include <base/info/host.h>
 #include <base/mediarouter/mediarouter_application_observer.h>
 #include <modules/origin_map_client/origin_map_client.h>
-#include <regex>
 
+#include "domain_matcher.h"
 #include "interfaces.h"
 
 namespace ocst
@@ -81,11 +81,9 @@ namespace ocst
 		Host(const ov::String &name);
 
 		bool IsValid() const;
-		bool UpdateRegex();
 
 		// The name of Host in the configuraiton (eg: *, *.airensoft.com)
 		ov::String name;
-		std::regex regex_for_domain;
 
 		typedef std::map<info::stream_id_t, std::shared_ptr<Stream>> stream_map_t;
 
@@ -135,6 +133,11 @@ namespace ocst
 		void MarkAllAs(ItemState state);
 		bool MarkAllAs(ItemState expected_old_state, ItemState state);
 
+		// Must be called whenever host_list is changed
+		void UpdateHostMatcher();
+		// Returns the first host in host_list that matches host_name
+		Host *FindHost(const ov::String &host_name);
+
 		// Origin Host Info
 		info::Host host_info;
 
@@ -143,6 +146,8 @@ namespace ocst
 
 		// Host list
 		std::vector<Host> host_list;
+		// Matches a domain to the index of host_list
+		DomainMatcher host_matcher;
 
 		// Origin list
 		std::vector<Origin> origin_list;
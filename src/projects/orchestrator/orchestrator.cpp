@@ -58,6 +58,8 @@ namespace ocst
 
 		_virtual_host_list.clear();
 		_virtual_host_map.clear();
+		UpdateDomainMatchers();
+		_pull_request_tracker.Clear();
 
 		mon::Monitoring::GetInstance()->Release();
 
@@ -356,6 +358,8 @@ namespace ocst
 			}
 		}
 
+		UpdateDomainMatchers();
+
 		logtd("All items are applied");
 
 		return result;
@@ -441,24 +445,16 @@ namespace ocst
 
 	ov::String Orchestrator::GetVhostNameFromDomain(const ov::String &domain_name) const
 	{
-		// TODO(dimiden): I think it would be nice to create a VHost cache for performance
-
 		if (domain_name.IsEmpty() == false)
 		{
 			auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
 
 			// Search for the domain corresponding to domain_name
-
-			// CAUTION: This code is important to order, so don't use _virtual_host_map
-			for (auto &vhost_item : _virtual_host_list)
+			// (The matcher keeps the order of _virtual_host_list)
+			auto vhost = FindVirtualHostForDomain(domain_name);
+			if (vhost != nullptr)
 			{
-				for (auto &host_item : vhost_item->host_list)
-				{
-					if (std::regex_match(domain_name.CStr(), host_item.regex_for_domain))
-					{
-						return vhost_item->name;
-					}
-				}
+				return vhost->name;
 			}
 		}
 
@@ -488,10 +484,28 @@ namespace ocst
 		return OrchestratorInternal::GetUrlListForLocation(vhost_app_name, host_name, stream_name, url_list, nullptr, nullptr);
 	}
 
+	ov::String Orchestrator::GetPullRequestKey(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		return ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream_name.CStr());
+	}
+
 	bool Orchestrator::RequestPullStream(
 			const std::shared_ptr<const ov::Url> &request_from,
 			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
 			const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties)
+	{
+		// The URL is specified explicitly (eg: by API), so the failure is not cached
+		return _pull_request_tracker.Pull(
+			GetPullRequestKey(vhost_app_name, stream_name), false,
+			[&]() -> bool {
+				return PullStreamFromUrlList(request_from, vhost_app_name, stream_name, url_list, offset, properties);
+			});
+	}
+
+	bool Orchestrator::PullStreamFromUrlList(
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+			const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties)
 	{
 		if (url_list.empty() == true)
 		{
@@ -620,6 +634,20 @@ namespace ocst
 		const std::shared_ptr<const ov::Url> &request_from,
 		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
 		off_t offset)
+	{
+		// Requests from viewers come in bursts when a popular stream is started,
+		// so only the first request contacts the origin and the rest share its result
+		return _pull_request_tracker.Pull(
+			GetPullRequestKey(vhost_app_name, stream_name), true,
+			[&]() -> bool {
+				return PullStreamFromOriginMap(request_from, vhost_app_name, stream_name, offset);
+			});
+	}
+
+	bool Orchestrator::PullStreamFromOriginMap(
+		const std::shared_ptr<const ov::Url> &request_from,
+		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+		off_t offset)
 	{
 		std::shared_ptr<PullProviderModuleInterface> provider_module;
 		auto app_info = info::Application::GetInvalidApplication();
@@ -811,6 +839,12 @@ namespace ocst
 	{
 		logtd("%s/%s stream of %s is created", app_info.GetName().CStr(), info->GetName().CStr(), info->IsInputStream()?"inbound":"outbound");
 
+		if (info->IsInputStream())
+		{
+			// The stream is available now, so the failure of the previous pull is no longer valid
+			_pull_request_tracker.Invalidate(GetPullRequestKey(app_info.GetName(), info->GetName()));
+		}
+
 		return true;
 	}
 
@@ -136,6 +136,9 @@ namespace ocst
 
 		/// Pull a stream using Origin map with offset
 		///
+		/// If the same stream is already being pulled, waits for it instead of contacting the origin again.
+		/// A failed pull is cached for a while, and the requests during that period fail immediately.
+		///
 		/// @param request_from Source from which RequestPullStream() invoked (Mainly provided when requested by Publisher)
 		/// @param vhost_app_name When the URL is pulled, its stream is created in this vhost_name and app_name
 		/// @param stream_name When the URL is pulled, its stream is created in this stream_name
@@ -183,7 +186,22 @@ namespace ocst
 		bool OnStreamUpdated(const info::Application &app_info, const std::shared_ptr<info::Stream> &info) override;
 
 	protected:
+		static ov::String GetPullRequestKey(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
+		bool PullStreamFromUrlList(
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+			const std::vector<ov::String> &url_list, off_t offset,
+			const std::shared_ptr<pvd::PullStreamProperties> &properties);
+		bool PullStreamFromOriginMap(
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+			off_t offset);
+
 		std::recursive_mutex _module_list_mutex;
 		mutable std::recursive_mutex _virtual_host_map_mutex;
+
+		// Coalesces concurrent pull requests for the same stream
+		PullRequestTracker _pull_request_tracker;
 	};
 }  // namespace ocst
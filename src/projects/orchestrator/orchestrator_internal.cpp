@@ -465,6 +465,8 @@ namespace ocst
 		_virtual_host_map[vhost_info.GetName()] = vhost;
 		_virtual_host_list.push_back(vhost);
 
+		UpdateDomainMatchers();
+
 		// Notification 
 		for (auto &module : _module_list)
 		{
@@ -499,6 +501,7 @@ namespace ocst
 				_virtual_host_list.erase(i);
 				_virtual_host_map.erase(vhost_item->name);
 
+				UpdateDomainMatchers();
 
 				// Notification
 				for (auto &module : _module_list)
@@ -528,6 +531,35 @@ namespace ocst
 		return Result::NotExists;
 	}
 
+	void OrchestratorInternal::UpdateDomainMatchers()
+	{
+		_virtual_host_matcher.Clear();
+
+		for (size_t index = 0; index < _virtual_host_list.size(); index++)
+		{
+			auto &vhost = _virtual_host_list[index];
+
+			vhost->UpdateHostMatcher();
+
+			for (auto &host : vhost->host_list)
+			{
+				_virtual_host_matcher.AddPattern(host.name, index);
+			}
+		}
+	}
+
+	std::shared_ptr<VirtualHost> OrchestratorInternal::FindVirtualHostForDomain(const ov::String &domain_name) const
+	{
+		size_t index;
+
+		if (_virtual_host_matcher.Match(domain_name, &index) && (index < _virtual_host_list.size()))
+		{
+			return _virtual_host_list[index];
+		}
+
+		return nullptr;
+	}
+
 	std::shared_ptr<ocst::VirtualHost> OrchestratorInternal::GetVirtualHost(const ov::String &vhost_name)
 	{
 		auto vhost_item = _virtual_host_map.find(vhost_name);
@@ -589,22 +621,13 @@ namespace ocst
 		Host *found_matched_host = nullptr;
 		Origin *found_matched_origin = nullptr;
 
-		auto &host_list = vhost->host_list;
 		auto &origin_list = vhost->origin_list;
 
 		ov::String location = ov::String::FormatString("/%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
 
 		// Find the host using the location
-		for (auto &host : host_list)
-		{
-			logtd("Trying to find the item from host_list that match host_name: %s", host_name.CStr());
-
-			if (std::regex_match(host_name.CStr(), host.regex_for_domain))
-			{
-				found_matched_host = &host;
-				break;
-			}
-		}
+		logtd("Trying to find the item from host_list that match host_name: %s", host_name.CStr());
+		found_matched_host = vhost->FindHost(host_name);
 
 		if (found_matched_host == nullptr)
 		{
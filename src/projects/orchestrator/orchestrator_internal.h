@@ -65,6 +65,12 @@ namespace ocst
 		Result CreateVirtualHost(const info::Host &vhost_info);
 		Result DeleteVirtualHost(const info::Host &vhost_info);
 
+		/// Rebuilds the domain lookup structures of all VirtualHosts.
+		/// Must be called whenever _virtual_host_list or the host_list of a VirtualHost is changed.
+		void UpdateDomainMatchers();
+		/// Finds the first VirtualHost that has a host matching domain_name
+		std::shared_ptr<VirtualHost> FindVirtualHostForDomain(const ov::String &domain_name) const;
+
 		Result CreateApplication(const ov::String &vhost_name, const info::Application &app_info);
 		Result CreateApplication(const info::VHostAppName &vhost_app_name, info::Application *app_info);
 
@@ -90,6 +96,8 @@ namespace ocst
 		std::map<ov::String, std::shared_ptr<VirtualHost>> _virtual_host_map;
 		// ordered vhost list
 		std::vector<std::shared_ptr<VirtualHost>> _virtual_host_list;
+		// Matches a domain to the index of _virtual_host_list
+		DomainMatcher _virtual_host_matcher;
 
 		void StorePullStream(const std::shared_ptr<pvd::Stream> &stream);
 		void RemovePullStream(const info::stream_id_t &stream_id);
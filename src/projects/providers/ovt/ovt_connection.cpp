@@ -0,0 +1,557 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ovt_connection.h"
+
+#include <modules/ovt_packetizer/ovt_packetizer.h>
+#include <sys/eventfd.h>
+
+#define OV_LOG_TAG "OvtConnection"
+
+namespace pvd
+{
+	//--------------------------------------------------------------------
+	// OvtChannel
+	//--------------------------------------------------------------------
+	OvtChannel::OvtChannel(size_t max_buffered_bytes)
+		: _max_buffered_bytes(max_buffered_bytes)
+	{
+		_event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (_event_fd == -1)
+		{
+			logte("Could not create eventfd for the channel: %s", ov::Error::CreateErrorFromErrno()->What());
+		}
+	}
+
+	OvtChannel::~OvtChannel()
+	{
+		if (_event_fd != -1)
+		{
+			::close(_event_fd);
+			_event_fd = -1;
+		}
+	}
+
+	int OvtChannel::GetEventFd() const
+	{
+		return _event_fd;
+	}
+
+	uint32_t OvtChannel::GetSessionId() const
+	{
+		return _session_id;
+	}
+
+	void OvtChannel::SetSessionId(uint32_t session_id)
+	{
+		_session_id = session_id;
+	}
+
+	void OvtChannel::PushPacket(const std::shared_ptr<OvtPacket> &packet, bool bypass_flow_control)
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+
+			if (_disconnected)
+			{
+				return;
+			}
+
+			if (bypass_flow_control == false)
+			{
+				if (_discarding)
+				{
+					// Drop the rest of the frame that was being received when the queue overflowed
+					if (packet->Marker())
+					{
+						_discarding = false;
+					}
+
+					return;
+				}
+
+				if ((_buffered_bytes + packet->PacketLength()) > _max_buffered_bytes)
+				{
+					logtw("The stream of session %u does not consume packets fast enough (%zu bytes are buffered), the oldest frames are discarded", _session_id.load(), _buffered_bytes);
+
+					_is_reset = true;
+
+					if (DiscardOldestFrames(packet->PacketLength()) == false)
+					{
+						_discarding = (packet->Marker() == false);
+
+						Signal();
+						return;
+					}
+				}
+			}
+
+			_queue.push_back({packet->GetData(), packet->PacketLength(), packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET, packet->Marker()});
+			_buffered_bytes += packet->PacketLength();
+		}
+
+		_queue_condition.notify_one();
+		Signal();
+	}
+
+	bool OvtChannel::DiscardOldestFrames(size_t required_bytes)
+	{
+		// The front of the queue may be the rest of a frame whose beginning has been popped,
+		// but the stream resets its depacketizer with is_reset anyway
+		bool frame_boundary = true;
+
+		auto it = _queue.begin();
+		while ((it != _queue.end()) && (((_buffered_bytes + required_bytes) > _max_buffered_bytes) || (frame_boundary == false)))
+		{
+			if (it->is_media == false)
+			{
+				++it;
+				continue;
+			}
+
+			frame_boundary = it->marker;
+			_buffered_bytes -= it->length;
+			it = _queue.erase(it);
+		}
+
+		// Every media packet has been discarded in the middle of the frame of the new packet, or the messages alone fill the queue
+		return frame_boundary && ((_buffered_bytes + required_bytes) <= _max_buffered_bytes);
+	}
+
+	void OvtChannel::Disconnect()
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_queue_mutex);
+			_disconnected = true;
+		}
+
+		_queue_condition.notify_all();
+		Signal();
+	}
+
+	bool OvtChannel::PopPackets(std::vector<std::shared_ptr<const ov::Data>> &packets, bool *is_reset, int timeout_msec)
+	{
+		std::unique_lock<std::mutex> lock(_queue_mutex);
+
+		if (timeout_msec > 0)
+		{
+			_queue_condition.wait_for(lock, std::chrono::milliseconds(timeout_msec), [this]() -> bool {
+				return (_queue.empty() == false) || _disconnected;
+			});
+		}
+
+		ClearSignal();
+
+		if (is_reset != nullptr)
+		{
+			*is_reset = _is_reset;
+		}
+		_is_reset = false;
+
+		for (const auto &item : _queue)
+		{
+			packets.push_back(item.data);
+		}
+		_queue.clear();
+		_buffered_bytes = 0;
+
+		return (_disconnected == false) || (packets.empty() == false);
+	}
+
+	void OvtChannel::Signal()
+	{
+		if (_event_fd != -1)
+		{
+			uint64_t value = 1;
+			[[maybe_unused]] auto result = ::write(_event_fd, &value, sizeof(value));
+		}
+	}
+
+	void OvtChannel::ClearSignal()
+	{
+		if (_event_fd != -1)
+		{
+			uint64_t value;
+			[[maybe_unused]] auto result = ::read(_event_fd, &value, sizeof(value));
+		}
+	}
+
+	//--------------------------------------------------------------------
+	// OvtConnection
+	//--------------------------------------------------------------------
+	std::shared_ptr<OvtConnection> OvtConnection::Create(const std::shared_ptr<ov::SocketPool> &socket_pool, const ov::SocketAddress &address)
+	{
+		auto connection = std::make_shared<OvtConnection>(address);
+		if (connection->Connect(socket_pool) == false)
+		{
+			return nullptr;
+		}
+
+		return connection;
+	}
+
+	OvtConnection::OvtConnection(const ov::SocketAddress &address)
+		: _address(address)
+	{
+		_packet_buffer = std::make_shared<ov::Data>(INIT_PACKET_BUFFER_SIZE);
+	}
+
+	OvtConnection::~OvtConnection()
+	{
+		Close();
+	}
+
+	bool OvtConnection::Connect(const std::shared_ptr<ov::SocketPool> &socket_pool)
+	{
+		if (socket_pool == nullptr)
+		{
+			return false;
+		}
+
+		_socket = socket_pool->AllocSocket();
+		if (_socket == nullptr)
+		{
+			logte("Could not create a socket for %s", _address.ToString().CStr());
+			return false;
+		}
+
+		_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_NODELAY, 1);
+		_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_QUICKACK, 1);
+		_socket->MakeBlocking();
+
+		// The receiver wakes up periodically to check whether the connection is closed
+		struct timeval tv = {1, 500000};  // 1.5 sec
+		_socket->SetRecvTimeout(tv);
+
+		auto error = _socket->Connect(_address, 1500);
+		if (error != nullptr)
+		{
+			logte("Cannot connect to origin server (%s) : %s", error->GetMessage().CStr(), _address.ToString().CStr());
+			_socket->Close();
+			return false;
+		}
+
+		_running = true;
+		_receive_thread = std::thread(&OvtConnection::ReceiveThread, this);
+		pthread_setname_np(_receive_thread.native_handle(), "OvtConnection");
+
+		logti("A multiplexed OVT connection to %s is established", _address.ToString().CStr());
+
+		return true;
+	}
+
+	bool OvtConnection::IsConnected() const
+	{
+		return _running;
+	}
+
+	size_t OvtConnection::GetChannelCount() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_channel_mutex);
+		return _channel_count;
+	}
+
+	std::shared_ptr<OvtChannel> OvtConnection::CreateChannel()
+	{
+		auto channel = std::make_shared<OvtChannel>(OVT_CHANNEL_MAX_BUFFERED_BYTES);
+
+		std::lock_guard<std::mutex> lock_guard(_channel_mutex);
+		_channel_count++;
+
+		return channel;
+	}
+
+	void OvtConnection::ReleaseChannel(const std::shared_ptr<OvtChannel> &channel)
+	{
+		if (channel == nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock_guard(_channel_mutex);
+
+		auto item = _channel_map.find(channel->GetSessionId());
+		if ((item != _channel_map.end()) && (item->second == channel))
+		{
+			_channel_map.erase(item);
+		}
+
+		for (auto it = _pending_request_map.begin(); it != _pending_request_map.end();)
+		{
+			if (it->second == channel)
+			{
+				it = _pending_request_map.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		if (_channel_count > 0)
+		{
+			_channel_count--;
+		}
+	}
+
+	uint32_t OvtConnection::IssueRequestId()
+	{
+		return ++_last_request_id;
+	}
+
+	bool OvtConnection::SendRequest(const std::shared_ptr<OvtChannel> &channel, const Json::Value &request)
+	{
+		if (IsConnected() == false)
+		{
+			return false;
+		}
+
+		auto request_id = request["id"].asUInt();
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_channel_mutex);
+			_pending_request_map[request_id] = channel;
+		}
+
+		OvtPacketizer packetizer;
+		if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), ov::Json::Stringify(request).ToData(false)) == false)
+		{
+			return false;
+		}
+
+		// The packets of a message must not be interleaved with the packets of other messages
+		std::lock_guard<std::mutex> lock_guard(_send_mutex);
+
+		while (packetizer.IsAvailablePackets())
+		{
+			auto packet = packetizer.PopPacket();
+			if ((packet == nullptr) || (_socket->Send(packet->GetData()) == false))
+			{
+				logte("Could not send a request to %s", _address.ToString().CStr());
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void OvtConnection::Close()
+	{
+		_running = false;
+
+		if (_socket != nullptr)
+		{
+			_socket->Close();
+		}
+
+		if (_receive_thread.joinable())
+		{
+			if (_receive_thread.get_id() == std::this_thread::get_id())
+			{
+				// Called by the receiver itself (e.g. the last reference is released while handling a message),
+				// it cannot be joined, and a joinable std::thread terminates the process when it is destroyed
+				_receive_thread.detach();
+			}
+			else
+			{
+				_receive_thread.join();
+			}
+		}
+	}
+
+	void OvtConnection::ReceiveThread()
+	{
+		uint8_t buffer[65535];
+
+		while (_running)
+		{
+			size_t read_bytes = 0ULL;
+
+			auto error = _socket->Recv(buffer, sizeof(buffer), &read_bytes, false);
+			if (read_bytes == 0)
+			{
+				if (error != nullptr)
+				{
+					if (_running)
+					{
+						logte("An error occurred while receiving packet from %s: %s", _address.ToString().CStr(), error->What());
+					}
+
+					break;
+				}
+
+				// Timed out
+				continue;
+			}
+
+			_packet_buffer->Append(buffer, read_bytes);
+
+			if (ParsePackets() == false)
+			{
+				logte("An error occurred while parsing packet from %s: Invalid packet", _address.ToString().CStr());
+				break;
+			}
+		}
+
+		_running = false;
+		_socket->Close();
+
+		logti("The multiplexed OVT connection to %s is closed", _address.ToString().CStr());
+
+		// The connection may be released by the channels, so nothing is accessed after this
+		DisconnectChannels();
+	}
+
+	bool OvtConnection::ParsePackets()
+	{
+		while (_packet_buffer->GetLength() >= OVT_FIXED_HEADER_SIZE)
+		{
+			auto packet = std::make_shared<OvtPacket>();
+
+			if (packet->Load(*_packet_buffer) == false)
+			{
+				// Not enough data to parse yet if the header is available
+				return packet->IsHeaderAvailable();
+			}
+
+			if (_packet_buffer->GetLength() == packet->PacketLength())
+			{
+				_packet_buffer->Clear();
+			}
+			else
+			{
+				_packet_buffer = _packet_buffer->Subdata(packet->PacketLength());
+			}
+
+			if (packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+			{
+				std::shared_ptr<OvtChannel> channel;
+
+				{
+					std::lock_guard<std::mutex> lock_guard(_channel_mutex);
+
+					auto item = _channel_map.find(packet->SessionId());
+					if (item != _channel_map.end())
+					{
+						channel = item->second;
+					}
+				}
+
+				// The packets of released sessions can arrive until the origin handles STOP
+				if (channel != nullptr)
+				{
+					channel->PushPacket(packet);
+				}
+			}
+			else if (packet->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE ||
+					 packet->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_REQUEST)
+			{
+				HandleMessagePacket(packet);
+			}
+		}
+
+		return true;
+	}
+
+	void OvtConnection::HandleMessagePacket(const std::shared_ptr<OvtPacket> &packet)
+	{
+		_message_packets.push_back(packet);
+
+		if (_message_depacketizer.AppendPacket(packet->GetData()) == false)
+		{
+			_message_packets.clear();
+			return;
+		}
+
+		if (_message_depacketizer.IsAvailableMessage())
+		{
+			HandleMessage(_message_depacketizer.PopMessage(), packet->SessionId());
+			_message_packets.clear();
+		}
+	}
+
+	void OvtConnection::HandleMessage(const std::shared_ptr<ov::Data> &message, uint32_t session_id)
+	{
+		std::shared_ptr<OvtChannel> channel;
+
+		ov::String payload(message->GetDataAs<char>(), message->GetLength());
+		ov::JsonObject object = ov::Json::Parse(payload);
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_channel_mutex);
+
+			if (object.IsNull() == false)
+			{
+				auto &json_id = object.GetJsonValue()["id"];
+				auto item = json_id.isUInt() ? _pending_request_map.find(json_id.asUInt()) : _pending_request_map.end();
+
+				if (item != _pending_request_map.end())
+				{
+					channel = item->second;
+					_pending_request_map.erase(item);
+
+					ov::String application = object.GetJsonValue()["application"].asString().c_str();
+					auto &json_code = object.GetJsonValue()["code"];
+
+					// From now on, the media packets with the session id are delivered to the channel
+					if ((application.UpperCaseString() == "PLAY") && json_code.isUInt() && (json_code.asUInt() == 200))
+					{
+						if (session_id == 0)
+						{
+							logte("The origin server %s does not support multiplexing (session id is not set)", _address.ToString().CStr());
+							channel->Disconnect();
+							return;
+						}
+
+						channel->SetSessionId(session_id);
+						_channel_map[session_id] = channel;
+					}
+				}
+			}
+
+			if (channel == nullptr)
+			{
+				// A message sent by the origin (e.g. STOP)
+				auto item = _channel_map.find(session_id);
+				if (item != _channel_map.end())
+				{
+					channel = item->second;
+				}
+			}
+		}
+
+		if (channel == nullptr)
+		{
+			logtd("A message for an unknown session (%u) is received from %s", session_id, _address.ToString().CStr());
+			return;
+		}
+
+		// The stream parses the message by itself, and messages are never discarded
+		for (const auto &packet : _message_packets)
+		{
+			channel->PushPacket(packet, true);
+		}
+	}
+
+	void OvtConnection::DisconnectChannels()
+	{
+		std::lock_guard<std::mutex> lock_guard(_channel_mutex);
+
+		for (auto &item : _pending_request_map)
+		{
+			item.second->Disconnect();
+		}
+		_pending_request_map.clear();
+
+		for (auto &item : _channel_map)
+		{
+			item.second->Disconnect();
+		}
+		_channel_map.clear();
+	}
+}  // namespace pvd
@@ -0,0 +1,140 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/ovsocket.h>
+#include <modules/ovt_packetizer/ovt_depacketizer.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+// Maximum bytes a channel can hold before it is considered stalled
+#define OVT_CHANNEL_MAX_BUFFERED_BYTES (8 * 1024 * 1024)
+
+namespace pvd
+{
+	// A channel carries the packets of one stream over a shared OvtConnection.
+	// Each channel has its own bounded queue, so a stream that does not consume its packets
+	// only loses its own data and never blocks the other streams of the connection.
+	class OvtChannel
+	{
+	public:
+		explicit OvtChannel(size_t max_buffered_bytes);
+		~OvtChannel();
+
+		// The eventfd is readable while there are packets to pop (used with the epoll of StreamMotor)
+		int GetEventFd() const;
+
+		uint32_t GetSessionId() const;
+		void SetSessionId(uint32_t session_id);
+
+		// Called by the receiver of OvtConnection
+		//
+		// If the queue is full, the oldest media frames are discarded until the packet fits. The messages
+		// (responses, STOP) are never discarded. If the frame of the packet itself has to be discarded,
+		// the following packets are dropped until the end of that frame (marker), so the stream can resume at a frame boundary.
+		void PushPacket(const std::shared_ptr<OvtPacket> &packet, bool bypass_flow_control = false);
+		void Disconnect();
+
+		// Called by the stream
+		//
+		// Returns false if the connection is closed and there are no more packets.
+		// - is_reset: true if the packets have been discarded since the last pop
+		bool PopPackets(std::vector<std::shared_ptr<const ov::Data>> &packets, bool *is_reset, int timeout_msec);
+
+	private:
+		struct QueuedPacket
+		{
+			std::shared_ptr<const ov::Data> data;
+			size_t length;
+			bool is_media;
+			bool marker;
+		};
+
+		// _queue_mutex must be locked
+		// Returns false if the frame of the packet being pushed has been discarded
+		bool DiscardOldestFrames(size_t required_bytes);
+
+		void Signal();
+		void ClearSignal();
+
+		const size_t _max_buffered_bytes;
+		int _event_fd = -1;
+
+		std::atomic<uint32_t> _session_id{0};
+
+		std::mutex _queue_mutex;
+		std::condition_variable _queue_condition;
+		std::deque<QueuedPacket> _queue;
+		size_t _buffered_bytes = 0;
+
+		bool _discarding = false;
+		bool _is_reset = false;
+		bool _disconnected = false;
+	};
+
+	// A persistent connection to an origin that multiplexes several streams using the session id of OvtPacket
+	class OvtConnection
+	{
+	public:
+		static std::shared_ptr<OvtConnection> Create(const std::shared_ptr<ov::SocketPool> &socket_pool, const ov::SocketAddress &address);
+
+		explicit OvtConnection(const ov::SocketAddress &address);
+		~OvtConnection();
+
+		bool IsConnected() const;
+		size_t GetChannelCount() const;
+
+		std::shared_ptr<OvtChannel> CreateChannel();
+		void ReleaseChannel(const std::shared_ptr<OvtChannel> &channel);
+
+		uint32_t IssueRequestId();
+
+		// Sends the request, and the response is delivered to the channel
+		// The "id" of the request must be issued by IssueRequestId()
+		bool SendRequest(const std::shared_ptr<OvtChannel> &channel, const Json::Value &request);
+
+		void Close();
+
+	protected:
+		bool Connect(const std::shared_ptr<ov::SocketPool> &socket_pool);
+
+		void ReceiveThread();
+		bool ParsePackets();
+		void HandleMessagePacket(const std::shared_ptr<OvtPacket> &packet);
+		void HandleMessage(const std::shared_ptr<ov::Data> &message, uint32_t session_id);
+		void DisconnectChannels();
+
+		ov::SocketAddress _address;
+		std::shared_ptr<ov::Socket> _socket;
+
+		std::thread _receive_thread;
+		std::atomic<bool> _running{false};
+
+		std::mutex _send_mutex;
+		std::atomic<uint32_t> _last_request_id{0};
+
+		// Buffer of the received data that is not parsed yet
+		std::shared_ptr<ov::Data> _packet_buffer;
+
+		// The packets of the message being received and their reassembled payload
+		std::vector<std::shared_ptr<OvtPacket>> _message_packets;
+		OvtDepacketizer _message_depacketizer;
+
+		mutable std::mutex _channel_mutex;
+		// request id : channel waiting for the response
+		std::unordered_map<uint32_t, std::shared_ptr<OvtChannel>> _pending_request_map;
+		// session id : channel
+		std::unordered_map<uint32_t, std::shared_ptr<OvtChannel>> _channel_map;
+		size_t _channel_count = 0;
+	};
+}  // namespace pvd
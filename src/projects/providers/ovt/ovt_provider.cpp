@@ -34,12 +34,29 @@ namespace pvd
 		bool is_parsed;
 		_worker_count = ovt_provider_config.GetWorkerCount(&is_parsed);
 		_worker_count = is_parsed ? _worker_count : PHYSICAL_PORT_DEFAULT_WORKER_COUNT;
+
+		_multiplex = ovt_provider_config.IsMultiplexEnabled();
+		_connections_per_origin = std::max(ovt_provider_config.GetConnectionsPerOrigin(), 1);
 	}
 
 	OvtProvider::~OvtProvider()
 	{
 		Stop();
 
+		{
+			std::lock_guard<std::mutex> lock_guard(_connection_map_lock);
+
+			for (auto &item : _connection_map)
+			{
+				for (auto &connection : item.second)
+				{
+					connection->Close();
+				}
+			}
+
+			_connection_map.clear();
+		}
+
 		if (_client_socket_pool != nullptr)
 		{
 			_client_socket_pool->Uninitialize();
@@ -59,6 +76,42 @@ namespace pvd
 		return _client_socket_pool;
 	}
 
+	std::shared_ptr<OvtConnection> OvtProvider::GetConnection(const ov::String &host, int port)
+	{
+		ov::String key;
+		key.Format("%s:%d", host.CStr(), port);
+
+		std::lock_guard<std::mutex> lock_guard(_connection_map_lock);
+
+		auto &connections = _connection_map[key];
+
+		// Remove the connections closed by the origin
+		connections.erase(std::remove_if(connections.begin(), connections.end(),
+										 [](const std::shared_ptr<OvtConnection> &connection) -> bool {
+											 return connection->IsConnected() == false;
+										 }),
+						  connections.end());
+
+		// Use the least loaded connection if no more connections can be created
+		if (connections.size() >= static_cast<size_t>(_connections_per_origin))
+		{
+			return *std::min_element(connections.begin(), connections.end(),
+									 [](const std::shared_ptr<OvtConnection> &a, const std::shared_ptr<OvtConnection> &b) -> bool {
+										 return a->GetChannelCount() < b->GetChannelCount();
+									 });
+		}
+
+		auto connection = OvtConnection::Create(GetClientSocketPool(), ov::SocketAddress(host, port));
+		if (connection == nullptr)
+		{
+			return nullptr;
+		}
+
+		connections.push_back(connection);
+
+		return connection;
+	}
+
 	bool OvtProvider::OnCreateHost(const info::Host &host_info)
 	{
 		return true;
@@ -10,6 +10,8 @@
 #include <base/provider/pull_provider/provider.h>
 #include <orchestrator/orchestrator.h>
 
+#include "ovt_connection.h"
+
 /*
  * OvtProvider
  * 		: Create PhysicalPort, OvtApplication
@@ -53,6 +55,14 @@ namespace pvd
 
 		std::shared_ptr<ov::SocketPool> GetClientSocketPool();
 
+		bool IsMultiplexEnabled() const
+		{
+			return _multiplex;
+		}
+
+		// Returns a persistent connection to the origin that is shared by multiple streams
+		std::shared_ptr<OvtConnection> GetConnection(const ov::String &host, int port);
+
 	protected:
 		bool OnCreateHost(const info::Host &host_info) override;
 		bool OnDeleteHost(const info::Host &host_info) override;
@@ -61,5 +71,12 @@ namespace pvd
 
 		std::shared_ptr<ov::SocketPool> _client_socket_pool = nullptr;
 		int _worker_count = 1;
+
+		bool _multiplex = false;
+		int _connections_per_origin = 1;
+
+		// host:port : connections
+		std::mutex _connection_map_lock;
+		std::map<ov::String, std::vector<std::shared_ptr<OvtConnection>>> _connection_map;
 	};
 }  // namespace pvd
\ No newline at end of file
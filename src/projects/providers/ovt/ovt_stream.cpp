@@ -57,6 +57,13 @@ namespace pvd
 			_client_socket->Close();
 		}
 
+		if(_connection != nullptr)
+		{
+			// The connection is shared with other streams, so only the channel is released
+			_connection->ReleaseChannel(_channel);
+			_connection.reset();
+		}
+
 		_curr_url = nullptr;
 
 		std::lock_guard<std::shared_mutex> mlock(_packetizer_lock);
@@ -174,6 +181,12 @@ namespace pvd
 			return false;
 		}
 
+		_multiplex = GetOvtProvider()->IsMultiplexEnabled();
+		if(_multiplex)
+		{
+			return ConnectOriginWithMultiplexing();
+		}
+
 		auto pool = GetOvtProvider()->GetClientSocketPool();
 
 		if (pool == nullptr)
@@ -215,6 +228,48 @@ namespace pvd
 		return true;
 	}
 
+	bool OvtStream::ConnectOriginWithMultiplexing()
+	{
+		_connection = GetOvtProvider()->GetConnection(_curr_url->Host(), _curr_url->Port());
+		if(_connection == nullptr)
+		{
+			SetState(State::ERROR);
+			logte("Cannot connect to origin server : %s:%d", _curr_url->Host().CStr(), _curr_url->Port());
+			return false;
+		}
+
+		_channel = _connection->CreateChannel();
+		_wait_for_key_frame = false;
+
+		SetState(State::CONNECTED);
+
+		return true;
+	}
+
+	uint32_t OvtStream::IssueRequestId()
+	{
+		// Responses are matched by request id on the shared connection, so the id must be unique per connection
+		if(_multiplex)
+		{
+			return _connection->IssueRequestId();
+		}
+
+		return _last_request_id + 1;
+	}
+
+	bool OvtStream::SendRequest(const Json::Value &request)
+	{
+		if(_multiplex)
+		{
+			return _connection->SendRequest(_channel, request);
+		}
+
+		auto message = ov::Json::Stringify(request).ToData(false);
+
+		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
+		return _packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message);
+	}
+
 	bool OvtStream::RequestDescribe()
 	{
 		if(GetState() != State::CONNECTED)
@@ -224,15 +279,12 @@ namespace pvd
 
 		Json::Value root;
 
-		_last_request_id++;
+		_last_request_id = IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "describe";
 		root["target"] = _curr_url->Source().CStr();
 
-		auto message = ov::Json::Stringify(root).ToData(false);
-
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if(_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		if(SendRequest(root) == false)
 		{
 			return false;
 		}
@@ -498,15 +550,17 @@ namespace pvd
 		}
 
 		Json::Value root;
-		_last_request_id++;
+		_last_request_id = IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "play";
 		root["target"] = _curr_url->Source().CStr();
+		if(_multiplex)
+		{
+			// Let the origin know that the connection is shared, so it does not close the connection when the session ends
+			root["multiplex"] = true;
+		}
 
-		auto message = ov::Json::Stringify(root).ToData(false);
-
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if(_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		if(SendRequest(root) == false)
 		{
 			logte("%s/%s(%u) - Could not request to play. Socket send error", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId());
 			return false;
@@ -583,15 +637,16 @@ namespace pvd
 		}
 
 		Json::Value root;
-		_last_request_id++;
+		_last_request_id = IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "stop";
 		root["target"] = _curr_url->Source().CStr();
+		if(_multiplex)
+		{
+			root["sessionId"] = _channel->GetSessionId();
+		}
 
-		auto message = ov::Json::Stringify(root).ToData(false);
-
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if(_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		if(SendRequest(root) == false)
 		{
 			return false;
 		}
@@ -635,6 +690,11 @@ namespace pvd
 
 	bool OvtStream::ReceivePacket(bool non_block)
 	{
+		if(_multiplex)
+		{
+			return ReceiveChannelPacket(non_block);
+		}
+
 		uint8_t	buffer[65535];
 		size_t read_bytes = 0ULL;
 
@@ -672,8 +732,50 @@ namespace pvd
 		return true;
 	}
 
+	bool OvtStream::ReceiveChannelPacket(bool non_block)
+	{
+		std::vector<std::shared_ptr<const ov::Data>> packets;
+		bool is_reset = false;
+
+		if(_channel->PopPackets(packets, &is_reset, non_block ? 0 : 1500) == false)
+		{
+			logte("[%s/%s] The connection to the origin server is closed", GetApplicationName(), GetName().CStr());
+			SetState(State::ERROR);
+			return false;
+		}
+
+		if(is_reset)
+		{
+			// The channel discarded the packets because this stream was too slow, so restart from the next frame
+			_depacketizer.Reset();
+			_wait_for_key_frame = true;
+		}
+
+		if(packets.empty())
+		{
+			// retry later (non_block) or timeout
+			return non_block;
+		}
+
+		for(const auto &packet : packets)
+		{
+			if(_depacketizer.AppendPacket(packet) == false)
+			{
+				logte("[%s/%s] An error occurred while parsing packet: Invalid packet", GetApplicationName(), GetName().CStr());
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	int OvtStream::GetFileDescriptorForDetectingEvent()
 	{
+		if(_multiplex)
+		{
+			return (_channel != nullptr) ? _channel->GetEventFd() : -1;
+		}
+
 		return _client_socket->GetNativeHandle();
 	}
 
@@ -712,6 +814,18 @@ namespace pvd
 					//  Do not anything if the msid is changed
 				}
 
+				if(_wait_for_key_frame && (media_packet->GetMediaType() == cmn::MediaType::Video))
+				{
+					if(media_packet->GetFlag() == MediaPacketFlag::Key)
+					{
+						_wait_for_key_frame = false;
+					}
+					else
+					{
+						drop = true;
+					}
+				}
+
 				// When switching streams, the PTS of the packet may become negative due to the start time of the first packet. Packets before the base timestamp are defined as a drop policy.
  				if(media_packet->GetPts() < 0) 
 				 {
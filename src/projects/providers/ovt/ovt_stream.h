@@ -15,6 +15,8 @@
 #include <base/provider/pull_provider/application.h>
 #include <base/provider/pull_provider/stream.h>
 
+#include "ovt_connection.h"
+
 #define OVT_TIMEOUT_MSEC		3000
 namespace pvd
 {
@@ -59,6 +61,9 @@ namespace pvd
 		bool StopStream() override; // Stop
 
 		bool ConnectOrigin();
+		bool ConnectOriginWithMultiplexing();
+		uint32_t IssueRequestId();
+		bool SendRequest(const Json::Value &request);
 		bool RequestDescribe();
 		bool ReceiveDescribe(uint32_t request_id);
 		bool RequestPlay();
@@ -67,11 +72,19 @@ namespace pvd
 		bool ReceiveStop(uint32_t request_id, const std::shared_ptr<OvtPacket> &packet);
 		
 		bool ReceivePacket(bool non_block = false);
+		bool ReceiveChannelPacket(bool non_block);
 		std::shared_ptr<ov::Data> ReceiveMessage();
 
 		void Release();
 
 		std::shared_ptr<ov::Socket> _client_socket = nullptr;
+
+		// Used instead of _client_socket when the streams share the connections to the origin
+		bool _multiplex = false;
+		std::shared_ptr<OvtConnection> _connection = nullptr;
+		std::shared_ptr<OvtChannel> _channel = nullptr;
+		// After the channel discards packets, video frames are dropped until the next key frame
+		bool _wait_for_key_frame = false;
 		std::shared_ptr<const ov::Url> _curr_url = nullptr;
 
 		uint32_t _last_request_id;
@@ -312,6 +312,8 @@ std::shared_ptr<ov::Error> FileApplication::RecordStop(const std::shared_ptr<inf
 	record->SetRecordTotalBytes(userdata->GetRecordTotalBytes());
 	record->SetRecordTime(userdata->GetRecordTime());
 	record->SetRecordTotalTime(userdata->GetRecordTotalTime());
+	record->SetMaxWriteBacklogBytes(userdata->GetMaxWriteBacklogBytes());
+	record->SetWriteDroppedPackets(userdata->GetWriteDroppedPackets());
 	record->SetSqeuence(userdata->GetSequence());
 	record->SetCreatedTime(userdata->GetCreatedTime());
 	record->SetRecordStartTime(userdata->GetRecordStartTime());
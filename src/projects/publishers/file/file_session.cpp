@@ -35,6 +35,8 @@ namespace pub
 
 	FileSession::~FileSession()
 	{
+		StopWriterThread();
+
 		logtd("FileSession(%d) has been terminated finally", GetId());
 	}
 
@@ -49,6 +51,13 @@ namespace pub
 			return false;
 		}
 
+		if (StartWriterThread() == false)
+		{
+			logte("Failed to start the writer thread. id(%d)", GetId());
+
+			return false;
+		}
+
 		logtd("FileSession(%d) has started.", GetId());
 
 		return Session::Start();
@@ -56,6 +65,9 @@ namespace pub
 
 	bool FileSession::Stop()
 	{
+		// The queued packets must be written before the file is closed
+		StopWriterThread();
+
 		std::lock_guard<std::shared_mutex> mlock(_lock);
 
 		if (StopRecord() == false)
@@ -132,6 +144,12 @@ namespace pub
 			return false;
 		}
 
+		auto app_config = std::static_pointer_cast<info::Application>(GetApplication())->GetConfig();
+		auto file_config = app_config.GetPublishers().GetFilePublisher();
+
+		_writer->SetWriteBufferSize(std::max(file_config.GetWriteBufferSize(), 0));
+		_writer->SetFsyncPolicy(FileWriter::FsyncPolicyFromString(file_config.GetFsync()));
+
 		if (_writer->SetPath(ov::PathManager::Combine(GetRootPath(), GetRecord()->GetTmpPath()), output_format) == false)
 		{
 			SetState(SessionState::Error);
@@ -194,7 +212,7 @@ namespace pub
 			}
 		}
 
-		logtd("default track id is %d", _default_track);
+		logtd("default track id is %d", _default_track.load());
 
 		if (_writer->Start() == false)
 		{
@@ -307,10 +325,158 @@ namespace pub
 		return true;
 	}
 
-	void FileSession::SendOutgoingData(const std::any &packet)
+	bool FileSession::StartWriterThread()
 	{
-		std::lock_guard<std::shared_mutex> mlock(_lock);
+		auto app_config = std::static_pointer_cast<info::Application>(GetApplication())->GetConfig();
+		auto file_config = app_config.GetPublishers().GetFilePublisher();
+
+		_max_write_queue_bytes = std::max(file_config.GetWriteQueueSize(), 0);
+		_flush_interval = std::max(file_config.GetFlushInterval(), 0);
+
+		if ((_max_write_queue_bytes == 0) || _writer_thread.joinable())
+		{
+			// Packets are written by the stream thread
+			return true;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock_guard(_write_queue_mutex);
+
+			_write_queue.clear();
+			_write_queue_bytes = 0;
+			_drop_until_key_frame = false;
+			_writer_thread_running = true;
+		}
+
+		try
+		{
+			_writer_thread = std::thread(&FileSession::WriterThread, this);
+			pthread_setname_np(_writer_thread.native_handle(), "FileWriter");
+		}
+		catch (const std::system_error &e)
+		{
+			logte("Could not create the writer thread. id(%d), error(%s)", GetId(), e.what());
+
+			std::lock_guard<std::mutex> lock_guard(_write_queue_mutex);
+			_writer_thread_running = false;
+
+			return false;
+		}
+
+		return true;
+	}
+
+	void FileSession::StopWriterThread()
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_write_queue_mutex);
+			_writer_thread_running = false;
+		}
+
+		_write_queue_condition.notify_all();
+
+		// The writer thread exits after writing all the queued packets
+		if (_writer_thread.joinable())
+		{
+			_writer_thread.join();
+		}
+	}
+
+	void FileSession::WriterThread()
+	{
+		ov::StopWatch flush_timer;
+		flush_timer.Start();
+
+		auto has_job = [this]() -> bool {
+			return (_write_queue.empty() == false) || (_writer_thread_running == false);
+		};
+
+		while (true)
+		{
+			std::shared_ptr<MediaPacket> packet;
+
+			{
+				std::unique_lock<std::mutex> lock(_write_queue_mutex);
+
+				if (_flush_interval > 0)
+				{
+					_write_queue_condition.wait_for(lock, std::chrono::milliseconds(_flush_interval), has_job);
+				}
+				else
+				{
+					_write_queue_condition.wait(lock, has_job);
+				}
+
+				if (_write_queue.empty() == false)
+				{
+					packet = _write_queue.front();
+					_write_queue.pop_front();
+
+					_write_queue_bytes -= packet->GetData()->GetLength();
+					GetRecord()->UpdateWriteBacklog(_write_queue_bytes, _write_queue.size());
+				}
+				else if (_writer_thread_running == false)
+				{
+					break;
+				}
+			}
+
+			std::lock_guard<std::shared_mutex> mlock(_lock);
+
+			if (packet != nullptr)
+			{
+				WritePacket(packet);
+			}
+
+			if ((_flush_interval > 0) && flush_timer.IsElapsed(_flush_interval))
+			{
+				if (_writer != nullptr)
+				{
+					_writer->Flush();
+				}
+
+				flush_timer.Update();
+			}
+		}
+
+		logtd("The writer thread of FileSession(%d) has finished", GetId());
+	}
+
+	void FileSession::EnqueuePacket(const std::shared_ptr<MediaPacket> &packet)
+	{
+		auto length = packet->GetData()->GetLength();
+		bool is_default_key_frame = (packet->GetTrackId() == _default_track) && (packet->GetFlag() == MediaPacketFlag::Key);
 
+		if (_drop_until_key_frame)
+		{
+			if (is_default_key_frame == false)
+			{
+				GetRecord()->IncreaseWriteDroppedPackets();
+				return;
+			}
+
+			_drop_until_key_frame = false;
+		}
+
+		if ((_write_queue_bytes + length) > _max_write_queue_bytes)
+		{
+			// The packets that refer to the dropped packet can't be decoded, so drop all packets until the next key frame
+			logtw("The disk cannot keep up with the stream. Drop the packets until the next key frame. id(%d), queued(%zu bytes, %zu packets)",
+				  GetId(), _write_queue_bytes, _write_queue.size());
+
+			_drop_until_key_frame = true;
+			GetRecord()->IncreaseWriteDroppedPackets();
+			return;
+		}
+
+		_write_queue.push_back(packet);
+		_write_queue_bytes += length;
+
+		GetRecord()->UpdateWriteBacklog(_write_queue_bytes, _write_queue.size());
+	}
+
+	void FileSession::SendOutgoingData(const std::any &packet)
+	{
 		std::shared_ptr<MediaPacket> session_packet;
 
 		try
@@ -328,6 +494,27 @@ namespace pub
 			return;
 		}
 
+		{
+			std::unique_lock<std::mutex> lock(_write_queue_mutex);
+
+			if (_writer_thread_running)
+			{
+				EnqueuePacket(session_packet);
+				lock.unlock();
+
+				_write_queue_condition.notify_one();
+
+				return;
+			}
+		}
+
+		std::lock_guard<std::shared_mutex> mlock(_lock);
+
+		WritePacket(session_packet);
+	}
+
+	void FileSession::WritePacket(const std::shared_ptr<MediaPacket> &session_packet)
+	{
 		// Drop until the first keyframe of the main track is received.
 		if (_found_first_keyframe == false)
 		{
@@ -378,13 +565,7 @@ namespace pub
 
 		if (_writer != nullptr)
 		{
-			bool ret = _writer->PutData(
-				session_packet->GetTrackId(),
-				session_packet->GetPts(),
-				session_packet->GetDts(),
-				session_packet->GetFlag(),
-				session_packet->GetBitstreamFormat(),
-				session_packet->GetData());
+			bool ret = _writer->PutData(session_packet);
 
 			if (ret == false)
 			{
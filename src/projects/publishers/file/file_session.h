@@ -4,6 +4,10 @@
 #include <base/publisher/session.h>
 #include <modules/file/file_writer.h>
 
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
 #include "base/info/record.h"
 
 namespace pub
@@ -42,6 +46,15 @@ namespace pub
 
 		void UpdateDefaultTrack(const std::shared_ptr<MediaTrack> &track);
 
+		// Write-behind: the stream thread only queues the packets, and the writer thread writes them to the file
+		bool StartWriterThread();
+		void StopWriterThread();
+		void WriterThread();
+		void EnqueuePacket(const std::shared_ptr<MediaPacket> &packet);
+
+		// Writes a packet to the file (_lock must be locked)
+		void WritePacket(const std::shared_ptr<MediaPacket> &session_packet);
+
 	private:
 		std::shared_ptr<FileWriter> _writer;
 
@@ -50,7 +63,21 @@ namespace pub
 		std::shared_mutex _lock;
 
 		std::map<cmn::MediaType, MediaTrackId> _default_track_by_type;
-		int32_t _default_track;
+		// Also read by the stream thread to decide which packets can be dropped
+		std::atomic<int32_t> _default_track{-1};
 		bool _found_first_keyframe = false;
+
+		// Loaded from the config when the session is started
+		size_t _max_write_queue_bytes = 0;
+		int64_t _flush_interval = 0;
+
+		std::thread _writer_thread;
+		std::mutex _write_queue_mutex;
+		std::condition_variable _write_queue_condition;
+		std::deque<std::shared_ptr<MediaPacket>> _write_queue;
+		size_t _write_queue_bytes = 0;
+		bool _writer_thread_running = false;
+		// Set when the queue is full, to drop the packets until the next key frame
+		bool _drop_until_key_frame = false;
 	};
 }  // namespace pub
\ No newline at end of file
@@ -71,7 +71,7 @@ namespace pub
 
 		auto stream_packet = std::make_any<std::shared_ptr<MediaPacket>>(media_packet);
 
-		BroadcastPacket(stream_packet);
+		BroadcastPacket(stream_packet, media_packet->GetIngestTime());
 	}
 
 	void FileStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
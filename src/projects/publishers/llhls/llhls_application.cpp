@@ -41,6 +41,13 @@ LLHlsApplication::~LLHlsApplication()
 
 bool LLHlsApplication::Start()
 {
+	auto &dvr_config = GetConfig().GetPublishers().GetLLHlsPublisher().GetDvr();
+	if (dvr_config.IsEnabled())
+	{
+		// The streams of the application keep their DVR files in <TempStoragePath>/<app>/<stream>_<key>
+		bmff::FMP4Storage::RemoveDvrLeftovers(ov::PathManager::Combine(dvr_config.GetTempStoragePath(), GetName().CStr()));
+	}
+
 	return Application::Start();
 }
 
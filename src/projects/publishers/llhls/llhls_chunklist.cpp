@@ -34,6 +34,12 @@ void LLHlsChunklist::SaveOldSegmentInfo(bool enable)
 	}
 }
 
+void LLHlsChunklist::EnableDvr(uint64_t max_duration_sec)
+{
+	_dvr_enabled = true;
+	_dvr_max_duration = max_duration_sec;
+}
+
 const std::shared_ptr<const MediaTrack> &LLHlsChunklist::GetTrack() const
 {
 	return _track;
@@ -138,7 +144,7 @@ bool LLHlsChunklist::AppendPartialSegmentInfo(uint32_t segment_sequence, const S
 
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
 {
-	if (_keep_old_segments == false)
+	if (_keep_old_segments == false && _dvr_enabled == false)
 	{
 		return true;
 	}
@@ -146,6 +152,23 @@ bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_in
 	// no longer need partial segment info - for memory saving
 	segment_info->ClearPartialSegments();
 
+	if (_dvr_enabled == true)
+	{
+		_dvr_segments.push_back(segment_info);
+		_dvr_duration += segment_info->GetDuration();
+
+		while (_dvr_segments.size() > 1 && _dvr_duration > _dvr_max_duration)
+		{
+			_dvr_duration -= _dvr_segments.front()->GetDuration();
+			_dvr_segments.pop_front();
+		}
+	}
+
+	if (_keep_old_segments == false)
+	{
+		return true;
+	}
+
 	logtd("Save old segment info: %d / %s", segment_info->GetSequence(), segment_info->GetUrl().CStr());
 	_old_segments.push_back(segment_info);
 
@@ -223,7 +246,18 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, const std::m
 		playlist.AppendFormat("#EXT-X-PART-INF:PART-TARGET=%lf\n", _max_part_duration);
 	}
 
-	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", vod == false ? _segments[0]->GetSequence() : 0);
+	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
+
+	// In DVR, the playlist starts from the oldest segment in the DVR window
+	bool with_dvr = (vod == false) && (_dvr_segments.empty() == false);
+
+	int64_t media_sequence = 0;
+	if (vod == false)
+	{
+		media_sequence = with_dvr ? _dvr_segments.front()->GetSequence() : _segments[0]->GetSequence();
+	}
+
+	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%lld\n", media_sequence);
 	playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
 	if (query_string.IsEmpty() == false)
 	{
@@ -231,7 +265,22 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, const std::m
 	}
 	playlist.AppendFormat("\"\n");
 
-	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
+	if (with_dvr == true)
+	{
+		for (auto &segment : _dvr_segments)
+		{
+			std::chrono::system_clock::time_point tp{std::chrono::milliseconds{segment->GetStartTime()}};
+			playlist.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
+			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
+			playlist.AppendFormat("%s", segment->GetUrl().CStr());
+			if (query_string.IsEmpty() == false)
+			{
+				playlist.AppendFormat("?%s", query_string.CStr());
+			}
+			playlist.Append("\n");
+		}
+	}
+
 	if (vod == true)
 	{
 		for (auto &segment : _old_segments)
@@ -137,6 +137,8 @@ public:
 	const ov::String& GetUrl() const;
 
 	void SaveOldSegmentInfo(bool enable);
+	// Segments pushed out of the live window are kept in the playlist up to max_duration_sec
+	void EnableDvr(uint64_t max_duration_sec);
 
 	// Get Track
 	const std::shared_ptr<const MediaTrack> &GetTrack() const;
@@ -176,4 +178,10 @@ private:
 	mutable std::shared_mutex _segments_guard;
 	uint64_t _deleted_segments = 0;
 	bool _keep_old_segments = false;
+
+	// DVR window
+	bool _dvr_enabled = false;
+	double _dvr_max_duration = 0; // seconds
+	double _dvr_duration = 0; // seconds
+	std::deque<std::shared_ptr<SegmentInfo>> _dvr_segments;
 };
\ No newline at end of file
@@ -30,4 +30,9 @@ protected:
 
 		return false;
 	}
+
+	std::vector<ov::String> GetRoutingExtensions() const override
+	{
+		return {"m3u8", "m4s"};
+	}
 };
@@ -7,6 +7,8 @@
 //
 //==============================================================================
 #include <modules/http/server/http_exchange.h>
+#include <modules/http/server/http2/http2_stream.h>
+#include <modules/http/server/http2/http2_response.h>
 #include "llhls_session.h"
 #include "llhls_application.h"
 #include "llhls_stream.h"
@@ -66,6 +68,8 @@ bool LLHlsSession::Start()
 	_segment_max_age = cache_control.GetSegmentMaxAge();
 	_partial_segment_max_age = cache_control.GetPartialSegmentMaxAge();
 
+	_preload_hint_push = llhls_conf.IsPreloadHintPushEnabled();
+
 	return Session::Start();
 }
 
@@ -550,6 +554,12 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 			}
 		}
 
+		if ((_preload_hint_push == true) && (has_delivery_directives == true))
+		{
+			// The PUSH_PROMISE must be sent before the chunklist that refers to the promised partial segment
+			PushPreloadHint(exchange, track_id, query_string);
+		}
+
 		response->AppendData(chunklist);
 
 		// If a client uses previously cached llhls.m3u8 and requests chunklist
@@ -719,7 +729,17 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(partial_segment);
+		auto http2_response = std::dynamic_pointer_cast<http::svr::h2::Http2Response>(response);
+		if (http2_response != nullptr)
+		{
+			// DATA frames of the partial segment are made once per stream and shared by all HTTP/2 sessions
+			http2_response->AppendPreframedData(llhls_stream->GetPreframedChunk(track_id, segment_number, partial_number, partial_segment));
+		}
+		else
+		{
+			// HTTP/1.1 response has Content-Length, so the partial segment is sent as it is
+			response->AppendData(partial_segment);
+		}
 	}
 	else if (result == LLHlsStream::RequestResult::Accepted)
 	{
@@ -748,6 +768,81 @@ void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &
 	exchange->Release();
 }
 
+void LLHlsSession::PushPreloadHint(const std::shared_ptr<http::svr::HttpExchange> &exchange, const int32_t &track_id, const ov::String &query_string)
+{
+	auto http2_stream = std::dynamic_pointer_cast<http::svr::h2::HttpStream>(exchange);
+	if (http2_stream == nullptr)
+	{
+		return;
+	}
+
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return;
+	}
+
+	int64_t segment_number, partial_number;
+	ov::String file_name;
+	if (llhls_stream->GetPreloadHintPart(track_id, segment_number, partial_number, file_name) == false)
+	{
+		return;
+	}
+
+	// The partial segment has already been pushed to this session
+	auto last_pushed_part = _last_pushed_parts.find(track_id);
+	if ((last_pushed_part != _last_pushed_parts.end()) && (last_pushed_part->second == std::make_pair(segment_number, partial_number)))
+	{
+		return;
+	}
+
+	for (const auto &pending_request : _pending_requests)
+	{
+		if ((pending_request.type == RequestType::PartialSegment) &&
+			(pending_request.track_id == track_id) &&
+			(pending_request.segment_number == segment_number) &&
+			(pending_request.partial_number == partial_number))
+		{
+			// The player has already requested it
+			return;
+		}
+	}
+
+	auto request_uri = exchange->GetRequest()->GetParsedUri();
+
+	// Same as the URI of EXT-X-PRELOAD-HINT
+	auto path = ov::String::FormatString("/%s/%s/%s", request_uri->App().CStr(), request_uri->Stream().CStr(), file_name.CStr());
+	if (query_string.IsEmpty() == false)
+	{
+		path.AppendFormat("?%s", query_string.CStr());
+	}
+
+	auto pushed_stream = http2_stream->PushPromise(path);
+	if (pushed_stream == nullptr)
+	{
+		return;
+	}
+
+	logtd("[%s/%s/%u] Push the preload hint : %s", GetApplication()->GetName().CStr(), GetStream()->GetName().CStr(), GetId(), path.CStr());
+
+	_last_pushed_parts[track_id] = std::make_pair(segment_number, partial_number);
+
+	// The promised request carries no Origin header, so the CORS headers set by LLHlsPublisher
+	// for the originating request are copied to the pushed response
+	auto origin_response = exchange->GetResponse();
+	auto pushed_response = pushed_stream->GetResponse();
+	for (const auto &header_name : {"Access-Control-Allow-Origin", "Vary", "Access-Control-Allow-Credentials", "Access-Control-Allow-Methods", "Access-Control-Allow-Headers"})
+	{
+		for (const auto &value : origin_response->GetHeader(header_name))
+		{
+			pushed_response->AddHeader(header_name, value);
+		}
+	}
+
+	// The preload hint part is not made yet in most cases, so it is held until OnPlaylistUpdated()
+	ResponsePartialSegment(pushed_stream, file_name, track_id, segment_number, partial_number);
+}
+
 void LLHlsSession::OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
 	logtd("LLHlsSession::OnPlaylistUpdated track_id: %d, msn: %lld, part: %lld", track_id, msn, part);
@@ -71,6 +71,9 @@ private:
 
 	void ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange);
 
+	// Pushes the partial segment of EXT-X-PRELOAD-HINT on the HTTP/2 connection of the chunklist request
+	void PushPreloadHint(const std::shared_ptr<http::svr::HttpExchange> &exchange, const int32_t &track_id, const ov::String &query_string);
+
 	void OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part);
 
 	// Pending requests
@@ -109,4 +112,8 @@ private:
 	int _partial_segment_max_age = -1;
 
 	bool _origin_mode = false;
+
+	bool _preload_hint_push = false;
+	// Track ID : <Segment number, Partial number> of the last pushed partial segment
+	std::map<int32_t, std::pair<int64_t, int64_t>> _last_pushed_parts;
 };
\ No newline at end of file
@@ -37,15 +37,22 @@ bool LLHlsStream::Start()
 		return false;
 	}
 
+	auto config = GetApplication()->GetConfig();
+	auto llhls_config = config.GetPublishers().GetLLHlsPublisher();
+	auto dump_config = llhls_config.GetDumps();
+
+	// Without the stream workers, the requests are handled by the HTTP threads,
+	// and they must not be blocked by reading the DVR segments from the disk
+	if (llhls_config.GetDvr().IsEnabled() && (_worker_count == 0))
+	{
+		_worker_count = 1;
+	}
+
 	if (CreateStreamWorker(_worker_count) == false)
 	{
 		return false;
 	}
 
-	auto config = GetApplication()->GetConfig();
-	auto llhls_config = config.GetPublishers().GetLLHlsPublisher();
-	auto dump_config = llhls_config.GetDumps();
-
 	_stream_key = ov::Random::GenerateString(8);
 
 	_packager_config.chunk_duration_ms = llhls_config.GetChunkDuration() * 1000.0;
@@ -53,6 +60,15 @@ bool LLHlsStream::Start()
 	_storage_config.max_segments = llhls_config.GetSegmentCount();
 	_storage_config.segment_duration_ms = llhls_config.GetSegmentDuration() * 1000;
 
+	auto dvr_config = llhls_config.GetDvr();
+	if (dvr_config.IsEnabled())
+	{
+		_storage_config.dvr_enabled = true;
+		_storage_config.dvr_storage_path = ov::PathManager::Combine(dvr_config.GetTempStoragePath(), 
+																	ov::String::FormatString("%s/%s_%s", GetApplication()->GetName().CStr(), GetName().CStr(), _stream_key.CStr()));
+		_storage_config.dvr_duration_sec = dvr_config.GetMaxDuration();
+	}
+
 	_configured_part_hold_back = llhls_config.GetPartHoldBack();
 
 	// Find data track
@@ -140,8 +156,9 @@ bool LLHlsStream::Start()
 		}
 	}
 
-	logti("LLHlsStream has been created : %s/%u\nOriginMode(%s) Chunk Duration(%.2f) Segment Duration(%u) Segment Count(%u)", GetName().CStr(), GetId(), 
-			ov::Converter::ToString(llhls_config.IsOriginMode()).CStr(), llhls_config.GetChunkDuration(), llhls_config.GetSegmentDuration(), llhls_config.GetSegmentCount());
+	logti("LLHlsStream has been created : %s/%u\nOriginMode(%s) Chunk Duration(%.2f) Segment Duration(%u) Segment Count(%u) DVR(%s, %d sec)", GetName().CStr(), GetId(), 
+			ov::Converter::ToString(llhls_config.IsOriginMode()).CStr(), llhls_config.GetChunkDuration(), llhls_config.GetSegmentDuration(), llhls_config.GetSegmentCount(),
+			ov::Converter::ToString(dvr_config.IsEnabled()).CStr(), dvr_config.GetMaxDuration());
 
 	return Stream::Start();
 }
@@ -150,18 +167,29 @@ bool LLHlsStream::Stop()
 {
 	logtd("LLHlsStream(%u) has been stopped", GetId());
 
-	// clear all packagers
+	// clear all packagers (the other publishers take over appending the packets to them)
 	std::lock_guard<std::shared_mutex> lock(_packager_map_lock);
+	for (const auto &[track_id, packager] : _packager_map)
+	{
+		packager->ReleaseAppender(this);
+	}
 	_packager_map.clear();
 
-	// clear all storages
+	// clear all storages (they may still be used by the other publishers)
 	std::lock_guard<std::shared_mutex> lock2(_storage_map_lock);
+	for (const auto &[track_id, storage] : _storage_map)
+	{
+		storage->RemoveObserver(bmff::FMp4StorageObserver::GetSharedPtr());
+	}
 	_storage_map.clear();
 
 	// clear all playlist
 	std::lock_guard<std::shared_mutex> lock3(_chunklist_map_lock);
 	_chunklist_map.clear();
 
+	std::lock_guard<std::mutex> lock4(_preframed_chunk_map_lock);
+	_preframed_chunk_map.clear();
+
 	return Stream::Stop();
 }
 
@@ -518,7 +546,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 		return { RequestResult::NotFound, nullptr };
 	}
 
-	return { RequestResult::Success, storage->GetMediaSegment(segment_number)->GetData() };
+	return { RequestResult::Success, segment->GetData() };
 }
 
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const
@@ -556,6 +584,52 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return { RequestResult::Success, chunk->GetData() };
 }
 
+std::shared_ptr<const http::svr::h2::PreframedData> LLHlsStream::GetPreframedChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number, const std::shared_ptr<const ov::Data> &chunk_data) const
+{
+	if (chunk_data == nullptr)
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(_preframed_chunk_map_lock);
+
+	auto &preframed_chunks = _preframed_chunk_map[track_id];
+	auto key = std::make_pair(segment_number, chunk_number);
+
+	auto item = preframed_chunks.find(key);
+	if ((item != preframed_chunks.end()) && (item->second->GetPayload() == chunk_data))
+	{
+		return item->second;
+	}
+
+	auto preframed_chunk = std::make_shared<const http::svr::h2::PreframedData>(chunk_data, MAX_HTTP2_DATA_SIZE);
+	preframed_chunks[key] = preframed_chunk;
+
+	return preframed_chunk;
+}
+
+bool LLHlsStream::GetPreloadHintPart(const int32_t &track_id, int64_t &segment_number, int64_t &partial_number, ov::String &file_name) const
+{
+	auto chunklist = GetChunklistWriter(track_id);
+	if (chunklist == nullptr)
+	{
+		return false;
+	}
+
+	int64_t last_msn, last_psn;
+	if ((chunklist->GetLastSequenceNumber(last_msn, last_psn) == false) || (last_msn < 0) || (last_psn < 0))
+	{
+		return false;
+	}
+
+	// Same as the URI of EXT-X-PRELOAD-HINT
+	segment_number = last_msn;
+	partial_number = last_psn + 1;
+	file_name = GetNextPartialSegmentName(track_id, last_msn, last_psn);
+
+	return true;
+}
+
 void LLHlsStream::BufferMediaPacketUntilReadyToPlay(const std::shared_ptr<MediaPacket> &media_packet)
 {
 	if (_initial_media_packet_buffer.Size() >= MAX_INITIAL_MEDIA_PACKET_BUFFER_SIZE)
@@ -663,7 +737,7 @@ void LLHlsStream::SendDataFrame(const std::shared_ptr<MediaPacket> &media_packet
 		}
 		logtd("AppendSample : track(%d) length(%d)", media_packet->GetTrackId(), media_packet->GetDataLength());
 
-		packager->ReserveDataPacket(media_packet);
+		packager->ReserveDataPacket(this, media_packet);
 	}
 }
 
@@ -689,7 +763,18 @@ bool LLHlsStream::AppendMediaPacket(const std::shared_ptr<MediaPacket> &media_pa
 
 		logtd("AppendSample : track(%d) length(%d)", media_packet->GetTrackId(), media_packet->GetDataLength());
 
-		packager->AppendSample(media_packet);
+		packager->AppendSample(this, media_packet);
+
+		if (media_packet->GetIngestTime() > 0)
+		{
+			// OnMediaChunkUpdated() resets it when the partial segment is completed by this sample,
+			// so this sample is the first sample of the next partial segment
+			auto &part_ingest_time = _part_ingest_time_map[track->GetId()];
+			if (part_ingest_time == 0)
+			{
+				part_ingest_time = media_packet->GetIngestTime();
+			}
+		}
 	}
 
 	return true;
@@ -698,18 +783,18 @@ bool LLHlsStream::AppendMediaPacket(const std::shared_ptr<MediaPacket> &media_pa
 // Create and Get fMP4 packager with track info, storage and packager_config
 bool LLHlsStream::AddPackager(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track)
 {
-	// Create Storage
-	auto storage = std::make_shared<bmff::FMP4Storage>(bmff::FMp4StorageObserver::GetSharedPtr(), media_track, _storage_config);
-
-	// Create fMP4 Packager
-	auto packager = std::make_shared<bmff::FMP4Packager>(storage, media_track, data_track, _packager_config);
-
-	// Create Initialization Segment
-	if (packager->CreateInitializationSegment() == false)
+	// Get the fMP4 packager and storage of this stream (the initialization segment is created when the packager is created)
+	auto packager = bmff::FMP4SharedStorage::GetInstance()->GetTrack(GetId(), media_track, data_track, _packager_config, _storage_config);
+	if (packager == nullptr)
 	{
 		logtc("LLHlsStream::AddPackager() - Failed to create initialization segment");
 		return false;
 	}
+
+	auto storage = packager->GetStorage();
+
+	// OnFMp4StorageInitialized() is called immediately
+	storage->AddObserver(bmff::FMp4StorageObserver::GetSharedPtr());
 	
 	{
 		std::lock_guard<std::shared_mutex> storage_lock(_storage_map_lock);
@@ -738,7 +823,7 @@ std::shared_ptr<bmff::FMP4Storage> LLHlsStream::GetStorage(const int32_t &track_
 }
 
 // Get fMP4 packager with the track id
-std::shared_ptr<bmff::FMP4Packager> LLHlsStream::GetPackager(const int32_t &track_id) const
+std::shared_ptr<bmff::FMP4SharedTrack> LLHlsStream::GetPackager(const int32_t &track_id) const
 {
 	std::shared_lock<std::shared_mutex> lock(_packager_map_lock);
 	auto it = _packager_map.find(track_id);
@@ -825,6 +910,11 @@ void LLHlsStream::OnFMp4StorageInitialized(const int32_t &track_id)
 													chunk_duration, 
 													GetIntializationSegmentName(track_id));
 
+	if (_storage_config.dvr_enabled == true)
+	{
+		playlist->EnableDvr(_storage_config.dvr_duration_sec);
+	}
+
 	std::unique_lock<std::shared_mutex> lock(_chunklist_map_lock);
 	_chunklist_map[track_id] = playlist;
 }
@@ -892,7 +982,14 @@ void LLHlsStream::OnMediaSegmentUpdated(const int32_t &track_id, const uint32_t
 		return;
 	}
 
-	auto segment = GetStorage(track_id)->GetMediaSegment(segment_number);
+	auto storage = GetStorage(track_id);
+	if (storage == nullptr)
+	{
+		// The stream has been stopped while the shared storage is being updated by another publisher
+		return;
+	}
+
+	auto segment = storage->GetMediaSegment(segment_number);
 
 	// Timescale to seconds(demical)
 	auto segment_duration = static_cast<double>(segment->GetDuration()) / static_cast<double>(1000.0);
@@ -908,6 +1005,18 @@ void LLHlsStream::OnMediaSegmentUpdated(const int32_t &track_id, const uint32_t
 	logtd("Media segment updated : track_id = %d, segment_number = %d, start_timestamp = %llu, segment_duration = %f", track_id, segment_number, segment->GetStartTimestamp(), segment_duration);
 
 	DumpSegmentOfAllItems(track_id, segment_number);
+
+	// Remove DATA frames of the chunks whose segments are no longer kept in the storage
+	std::lock_guard<std::mutex> preframed_lock(_preframed_chunk_map_lock);
+	auto preframed_chunks = _preframed_chunk_map.find(track_id);
+	if (preframed_chunks != _preframed_chunk_map.end())
+	{
+		auto &chunks = preframed_chunks->second;
+		while ((chunks.empty() == false) && ((chunks.begin()->first.first + static_cast<int64_t>(_storage_config.max_segments)) <= static_cast<int64_t>(segment_number)))
+		{
+			chunks.erase(chunks.begin());
+		}
+	}
 }
 
 void LLHlsStream::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number)
@@ -919,7 +1028,13 @@ void LLHlsStream::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &s
 		return;
 	}
 
-	auto chunk = GetStorage(track_id)->GetMediaChunk(segment_number, chunk_number);
+	auto storage = GetStorage(track_id);
+	if (storage == nullptr)
+	{
+		return;
+	}
+
+	auto chunk = storage->GetMediaChunk(segment_number, chunk_number);
 	
 	// Milliseconds
 	auto chunk_duration = static_cast<float>(chunk->GetDuration()) / static_cast<float>(1000.0);
@@ -934,6 +1049,13 @@ void LLHlsStream::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &s
 
 	playlist->AppendPartialSegmentInfo(segment_number, chunk_info);
 
+	auto part_ingest_time = _part_ingest_time_map.find(track_id);
+	if (part_ingest_time != _part_ingest_time_map.end())
+	{
+		MonitorInstance->RecordLatency(*this, mon::LatencyStage::LLHlsPartReady, part_ingest_time->second);
+		part_ingest_time->second = 0;
+	}
+
 	logtd("Media chunk updated : track_id = %d, segment_number = %d, chunk_number = %d, start_timestamp = %llu, chunk_duration = %f", track_id, segment_number, chunk_number, chunk->GetStartTimestamp(), chunk_duration);
 
 	// Notify
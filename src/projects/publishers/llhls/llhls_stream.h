@@ -12,10 +12,11 @@
 #include <base/publisher/stream.h>
 #include <base/info/dump.h>
 #include <modules/dump/dump.h>
+#include <modules/http/server/http2/http2_preframed_data.h>
 
 #include "monitoring/monitoring.h"
 
-#include "modules/containers/bmff/fmp4_packager/fmp4_packager.h"
+#include "modules/containers/bmff/fmp4_packager/fmp4_shared_storage.h"
 #include "llhls_master_playlist.h"
 #include "llhls_chunklist.h"
 
@@ -71,6 +72,12 @@ public:
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
 
+	// HTTP/2 DATA frames of the chunk, they are made once and shared by all sessions
+	std::shared_ptr<const http::svr::h2::PreframedData> GetPreframedChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number, const std::shared_ptr<const ov::Data> &chunk_data) const;
+
+	// Get the partial segment indicated by EXT-X-PRELOAD-HINT of the chunklist
+	bool GetPreloadHintPart(const int32_t &track_id, int64_t &segment_number, int64_t &partial_number, ov::String &file_name) const;
+
 	// <result, error message>
 	std::tuple<bool, ov::String> StartDump(const std::shared_ptr<info::Dump> &dump_info);
 	std::tuple<bool, ov::String> StopDump(const std::shared_ptr<info::Dump> &dump_info);
@@ -91,9 +98,10 @@ private:
 	void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number) override;
 
 	// Create and Get fMP4 packager and storage with track info, storage and packager_config
+	// (shared with the other publishers of this stream that use the same configuration)
 	bool AddPackager(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track);
 	// Get fMP4 packager with the track id
-	std::shared_ptr<bmff::FMP4Packager> GetPackager(const int32_t &track_id) const;
+	std::shared_ptr<bmff::FMP4SharedTrack> GetPackager(const int32_t &track_id) const;
 	// Get storage with the track id
 	std::shared_ptr<bmff::FMP4Storage> GetStorage(const int32_t &track_id) const;
 	// Get Playlist with the track id
@@ -131,7 +139,7 @@ private:
 	// Track ID : Stroage
 	std::map<int32_t, std::shared_ptr<bmff::FMP4Storage>> _storage_map;
 	mutable std::shared_mutex _storage_map_lock;
-	std::map<int32_t, std::shared_ptr<bmff::FMP4Packager>> _packager_map;
+	std::map<int32_t, std::shared_ptr<bmff::FMP4SharedTrack>> _packager_map;
 	mutable std::shared_mutex _packager_map_lock;
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _chunklist_map;
 	mutable std::shared_mutex _chunklist_map_lock;
@@ -147,6 +155,14 @@ private:
 	bool _playlist_ready = false;
 	mutable std::shared_mutex _playlist_ready_lock;
 
+	// Latency tracing: Ingest time of the first sample of the partial segment being made
+	// Track ID : Ingest time (microseconds)
+	std::map<int32_t, int64_t> _part_ingest_time_map;
+
+	// Track ID : <Segment number, Chunk number> : DATA frames
+	mutable std::map<int32_t, std::map<std::pair<int64_t, int64_t>, std::shared_ptr<const http::svr::h2::PreframedData>>> _preframed_chunk_map;
+	mutable std::mutex _preframed_chunk_map_lock;
+
 	// Reserve
 	void BufferMediaPacketUntilReadyToPlay(const std::shared_ptr<MediaPacket> &media_packet);
 	bool SendBufferedPackets();
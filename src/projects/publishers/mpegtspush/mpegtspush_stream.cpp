@@ -71,7 +71,7 @@ void MpegtsPushStream::SendFrame(const std::shared_ptr<MediaPacket> &media_packe
 
 	auto stream_packet = std::make_any<std::shared_ptr<MediaPacket>>(media_packet);
 
-	BroadcastPacket(stream_packet);
+	BroadcastPacket(stream_packet, media_packet->GetIngestTime());
 
 	MonitorInstance->IncreaseBytesOut(*pub::Stream::GetSharedPtrAs<info::Stream>(), PublisherType::MpegtsPush, media_packet->GetData()->GetLength() * GetSessionCount());
 }
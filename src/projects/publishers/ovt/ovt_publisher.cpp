@@ -198,11 +198,15 @@ void OvtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
 		}
 		else if(app.UpperCaseString() == "PLAY")
 		{
-			HandlePlayRequest(remote, request_id, url);
+			// The edge shares the connection with other streams
+			Json::Value &json_multiplex = object.GetJsonValue()["multiplex"];
+			HandlePlayRequest(remote, request_id, url, json_multiplex.isBool() && json_multiplex.asBool());
 		}
 		else if(app.UpperCaseString() == "STOP")
 		{
-			HandleStopRequest(remote, 0, request_id, url);
+			// Older edges don't send the session id
+			Json::Value &json_session_id = object.GetJsonValue()["sessionId"];
+			HandleStopRequest(remote, json_session_id.isUInt() ? json_session_id.asUInt() : 0, request_id, url);
 		}
 		else
 		{
@@ -287,7 +291,7 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 	ResponseResult(remote, 0, "describe", request_id, 200, "ok", description);
 }
 
-void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
+void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url, bool multiplexed)
 {
 	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(url->Host(), url->App());
 	
@@ -309,8 +313,8 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 		return;
 	}
 
-	// Session ID is remote socket's ID
-	auto session = OvtSession::Create(app, stream, remote->GetNativeHandle(), remote);
+	// The edge demultiplexes the packets of the session using this id
+	auto session = OvtSession::Create(app, stream, ++_last_session_id, remote, multiplexed);
 	if(session == nullptr)
 	{
 		ov::String msg;
@@ -339,10 +343,29 @@ void OvtPublisher::HandleStopRequest(const std::shared_ptr<ov::Socket> &remote,
 		return;
 	}
 
+	if(session_id != 0)
+	{
+		// An edge can only stop the sessions of its own connection
+		auto session = std::static_pointer_cast<OvtSession>(stream->GetSession(session_id));
+		if((session == nullptr) || (session->GetConnector() != remote))
+		{
+			ov::String msg;
+			msg.Format("There is no such session (%u) in the stream (%s/%s)", session_id, vhost_app_name.CStr(), url->Stream().CStr());
+			ResponseResult(remote, 0, "stop", request_id, 404, msg);
+			return;
+		}
+	}
+
 	ResponseResult(remote, session_id, "stop", request_id, 200, "ok");
 
-	// Session ID is remote socket's ID
-	stream->RemoveSession(remote->GetNativeHandle());
+	if(session_id != 0)
+	{
+		stream->RemoveSession(session_id);
+	}
+	else
+	{
+		stream->RemoveSessionByConnectorId(remote->GetNativeHandle());
+	}
 }
 
 void OvtPublisher::ResponseResult(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String app, uint32_t request_id, uint32_t code, const ov::String &msg)
@@ -372,23 +395,7 @@ void OvtPublisher::ResponseResult(const std::shared_ptr<ov::Socket> &remote, uin
 
 void OvtPublisher::SendResponse(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String &payload)
 {
-	OvtPacketizer packetizer;
-
-	if(packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE, ov::Clock::NowMSec(), payload.ToData(false)) == false)
-	{
-		return;
-	}
-
-	while(packetizer.IsAvailablePackets())
-	{
-		auto packet = packetizer.PopPacket();
-		if(packet == nullptr)
-		{
-			return;
-		}
-
-		remote->Send(packet->GetData());
-	}
+	OvtSession::SendMessage(remote, session_id, payload);
 }
 
 bool OvtPublisher::LinkRemoteWithStream(int remote_id, std::shared_ptr<OvtStream> &stream)
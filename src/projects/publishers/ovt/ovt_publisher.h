@@ -53,7 +53,7 @@ private:
 
 
 	void HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
-	void HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
+	void HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url, bool multiplexed);
 	void HandleStopRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
 
 	void ResponseResult(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String app, uint32_t request_id, uint32_t code, const ov::String &msg);
@@ -74,4 +74,7 @@ private:
 	std::map<int, std::shared_ptr<OvtDepacketizer>>	_depacketizers;
 	// When a client is disconnected ungracefully, this map helps to find stream and delete the session quickly
 	std::multimap<int, std::shared_ptr<OvtStream>>	_remote_stream_map;
+
+	// Session ids are unique in the publisher because an edge can pull several streams over one connection (Multiplexed OVT)
+	std::atomic<uint32_t> _last_session_id{0};
 };
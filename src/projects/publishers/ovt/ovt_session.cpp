@@ -1,17 +1,20 @@
 #include <base/info/stream.h>
 #include <base/ovlibrary/byte_io.h>
+#include <base/publisher/application.h>
 #include <base/publisher/stream.h>
 #include <modules/ovt_packetizer/ovt_packet.h>
+#include <modules/ovt_packetizer/ovt_packetizer.h>
 #include "ovt_session.h"
 #include "ovt_private.h"
 
 std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Application> &application,
 										  	   const std::shared_ptr<pub::Stream> &stream,
 										  	   uint32_t session_id,
-										  	   const std::shared_ptr<ov::Socket> &connector)
+										  	   const std::shared_ptr<ov::Socket> &connector,
+										  	   bool multiplexed)
 {
 	auto session_info = info::Session(*std::static_pointer_cast<info::Stream>(stream), session_id);
-	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector);
+	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector, multiplexed);
 	if(!session->Start())
 	{
 		return nullptr;
@@ -22,11 +25,13 @@ std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Applic
 OvtSession::OvtSession(const info::Session &session_info,
 		   const std::shared_ptr<pub::Application> &application,
 		   const std::shared_ptr<pub::Stream> &stream,
-		   const std::shared_ptr<ov::Socket> &connector)
+		   const std::shared_ptr<ov::Socket> &connector,
+		   bool multiplexed)
    : pub::Session(session_info, application, stream)
 {
 	_connector = connector;
 	_sent_ready = false;
+	_multiplexed = multiplexed;
 }
 
 OvtSession::~OvtSession()
@@ -37,6 +42,10 @@ OvtSession::~OvtSession()
 
 bool OvtSession::Start()
 {
+	auto &ovt_config = GetApplication()->GetConfig().GetPublishers().GetOvtPublisher();
+	_slow_consumer_policy.SetMaxBufferedBytes(std::max(ovt_config.GetMaxSendBufferSize(), 0));
+	_dropped_frames_report_timer.Start();
+
 	logtd("OvtSession(%d) has started", GetId());
 	return Session::Start();
 }
@@ -44,18 +53,38 @@ bool OvtSession::Start()
 bool OvtSession::Stop()
 {
 	logtd("OvtSession(%d) has stopped", GetId());
-	_connector->Close();
+
+	if(_slow_consumer_policy.GetDroppedFrameCount() > 0)
+	{
+		logti("OvtSession(%d) dropped %" PRIu64 " frames (%" PRIu64 " bytes) because the edge was too slow to receive",
+			  GetId(), _slow_consumer_policy.GetDroppedFrameCount(), _slow_consumer_policy.GetDroppedBytes());
+	}
+
+	if(_multiplexed)
+	{
+		// Other sessions are using the connector
+		if(GetState() != SessionState::Stopped)
+		{
+			SendStopMessage();
+		}
+	}
+	else
+	{
+		_connector->Close();
+	}
 	
 	return Session::Stop();
 }
 
 void OvtSession::SendOutgoingData(const std::any &packet)
 {
+	OvtStreamPacket stream_packet;
 	std::shared_ptr<OvtPacket> session_packet;
 
 	try 
 	{
-        session_packet = std::any_cast<std::shared_ptr<OvtPacket>>(packet);
+        stream_packet = std::any_cast<OvtStreamPacket>(packet);
+		session_packet = stream_packet.packet;
 		if(session_packet == nullptr)
 		{
 			return;
@@ -78,11 +107,82 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// Set OVT Session ID into packet
-	auto copy_packet = std::make_shared<OvtPacket>(*session_packet);
-	copy_packet->SetSessionId(GetId());
+	// The decision is made at the first packet of each frame, and applied to the rest of the packets of the frame
+	if(_is_first_packet_of_frame)
+	{
+		_send_current_frame = (stream_packet.frame_info == nullptr) ||
+							  _slow_consumer_policy.ShouldSend(*stream_packet.frame_info, _connector->GetDispatchQueueBytes());
+	}
+	_is_first_packet_of_frame = session_packet->Marker();
+
+	if(_send_current_frame == false)
+	{
+		ReportDroppedFrames();
+		return;
+	}
 
-	_connector->Send(copy_packet->GetData());
+	// The packet is shared by all sessions of the stream, so only the header with the session id is created per session
+	// and the payload is sent without copying
+	_connector->Send(session_packet->MakeHeader(GetId()), session_packet->GetPayloadData());
+}
+
+void OvtSession::SendStopMessage()
+{
+	Json::Value root;
+
+	root["id"] = 0;
+	root["application"] = "stop";
+	root["code"] = 200;
+	root["message"] = "The stream has been terminated";
+
+	SendMessage(_connector, GetId(), ov::Json::Stringify(root));
+}
+
+bool OvtSession::SendMessage(const std::shared_ptr<ov::Socket> &connector, uint32_t session_id, const ov::String &payload)
+{
+	OvtPacketizer packetizer;
+	if(packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE, ov::Clock::NowMSec(), payload.ToData(false)) == false)
+	{
+		return false;
+	}
+
+	// The packets of the message are sent at once, so they are not interleaved with the messages sent by other threads
+	// (Responses are sent by the network thread and the stop messages by the stream threads)
+	auto message = std::make_shared<ov::Data>();
+
+	while(packetizer.IsAvailablePackets())
+	{
+		auto packet = packetizer.PopPacket();
+		if(packet == nullptr)
+		{
+			return false;
+		}
+
+		packet->SetSessionId(session_id);
+		message->Append(packet->GetData());
+	}
+
+	return connector->Send(message);
+}
+
+void OvtSession::ReportDroppedFrames()
+{
+	auto dropped_frame_count = _slow_consumer_policy.GetDroppedFrameCount();
+
+	if((dropped_frame_count > _reported_dropped_frame_count) &&
+	   _dropped_frames_report_timer.IsElapsed(OVT_DROPPED_FRAMES_LOG_INTERVAL_MS) && _dropped_frames_report_timer.Update())
+	{
+		logtw("OvtSession(%d) is dropping frames because the edge is too slow to receive: %" PRIu64 " frames since the last report (total: %" PRIu64 " frames, %" PRIu64 " bytes, %zu bytes are waiting to be sent)",
+			  GetId(), dropped_frame_count - _reported_dropped_frame_count,
+			  dropped_frame_count, _slow_consumer_policy.GetDroppedBytes(), _connector->GetDispatchQueueBytes());
+
+		_reported_dropped_frame_count = dropped_frame_count;
+	}
+}
+
+uint64_t OvtSession::GetDroppedFrameCount() const
+{
+	return _slow_consumer_policy.GetDroppedFrameCount();
 }
 
 const std::shared_ptr<ov::Socket> OvtSession::GetConnector()
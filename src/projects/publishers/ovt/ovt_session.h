@@ -3,6 +3,19 @@
 #include <base/info/media_track.h>
 #include <base/ovsocket/socket.h>
 #include <base/publisher/session.h>
+#include <base/publisher/slow_consumer_policy.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
+
+// A packet broadcasted by OvtStream to OvtSessions
+struct OvtStreamPacket
+{
+	std::shared_ptr<OvtPacket> packet;
+	// Attributes of the frame that the packet belongs to (nullptr if the slow consumer policy is disabled)
+	std::shared_ptr<const pub::SlowConsumerPolicy::FrameInfo> frame_info;
+};
+
+// Interval of the warnings while the frames are dropped for a slow edge
+#define OVT_DROPPED_FRAMES_LOG_INTERVAL_MS 5000
 
 class OvtSession : public pub::Session
 {
@@ -10,12 +23,14 @@ public:
 	static std::shared_ptr<OvtSession> Create(const std::shared_ptr<pub::Application> &application,
 											  const std::shared_ptr<pub::Stream> &stream,
 											  uint32_t ovt_session_id,
-											  const std::shared_ptr<ov::Socket> &connector);
+											  const std::shared_ptr<ov::Socket> &connector,
+											  bool multiplexed = false);
 
 	OvtSession(const info::Session &session_info,
 			const std::shared_ptr<pub::Application> &application,
 			const std::shared_ptr<pub::Stream> &stream,
-			const std::shared_ptr<ov::Socket> &connector);
+			const std::shared_ptr<ov::Socket> &connector,
+			bool multiplexed = false);
 	~OvtSession() override;
 
 	bool Start() override;
@@ -26,7 +41,26 @@ public:
 
 	const std::shared_ptr<ov::Socket> GetConnector();
 
+	uint64_t GetDroppedFrameCount() const;
+
+	// Sends a message (response) to the edge
+	static bool SendMessage(const std::shared_ptr<ov::Socket> &connector, uint32_t session_id, const ov::String &payload);
+
 private:
+	// Notifies the edge that this session is terminated without closing the shared connection
+	void SendStopMessage();
+	// Logs the frames dropped since the last report (at most once per OVT_DROPPED_FRAMES_LOG_INTERVAL_MS)
+	void ReportDroppedFrames();
+
 	std::shared_ptr<ov::Socket>		_connector;
 	bool 							_sent_ready;
+	// If true, the connector is shared by the sessions of several streams (Multiplexed OVT)
+	bool							_multiplexed = false;
+
+	// Drops frames when the edge can't receive the data as fast as the stream produces it
+	pub::SlowConsumerPolicy			_slow_consumer_policy;
+	bool							_is_first_packet_of_frame = true;
+	bool							_send_current_frame = true;
+	ov::StopWatch					_dropped_frames_report_timer;
+	uint64_t						_reported_dropped_frame_count = 0;
 };
@@ -43,6 +43,8 @@ bool OvtStream::Start()
 	logtd("OvtStream(%d) has been started", GetId());
 	_packetizer = std::make_shared<OvtPacketizer>(OvtPacketizerInterface::GetSharedPtr());
 
+	_slow_consumer_policy_enabled = GetApplicationInfo().GetConfig().GetPublishers().GetOvtPublisher().GetMaxSendBufferSize() > 0;
+
 	return Stream::Start();
 }
 
@@ -239,6 +241,7 @@ void OvtStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
 	std::shared_lock<std::shared_mutex> mlock(_packetizer_lock);
 	if(_packetizer != nullptr)
 	{
+		UpdateCurrentFrameInfo(media_packet);
 		_packetizer->PacketizeMediaPacket(media_packet->GetPts(), media_packet);
 	}
 }
@@ -254,15 +257,24 @@ void OvtStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
 	std::shared_lock<std::shared_mutex> mlock(_packetizer_lock);
 	if(_packetizer != nullptr)
 	{
+		UpdateCurrentFrameInfo(media_packet);
 		_packetizer->PacketizeMediaPacket(media_packet->GetPts(), media_packet);
 	}
 }
 
+void OvtStream::UpdateCurrentFrameInfo(const std::shared_ptr<MediaPacket> &media_packet)
+{
+	// The attributes are evaluated once per frame and shared by all sessions
+	_current_frame_info = _slow_consumer_policy_enabled ? std::make_shared<pub::SlowConsumerPolicy::FrameInfo>(pub::SlowConsumerPolicy::GetFrameInfo(media_packet)) : nullptr;
+	_current_ingest_time_us = media_packet->GetIngestTime();
+}
+
 bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
 {
 	// Broadcasting
-	auto stream_packet = std::make_any<std::shared_ptr<OvtPacket>>(packet);
-	BroadcastPacket(stream_packet);
+	auto stream_packet = std::make_any<OvtStreamPacket>(OvtStreamPacket{packet, _current_frame_info});
+	BroadcastPacket(stream_packet, _current_ingest_time_us);
+	_current_ingest_time_us = 0;
 	
 	
 	MonitorInstance->IncreaseBytesOut(*pub::Stream::GetSharedPtrAs<info::Stream>(), PublisherType::Ovt, packet->GetData()->GetLength() * GetSessionCount());
@@ -289,6 +301,9 @@ bool OvtStream::RemoveSessionByConnectorId(int connector_id)
 
 	logtd("RemoveSessionByConnectorId : all(%d) connector(%d)", sessions.size(), connector_id);
 
+	bool removed = false;
+
+	// A multiplexed connection can have several sessions of the same stream
 	for(const auto &item : sessions)
 	{
 		auto session = std::static_pointer_cast<OvtSession>(item.second);
@@ -297,9 +312,9 @@ bool OvtStream::RemoveSessionByConnectorId(int connector_id)
 		if(session->GetConnector()->GetNativeHandle() == connector_id)
 		{
 			RemoveSession(session->GetId());
-			return true;
+			removed = true;
 		}
 	}
 
-	return false;
+	return removed;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <base/common_types.h>
 #include <base/publisher/stream.h>
+#include <base/publisher/slow_consumer_policy.h>
 #include <modules/ovt_packetizer/ovt_packetizer.h>
 
 #include "monitoring/monitoring.h"
@@ -33,10 +34,18 @@ private:
 	bool Stop() override;
 
 	bool GenerateDecription();
+	void UpdateCurrentFrameInfo(const std::shared_ptr<MediaPacket> &media_packet);
 
 	uint32_t							_worker_count = 0;
 
 	Json::Value							_description;
 	std::shared_mutex					_packetizer_lock;
 	std::shared_ptr<OvtPacketizer>		_packetizer;
+
+	// If true, the attributes of each frame are evaluated for the slow consumer policy of the sessions
+	bool								_slow_consumer_policy_enabled = false;
+	// Attributes of the frame being packetized
+	std::shared_ptr<const pub::SlowConsumerPolicy::FrameInfo>	_current_frame_info;
+	// Ingest time of the frame being packetized (only the first packet of the frame records the latency)
+	int64_t								_current_ingest_time_us = 0;
 };
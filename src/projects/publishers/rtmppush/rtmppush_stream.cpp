@@ -71,7 +71,7 @@ void RtmpPushStream::SendFrame(const std::shared_ptr<MediaPacket> &media_packet)
 
 	auto stream_packet = std::make_any<std::shared_ptr<MediaPacket>>(media_packet);
 
-	BroadcastPacket(stream_packet);
+	BroadcastPacket(stream_packet, media_packet->GetIngestTime());
 
 	MonitorInstance->IncreaseBytesOut(*pub::Stream::GetSharedPtrAs<info::Stream>(), PublisherType::RtmpPush, media_packet->GetData()->GetLength() * GetSessionCount());
 }
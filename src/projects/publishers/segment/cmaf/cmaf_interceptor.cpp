@@ -46,4 +46,9 @@ bool CmafInterceptor::IsInterceptorForRequest(const std::shared_ptr<const http::
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+std::vector<ov::String> CmafInterceptor::GetRoutingExtensions() const
+{
+	return {DASH_PLAYLIST_EXT, DASH_SEGMENT_EXT};
+}
@@ -151,6 +151,25 @@ void CmafStreamServer::OnCmafChunkDataPush(const ov::String &app_name, const ov:
 		}
 		auto stream_info = GetStream(client);
 
+		if (stream_info != nullptr)
+		{
+			// Frames can't be dropped in the middle of the chunked fMP4, so a client that can't keep up is disconnected
+			// before its send buffer grows without bound
+			auto max_send_buffer_size = stream_info->GetApplicationInfo().GetConfig().GetPublishers().GetLlDashPublisher().GetMaxSendBufferSize();
+			auto buffered_bytes = response->GetRemote()->GetDispatchQueueBytes();
+
+			if ((max_send_buffer_size > 0) && (buffered_bytes > static_cast<size_t>(max_send_buffer_size)))
+			{
+				logtw("[%s/%s] [%s] Disconnect %s because the client is too slow to receive (%zu bytes are waiting to be sent)",
+					  app_name.CStr(), stream_name.CStr(), StringFromPublisherType(GetPublisherType()).CStr(),
+					  response->GetRemote()->ToString().CStr(), buffered_bytes);
+
+				client_item = chunk_item->second->client_list.erase(client_item);
+				response->Close();
+				continue;
+			}
+		}
+
 		if (response->SendChunkedData(chunk_data))
 		{
 			if (stream_info != nullptr)
@@ -11,6 +11,7 @@
 #include <base/publisher/publisher.h>
 
 #include "../segment_stream/segment_stream.h"
+#include "dash_define.h"
 #include "dash_packetizer.h"
 #include "dash_private.h"
 
@@ -55,6 +56,35 @@ bool DashApplication::Start()
 		_utc_timing_value = utc_timing.GetValue();
 	}
 
+	// The segments are packaged only once per stream: if LL-HLS makes the segments of the same duration,
+	// DASH uses the same configuration so that both of them serve the segments from the same storage
+	auto &llhls_config = GetConfig().GetPublishers().GetLLHlsPublisher();
+
+	_share_with_llhls = llhls_config.IsParsed() && (llhls_config.GetSegmentDuration() == _segment_duration);
+
+	if (_share_with_llhls)
+	{
+		_packager_config.chunk_duration_ms = llhls_config.GetChunkDuration() * 1000.0;
+		_packager_config.segment_duration_ms = llhls_config.GetSegmentDuration() * 1000.0;
+		_storage_config.max_segments = llhls_config.GetSegmentCount();
+		_storage_config.segment_duration_ms = llhls_config.GetSegmentDuration() * 1000;
+
+		auto &dvr_config = llhls_config.GetDvr();
+		if (dvr_config.IsEnabled())
+		{
+			_storage_config.dvr_enabled = true;
+			_storage_config.dvr_duration_sec = dvr_config.GetMaxDuration();
+			_dvr_temp_storage_path = dvr_config.GetTempStoragePath();
+		}
+	}
+	else
+	{
+		_packager_config.chunk_duration_ms = DASH_FMP4_CHUNK_DURATION_MS;
+		_packager_config.segment_duration_ms = _segment_duration * 1000.0;
+		_storage_config.max_segments = _segment_count;
+		_storage_config.segment_duration_ms = _segment_duration * 1000;
+	}
+
 	return Application::Start();
 }
 
@@ -67,15 +97,54 @@ std::shared_ptr<pub::Stream> DashApplication::CreateStream(const std::shared_ptr
 		GetSharedPtrAs<pub::Application>(), *info.get(),
 		[=](ov::String app_name, ov::String stream_name,
 			std::shared_ptr<MediaTrack> video_track, std::shared_ptr<MediaTrack> audio_track) -> std::shared_ptr<Packetizer> {
+			auto video_fmp4_track = GetFMP4Track(info, video_track);
+			auto audio_fmp4_track = GetFMP4Track(info, audio_track);
+
+			// Both tracks must be packaged in the same way
+			if (((video_track != nullptr) && (video_fmp4_track == nullptr)) ||
+				((audio_track != nullptr) && (audio_fmp4_track == nullptr)))
+			{
+				video_fmp4_track = nullptr;
+				audio_fmp4_track = nullptr;
+			}
+
 			return std::make_shared<DashPacketizer>(
 				server_config->GetName(), app_name, stream_name,
 				_segment_count, _segment_duration,
 				_utc_timing_scheme, _utc_timing_value,
 				video_track, audio_track,
+				video_fmp4_track, audio_fmp4_track,
 				nullptr);
 		}, _segment_duration);
 }
 
+std::shared_ptr<bmff::FMP4SharedTrack> DashApplication::GetFMP4Track(const std::shared_ptr<info::Stream> &info, const std::shared_ptr<MediaTrack> &track) const
+{
+	if (track == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Same as the codecs supported by bmff::FMP4Packager
+	if ((track->GetCodecId() != cmn::MediaCodecId::H264) && (track->GetCodecId() != cmn::MediaCodecId::Aac))
+	{
+		return nullptr;
+	}
+
+	auto storage_config = _storage_config;
+	// LL-HLS packages the media with the data track (for ID3 timed metadata)
+	auto data_track = _share_with_llhls ? info->GetFirstTrack(cmn::MediaType::Data) : nullptr;
+
+	if (storage_config.dvr_enabled)
+	{
+		// Used only if DASH creates the track before LL-HLS
+		storage_config.dvr_storage_path = ov::PathManager::Combine(_dvr_temp_storage_path,
+																   ov::String::FormatString("%s/%s_%s", GetName().CStr(), info->GetName().CStr(), ov::Random::GenerateString(8).CStr()));
+	}
+
+	return bmff::FMP4SharedStorage::GetInstance()->GetTrack(info->GetId(), track, data_track, _packager_config, storage_config);
+}
+
 bool DashApplication::DeleteStream(const std::shared_ptr<info::Stream> &info)
 {
 	logtd("DASH Stream is deleted: %s/%u", info->GetName().CStr(), info->GetId());
@@ -7,6 +7,7 @@
 //
 //==============================================================================
 #pragma once
+#include <modules/containers/bmff/fmp4_packager/fmp4_shared_storage.h>
 #include <publishers/segment/segment_stream/segment_stream.h>
 
 #include "base/common_types.h"
@@ -32,10 +33,20 @@ private:
 	std::shared_ptr<pub::Stream> CreateStream(const std::shared_ptr<info::Stream> &info, uint32_t thread_count) override;
 	bool DeleteStream(const std::shared_ptr<info::Stream> &info) override;
 
+	// Returns the fMP4 track shared with the other publishers (such as LL-HLS) of the stream,
+	// or nullptr if the codec is not supported by the fMP4 packager
+	std::shared_ptr<bmff::FMP4SharedTrack> GetFMP4Track(const std::shared_ptr<info::Stream> &info, const std::shared_ptr<MediaTrack> &track) const;
+
 private:
 	int _segment_count;
 	int _segment_duration;
 
 	ov::String _utc_timing_scheme;
 	ov::String _utc_timing_value;
+
+	// If LL-HLS is enabled with the same segment duration, the configuration of LL-HLS is used to share the segments with it
+	bool _share_with_llhls = false;
+	bmff::FMP4Packager::Config _packager_config;
+	bmff::FMP4Storage::Config _storage_config;
+	ov::String _dvr_temp_storage_path;
 };
@@ -27,6 +27,9 @@
 // manifest.mpd
 #define DASH_PLAYLIST_FULL_FILE_NAME		DASH_PLAYLIST_FILE_NAME													"."	DASH_PLAYLIST_EXT
 
+// Duration of the fragments (moof + mdat) in a segment when DASH packages the segments by itself
+#define DASH_FMP4_CHUNK_DURATION_MS			500.0
+
 // _video_ll.m4s
 #define CMAF_MPD_VIDEO_FULL_SUFFIX			DASH_MPD_VIDEO_SUFFIX							DASH_LOW_LATENCY_SUFFIX	"."	DASH_SEGMENT_EXT
 // _audio_ll.m4s
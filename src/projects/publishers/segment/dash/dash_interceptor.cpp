@@ -39,4 +39,9 @@ bool DashInterceptor::IsInterceptorForRequest(const std::shared_ptr<const http::
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+std::vector<ov::String> DashInterceptor::GetRoutingExtensions() const
+{
+	return {DASH_PLAYLIST_EXT, DASH_SEGMENT_EXT};
+}
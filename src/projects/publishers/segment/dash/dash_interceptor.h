@@ -17,4 +17,5 @@ public:
 	// Implementation of HttpRequestInterceptorInterface
 	//--------------------------------------------------------------------
 	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &client) override;
+	std::vector<ov::String> GetRoutingExtensions() const override;
 };
@@ -37,6 +37,7 @@ DashPacketizer::DashPacketizer(const ov::String &service_name, const ov::String
 							   uint32_t segment_count, uint32_t segment_duration,
 							   const ov::String &utc_timing_scheme, const ov::String &utc_timing_value,
 							   std::shared_ptr<MediaTrack> video_track, std::shared_ptr<MediaTrack> audio_track,
+							   const std::shared_ptr<bmff::FMP4SharedTrack> &video_fmp4_track, const std::shared_ptr<bmff::FMP4SharedTrack> &audio_fmp4_track,
 							   const std::shared_ptr<ChunkedTransferInterface> &chunked_transfer)
 	: Packetizer(service_name, app_name, stream_name,
 				 segment_count, segment_count * 2, segment_duration,
@@ -47,7 +48,10 @@ DashPacketizer::DashPacketizer(const ov::String &service_name, const ov::String
 	  _utc_timing_value(utc_timing_value),
 
 	  _video_m4s_writer(Writer::Type::M4s, Writer::MediaType::Video),
-	  _audio_m4s_writer(Writer::Type::M4s, Writer::MediaType::Audio)
+	  _audio_m4s_writer(Writer::Type::M4s, Writer::MediaType::Audio),
+
+	  _video_fmp4_track(video_fmp4_track),
+	  _audio_fmp4_track(audio_fmp4_track)
 {
 	_mpd_min_buffer_time = 6;
 
@@ -61,6 +65,17 @@ DashPacketizer::DashPacketizer(const ov::String &service_name, const ov::String
 
 DashPacketizer::~DashPacketizer()
 {
+	// The other publishers take over appending the packets to the shared tracks
+	if (_video_fmp4_track != nullptr)
+	{
+		_video_fmp4_track->ReleaseAppender(this);
+	}
+
+	if (_audio_fmp4_track != nullptr)
+	{
+		_audio_fmp4_track->ReleaseAppender(this);
+	}
+
 	_video_m4s_writer.Finalize();
 	_audio_m4s_writer.Finalize();
 }
@@ -89,11 +104,18 @@ void DashPacketizer::SetVideoTrack(const std::shared_ptr<MediaTrack> &video_trac
 			}
 			else
 			{
-				if (_video_m4s_writer.AddTrack(video_track))
+				if ((_video_fmp4_track != nullptr) || _video_m4s_writer.AddTrack(video_track))
 				{
 					_ideal_duration_for_video = _segment_duration * _video_timescale;
 					_ideal_duration_for_video_in_ms = static_cast<int64_t>(_segment_duration * 1000);
 
+					uint32_t resolution_gcd = std::gcd(video_track->GetWidth(), video_track->GetHeight());
+
+					if (resolution_gcd != 0)
+					{
+						_pixel_aspect_ratio.Format("%d:%d", video_track->GetWidth() / resolution_gcd, video_track->GetHeight() / resolution_gcd);
+					}
+
 					_video_enable = true;
 				}
 				else
@@ -135,7 +157,7 @@ void DashPacketizer::SetAudioTrack(const std::shared_ptr<MediaTrack> &audio_trac
 			}
 			else
 			{
-				if (_audio_m4s_writer.AddTrack(audio_track))
+				if ((_audio_fmp4_track != nullptr) || _audio_m4s_writer.AddTrack(audio_track))
 				{
 					_ideal_duration_for_audio = _segment_duration * _audio_timescale;
 					_ideal_duration_for_audio_in_ms = static_cast<int64_t>(_segment_duration * 1000);
@@ -222,16 +244,8 @@ bool DashPacketizer::PrepareVideoInitIfNeeded()
 		return false;
 	}
 
-	auto video_track = _video_track;
 	_video_init_file = std::make_shared<SegmentItem>(SegmentDataType::Video, 0, DASH_MPD_VIDEO_INIT_FILE_NAME, 0, 0, 0, 0, init_data);
 
-	uint32_t resolution_gcd = std::gcd(video_track->GetWidth(), video_track->GetHeight());
-
-	if (resolution_gcd != 0)
-	{
-		_pixel_aspect_ratio.Format("%d:%d", video_track->GetWidth() / resolution_gcd, video_track->GetHeight() / resolution_gcd);
-	}
-
 	DumpSegmentToFile(_video_init_file);
 
 	logai("%s has created", DASH_MPD_VIDEO_INIT_FILE_NAME);
@@ -263,7 +277,6 @@ bool DashPacketizer::PrepareAudioInitIfNeeded()
 		return false;
 	}
 
-	auto audio_track = _audio_track;
 	_audio_init_file = std::make_shared<SegmentItem>(SegmentDataType::Audio, 0, DASH_MPD_AUDIO_INIT_FILE_NAME, 0, 0, 0, 0, init_data);
 
 	DumpSegmentToFile(_audio_init_file);
@@ -339,6 +352,138 @@ bool DashPacketizer::WriteAudioSegment()
 	return false;
 }
 
+bool DashPacketizer::PrepareInitFromFMP4Track(const std::shared_ptr<bmff::FMP4SharedTrack> &fmp4_track, cmn::MediaType media_type)
+{
+	bool is_video = (media_type == cmn::MediaType::Video);
+	auto &init_file = is_video ? _video_init_file : _audio_init_file;
+
+	if (init_file != nullptr)
+	{
+		return true;
+	}
+
+	// The initialization section is created when the track is created
+	auto init_data = fmp4_track->GetStorage()->GetInitializationSection();
+
+	if (init_data == nullptr)
+	{
+		return false;
+	}
+
+	auto file_name = is_video ? DASH_MPD_VIDEO_INIT_FILE_NAME : DASH_MPD_AUDIO_INIT_FILE_NAME;
+	init_file = std::make_shared<SegmentItem>(is_video ? SegmentDataType::Video : SegmentDataType::Audio, 0, file_name, 0, 0, 0, 0, init_data);
+
+	DumpSegmentToFile(init_file);
+
+	logai("%s has created from the shared fMP4 storage", file_name);
+
+	return true;
+}
+
+bool DashPacketizer::AppendPacketToFMP4Track(const std::shared_ptr<bmff::FMP4SharedTrack> &fmp4_track, const std::shared_ptr<const MediaPacket> &media_packet)
+{
+	auto media_type = media_packet->GetMediaType();
+
+	if (PrepareInitFromFMP4Track(fmp4_track, media_type) == false)
+	{
+		logae("Could not prepare %s init", ::StringFromMediaType(media_type).CStr());
+		return false;
+	}
+
+	// If another publisher (such as LL-HLS) appends the packets, it is ignored
+	if (fmp4_track->AppendSample(this, media_packet) == false)
+	{
+		return false;
+	}
+
+	if (media_type == cmn::MediaType::Video)
+	{
+		_last_video_pts = media_packet->GetPts();
+	}
+	else
+	{
+		_last_audio_pts = media_packet->GetPts();
+	}
+
+	return UpdateSegmentsFromFMP4Track(fmp4_track, media_type);
+}
+
+bool DashPacketizer::UpdateSegmentsFromFMP4Track(const std::shared_ptr<bmff::FMP4SharedTrack> &fmp4_track, cmn::MediaType media_type)
+{
+	bool is_video = (media_type == cmn::MediaType::Video);
+
+	auto &storage = fmp4_track->GetStorage();
+	auto &next_segment_number = is_video ? _next_video_segment_number : _next_audio_segment_number;
+	auto &segment_queue = is_video ? _video_segment_queue : _audio_segment_queue;
+	auto &sequence_number = is_video ? _video_sequence_number : _audio_sequence_number;
+	auto &start_time = is_video ? _video_start_time : _audio_start_time;
+	auto timescale = is_video ? _video_timescale : _audio_timescale;
+	auto timebase_expr_ms = is_video ? _video_timebase_expr_ms : _audio_timebase_expr_ms;
+
+	auto last_segment_number = storage->GetLastSegmentNumber();
+
+	if (next_segment_number < 0LL)
+	{
+		// Start from the segment being made, the previous segments might be made before this stream is started
+		next_segment_number = last_segment_number;
+
+		if (next_segment_number < 0LL)
+		{
+			return true;
+		}
+	}
+
+	bool updated = false;
+
+	while (next_segment_number <= last_segment_number)
+	{
+		auto segment = storage->GetMediaSegment(next_segment_number);
+
+		if (segment == nullptr)
+		{
+			// The segment has been removed from the storage
+			next_segment_number++;
+			continue;
+		}
+
+		if (segment->IsCompleted() == false)
+		{
+			break;
+		}
+
+		int64_t timestamp = segment->GetStartTimestamp();
+		int64_t duration = std::llround(segment->GetDuration() * timescale / 1000.0);
+
+		// The data of the segment is shared with the storage
+		auto segment_item = segment_queue.Append(
+			is_video ? SegmentDataType::Video : SegmentDataType::Audio, segment->GetNumber(),
+			GetFileName(segment->GetNumber(), media_type),
+			timestamp, timestamp * timebase_expr_ms,
+			duration, static_cast<int64_t>(segment->GetDuration()),
+			segment->GetData());
+
+		DumpSegmentToFile(segment_item);
+
+		if (start_time == -1LL)
+		{
+			// The time when the timestamp of the media is 0, since the segment timeline uses the timestamps of the media
+			start_time = ov::Time::GetTimestampInMs() - ((timestamp + duration) * timebase_expr_ms);
+		}
+
+		sequence_number++;
+		next_segment_number++;
+		updated = true;
+	}
+
+	if (updated)
+	{
+		UpdateReadyForStreaming();
+		UpdatePlayList();
+	}
+
+	return true;
+}
+
 bool DashPacketizer::ResetPacketizer(uint32_t new_msid)
 {
 	return true;
@@ -377,6 +522,11 @@ bool DashPacketizer::AppendVideoPacket(const std::shared_ptr<const MediaPacket>
 		_video_key_frame_received = true;
 	}
 
+	if (_video_fmp4_track != nullptr)
+	{
+		return AppendPacketToFMP4Track(_video_fmp4_track, media_packet);
+	}
+
 	if (PrepareVideoInitIfNeeded() == false)
 	{
 		logae("Could not prepare video init");
@@ -434,6 +584,11 @@ bool DashPacketizer::AppendAudioPacket(const std::shared_ptr<const MediaPacket>
 
 	_audio_key_frame_received = true;
 
+	if (_audio_fmp4_track != nullptr)
+	{
+		return AppendPacketToFMP4Track(_audio_fmp4_track, media_packet);
+	}
+
 	if (PrepareAudioInitIfNeeded() == false)
 	{
 		logae("Could not prepare audio init");
@@ -446,7 +601,7 @@ bool DashPacketizer::AppendAudioPacket(const std::shared_ptr<const MediaPacket>
 
 	if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::AAC_ADTS)
 	{
-		data = AacConverter::ConvertAdtsToRaw(data, &length_list);
+		data = AacConverter::GetRawData(media_packet, &length_list);
 	}
 	else
 	{
@@ -584,6 +739,11 @@ bool DashPacketizer::UpdatePlayList()
 					<< R"(value="main" />)" << std::endl;
 			}
 
+			if (_video_fmp4_track != nullptr)
+			{
+				xml << MakeSegmentTemplate(_video_segment_queue, _video_timescale, DASH_MPD_VIDEO_INIT_FILE_NAME, DASH_MPD_VIDEO_FULL_SUFFIX).CStr();
+			}
+			else
 			{
 				xml
 					// <SegmentTemplate />
@@ -633,6 +793,11 @@ bool DashPacketizer::UpdatePlayList()
 					<< R"(value="main" />)" << std::endl;
 			}
 
+			if (_audio_fmp4_track != nullptr)
+			{
+				xml << MakeSegmentTemplate(_audio_segment_queue, _audio_timescale, DASH_MPD_AUDIO_INIT_FILE_NAME, DASH_MPD_AUDIO_FULL_SUFFIX).CStr();
+			}
+			else
 			{
 				xml
 					// <SegmentTemplate />
@@ -706,6 +871,42 @@ bool DashPacketizer::UpdatePlayList()
 	return true;
 }
 
+ov::String DashPacketizer::MakeSegmentTemplate(SegmentQueue &segment_queue, double timescale, const char *init_file_name, const char *segment_suffix) const
+{
+	// The durations of the segments made by the fMP4 packager are not constant (they start with a key frame),
+	// so the segments are described by the timeline instead of the fixed duration
+	ov::String segment_timeline;
+	int start_number = -1;
+
+	segment_queue.Iterate([&](std::shared_ptr<const SegmentItem> segment_item) -> bool {
+		if (start_number < 0)
+		{
+			start_number = segment_item->sequence_number;
+		}
+
+		segment_timeline.AppendFormat(R"(					<S t="%lld" d="%lld" />)"
+									  "\n",
+									  segment_item->timestamp, segment_item->duration);
+
+		return true;
+	});
+
+	ov::String segment_template;
+
+	segment_template.AppendFormat(R"(			<SegmentTemplate startNumber="%d" timescale="%lld" initialization="%s" media="$Number$%s">)"
+								  "\n",
+								  std::max(start_number, 0), static_cast<int64_t>(timescale), init_file_name, segment_suffix);
+	segment_template.Append(R"(				<SegmentTimeline>)"
+							"\n");
+	segment_template.Append(segment_timeline);
+	segment_template.Append(R"(				</SegmentTimeline>)"
+							"\n");
+	segment_template.Append(R"(			</SegmentTemplate>)"
+							"\n");
+
+	return segment_template;
+}
+
 std::shared_ptr<const SegmentItem> DashPacketizer::GetSegmentData(const ov::String &file_name) const
 {
 	if (IsReadyForStreaming() == false)
@@ -790,6 +991,13 @@ bool DashPacketizer::SetSegmentData(Writer &writer, int64_t timestamp)
 			return false;
 	}
 
+	UpdateReadyForStreaming();
+
+	return true;
+}
+
+void DashPacketizer::UpdateReadyForStreaming()
+{
 	if (IsReadyForStreaming() == false)
 	{
 		if (
@@ -802,8 +1010,6 @@ bool DashPacketizer::SetSegmentData(Writer &writer, int64_t timestamp)
 				  _segment_duration, _segment_count);
 		}
 	}
-
-	return true;
 }
 
 void DashPacketizer::SetReadyForStreaming() noexcept
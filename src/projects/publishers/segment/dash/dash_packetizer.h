@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include <modules/containers/bmff/fmp4_packager/fmp4_shared_storage.h>
 #include <modules/segment_writer/writer.h>
 #include <publishers/segment/segment_stream/packetizer/m4s_init_writer.h>
 #include <publishers/segment/segment_stream/packetizer/m4s_segment_writer.h>
@@ -30,6 +31,7 @@ public:
 				   uint32_t segment_count, uint32_t segment_duration,
 				   const ov::String &utc_timing_scheme, const ov::String &utc_timing_value,
 				   std::shared_ptr<MediaTrack> video_track, std::shared_ptr<MediaTrack> audio_track,
+				   const std::shared_ptr<bmff::FMP4SharedTrack> &video_fmp4_track, const std::shared_ptr<bmff::FMP4SharedTrack> &audio_fmp4_track,
 				   const std::shared_ptr<ChunkedTransferInterface> &chunked_transfer);
 
 	~DashPacketizer() override;
@@ -67,6 +69,14 @@ protected:
 	bool WriteVideoSegment();
 	bool WriteAudioSegment();
 
+	// Used when the segments are served from the fMP4 storage shared with the other publishers
+	bool PrepareInitFromFMP4Track(const std::shared_ptr<bmff::FMP4SharedTrack> &fmp4_track, cmn::MediaType media_type);
+	bool AppendPacketToFMP4Track(const std::shared_ptr<bmff::FMP4SharedTrack> &fmp4_track, const std::shared_ptr<const MediaPacket> &media_packet);
+	// Adds the segments completed since the last call to the segment queue
+	bool UpdateSegmentsFromFMP4Track(const std::shared_ptr<bmff::FMP4SharedTrack> &fmp4_track, cmn::MediaType media_type);
+	void UpdateReadyForStreaming();
+	ov::String MakeSegmentTemplate(SegmentQueue &segment_queue, double timescale, const char *init_file_name, const char *segment_suffix) const;
+
 	bool GetSegmentInfos(ov::String *video_urls, ov::String *audio_urls, double *time_shift_buffer_depth, double *minimum_update_period, size_t segment_count);
 
 	virtual bool UpdatePlayList();
@@ -144,5 +154,12 @@ protected:
 	Writer _video_m4s_writer;
 	Writer _audio_m4s_writer;
 
+	// If they are not nullptr, the writers are not used
+	std::shared_ptr<bmff::FMP4SharedTrack> _video_fmp4_track;
+	std::shared_ptr<bmff::FMP4SharedTrack> _audio_fmp4_track;
+	// The number of the next segment to get from the storage
+	int64_t _next_video_segment_number = -1LL;
+	int64_t _next_audio_segment_number = -1LL;
+
 	ov::StopWatch _stat_stop_watch;
 };
\ No newline at end of file
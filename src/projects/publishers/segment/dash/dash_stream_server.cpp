@@ -29,7 +29,7 @@ bool DashStreamServer::PrepareInterceptors(
 	auto time_interceptor = std::make_shared<TimeInterceptor>();
 
 	time_interceptor->Register(http::Method::All, R"(\/time)", [=](const std::shared_ptr<http::svr::HttpExchange> &client) -> http::svr::NextHandler {
-		auto url = ov::Url::Parse(client->GetRequest()->GetUri());
+		auto &url = client->GetRequest()->GetParsedUri();
 
 		if (url == nullptr)
 		{
@@ -89,6 +89,11 @@ bool DashStreamServer::PrepareInterceptors(
 	return result;
 }
 
+bool DashStreamServer::IsPlayListRequest(const SegmentStreamRequestInfo &request_info, const ov::String &file_ext) const
+{
+	return file_ext == DASH_PLAYLIST_EXT;
+}
+
 bool DashStreamServer::ProcessStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange,
 																   const SegmentStreamRequestInfo &request_info,
 																   const ov::String &file_ext)
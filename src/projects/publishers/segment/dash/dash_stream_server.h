@@ -34,6 +34,8 @@ protected:
 		const std::shared_ptr<http::svr::HttpsServer> &https_server,
 		int thread_count, const SegmentProcessHandler &process_handler) override;
 
+	bool IsPlayListRequest(const SegmentStreamRequestInfo &request_info, const ov::String &file_ext) const override;
+
 	bool ProcessStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &client,
 													 const SegmentStreamRequestInfo &request_info,
 													 const ov::String &file_ext) override;
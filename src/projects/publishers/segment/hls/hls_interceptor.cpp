@@ -47,4 +47,9 @@ bool HlsInterceptor::IsInterceptorForRequest(const std::shared_ptr<const http::s
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+std::vector<ov::String> HlsInterceptor::GetRoutingExtensions() const
+{
+	return {"ts", "m3u8"};
+}
@@ -9,7 +9,6 @@
 #include "hls_packetizer.h"
 
 #include <base/ovlibrary/ovlibrary.h>
-#include <modules/segment_writer/writer.h>
 #include <publishers/segment/segment_stream/packetizer/packetizer_define.h>
 
 #include <algorithm>
@@ -41,9 +40,7 @@ HlsPacketizer::HlsPacketizer(const ov::String &service_name, const ov::String &a
 	: Packetizer(service_name, app_name, stream_name,
 				 segment_count, segment_count * 2, segment_duration,
 				 video_track, audio_track,
-				 chunked_transfer),
-
-	  _ts_writer(Writer::Type::MpegTs, Writer::MediaType::Both)
+				 chunked_transfer)
 {
 	_video_enable = false;
 	_audio_enable = false;
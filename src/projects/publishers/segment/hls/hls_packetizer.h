@@ -8,7 +8,7 @@
 //==============================================================================
 #pragma once
 
-#include <modules/segment_writer/writer.h>
+#include <modules/mpegts/mpegts_packetizer.h>
 
 #include "../segment_stream/packetizer/packetizer.h"
 
@@ -110,7 +110,7 @@ protected:
 	bool _video_ready = false;
 	bool _audio_ready = false;
 
-	Writer _ts_writer;
+	mpegts::MpegTsPacketizer _ts_writer;
 
 	ov::StopWatch _stat_stop_watch;
 };
@@ -11,6 +11,11 @@
 #include "../segment_publisher.h"
 #include "hls_private.h"
 
+bool HlsStreamServer::IsPlayListRequest(const SegmentStreamRequestInfo &request_info, const ov::String &file_ext) const
+{
+	return request_info.file_name == HLS_PLAYLIST_FILE_NAME;
+}
+
 bool HlsStreamServer::ProcessStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange,
 																  const SegmentStreamRequestInfo &request_info,
 																  const ov::String &file_ext)
@@ -34,6 +34,8 @@ protected:
 	//--------------------------------------------------------------------
 	// Implementation of SegmentStreamServer
 	//--------------------------------------------------------------------
+	bool IsPlayListRequest(const SegmentStreamRequestInfo &request_info, const ov::String &file_ext) const override;
+
 	bool ProcessStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &client,
 										const SegmentStreamRequestInfo &request_info,
 										const ov::String &file_ext) override;
@@ -225,6 +225,46 @@ bool SegmentPublisher::OnSegmentRequest(const std::shared_ptr<http::svr::HttpExc
 	return true;
 }
 
+bool SegmentPublisher::CanProcessInline(const std::shared_ptr<http::svr::HttpExchange> &client,
+										const SegmentStreamRequestInfo &request_info,
+										bool is_play_list)
+{
+	// Pulling a stream from the origin is processed in the SegmentWorker
+	auto stream = GetStreamAs<SegmentStream>(request_info.vhost_app_name, request_info.stream_name);
+	if (stream == nullptr)
+	{
+		return false;
+	}
+
+	auto request = client->GetRequest();
+
+	if (is_play_list)
+	{
+		// Access control may query the control server (AdmissionWebhooks)
+		auto &request_url = request->GetParsedUri();
+		return (request_url != nullptr) && (IsAccessControlEnabled(request_url) == false);
+	}
+
+	// A new session is created when the first segment is requested.
+	// The table is keyed by the IP address only, so the session must also be of the requested stream
+	// (a client that plays another stream from the same address has no session for this one yet)
+	auto ip_address = request->GetRemote()->GetRemoteAddress()->GetIpAddress();
+	auto &stream_info = *std::static_pointer_cast<info::Stream>(stream);
+
+	std::unique_lock<std::recursive_mutex> table_lock(_segment_request_table_lock);
+
+	auto range = _segment_request_table.equal_range(ip_address.CStr());
+	for (auto item = range.first; item != range.second; ++item)
+	{
+		if ((item->second->GetPublisherType() == GetPublisherType()) && (item->second->GetStreamInfo() == stream_info))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool SegmentPublisher::StartSessionTableManager()
 {
 	_run_thread = true;
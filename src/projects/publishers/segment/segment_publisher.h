@@ -278,6 +278,10 @@ protected:
 						  const SegmentStreamRequestInfo &request_info,
 						  std::shared_ptr<const SegmentItem> &segment) override;
 
+	bool CanProcessInline(const std::shared_ptr<http::svr::HttpExchange> &client,
+						  const SegmentStreamRequestInfo &request_info,
+						  bool is_play_list) override;
+
 	std::shared_ptr<SegmentStreamServer> _stream_server = nullptr;
 
 private:
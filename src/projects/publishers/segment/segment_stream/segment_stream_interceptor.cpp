@@ -24,11 +24,26 @@ bool SegmentStreamInterceptor::Start(int thread_count, const SegmentProcessHandl
 	return _worker_manager.Start(thread_count, process_handler);
 }
 
+void SegmentStreamInterceptor::SetInlineProcessHandler(const SegmentProcessHandler &inline_process_handler)
+{
+	_inline_process_handler = inline_process_handler;
+}
+
 http::svr::InterceptorResult SegmentStreamInterceptor::OnRequestCompleted(const std::shared_ptr<http::svr::HttpExchange> &exchange)
 {
 	auto response = exchange->GetResponse();
 
 	response->SetStatusCode(http::StatusCode::OK);
+
+	// Playlists/segments in memory are served without handing over to the SegmentWorker.
+	// If there are exchanges of the connection in the SegmentWorker, this exchange is also pushed to keep the order of the responses.
+	if ((_inline_process_handler != nullptr) &&
+		(_worker_manager.HasPendingExchange(exchange) == false) &&
+		_inline_process_handler(exchange))
+	{
+		return http::svr::InterceptorResult::Moved;
+	}
+
 	_worker_manager.PushConnection(exchange);
 
 	return http::svr::InterceptorResult::Moved;
@@ -24,9 +24,13 @@ public:
 
 	bool Start(int thread_count, const SegmentProcessHandler &process_handler);
 
+	// inline_process_handler is called in the socket pool thread, and returns false if the request must be processed in the SegmentWorker
+	void SetInlineProcessHandler(const SegmentProcessHandler &inline_process_handler);
+
 	http::svr::InterceptorResult OnRequestCompleted(const std::shared_ptr<http::svr::HttpExchange> &exchange) override;
 	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &client) override;
 
 protected:
 	SegmentWorkerManager _worker_manager;
+	SegmentProcessHandler _inline_process_handler;
 };
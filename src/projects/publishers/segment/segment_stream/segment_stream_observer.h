@@ -31,4 +31,13 @@ public:
 	virtual bool OnSegmentRequest(const std::shared_ptr<http::svr::HttpExchange> &client,
 								  const SegmentStreamRequestInfo &request_info,
 								  std::shared_ptr<const SegmentItem> &segment) = 0;
+
+	// Called in the socket pool thread to check whether the request can be processed there.
+	// Requests that may block (such as pulling a stream, admission webhooks or creating a session) must return false.
+	virtual bool CanProcessInline(const std::shared_ptr<http::svr::HttpExchange> &client,
+								  const SegmentStreamRequestInfo &request_info,
+								  bool is_play_list)
+	{
+		return false;
+	}
 };
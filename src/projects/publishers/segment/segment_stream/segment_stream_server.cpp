@@ -171,6 +171,11 @@ bool SegmentStreamServer::PrepareInterceptors(
 
 	result = result && segment_stream_interceptor->Start(thread_count, process_handler);
 
+	if (result)
+	{
+		segment_stream_interceptor->SetInlineProcessHandler(std::bind(&SegmentStreamServer::ProcessRequestInline, this, std::placeholders::_1));
+	}
+
 	return result;
 }
 
@@ -184,11 +189,10 @@ bool SegmentStreamServer::ProcessRequest(const std::shared_ptr<http::svr::HttpEx
 	response->SetHeader("Content-Type", "text/html");
 
 	// Parse URL (URL must be "app/stream/file.ext" format)
-	auto request_uri = request->GetUri();
-	auto url = ov::Url::Parse(request_uri);
+	auto &url = request->GetParsedUri();
 	if (url == nullptr)
 	{
-		logtw("Failed to parse URL: %s", request_uri.CStr());
+		logtw("Failed to parse URL: %s", request->GetUri().CStr());
 		response->SetStatusCode(http::StatusCode::BadRequest);
 		return false;
 	}
@@ -222,6 +226,61 @@ bool SegmentStreamServer::ProcessRequest(const std::shared_ptr<http::svr::HttpEx
 	return ProcessStreamRequest(client, request_info, file_ext);
 }
 
+bool SegmentStreamServer::ProcessRequestInline(const std::shared_ptr<http::svr::HttpExchange> &client)
+{
+	auto request = client->GetRequest();
+
+	// Requests that are known to fail before looking up the stream (invalid URL, unknown application) are processed in the SegmentWorker
+	auto &url = request->GetParsedUri();
+	if ((url == nullptr) || (url->Path() == "crossdomain.xml"))
+	{
+		return false;
+	}
+
+	auto host_name = request->GetHost().Split(":")[0];
+	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(host_name, url->App());
+
+	if (vhost_app_name.IsValid() == false)
+	{
+		return false;
+	}
+
+	SegmentStreamRequestInfo request_info(
+		vhost_app_name,
+		host_name, url->Stream(), url->File());
+
+	auto tokens = url->File().Split(".");
+	auto file_ext = (tokens.size() >= 2) ? tokens[1] : "";
+	auto is_play_list = IsPlayListRequest(request_info, file_ext);
+
+	auto item = std::find_if(_observers.begin(), _observers.end(),
+							 [client, &request_info, is_play_list](const std::shared_ptr<SegmentStreamObserver> &observer) -> bool {
+								 return observer->CanProcessInline(client, request_info, is_play_list);
+							 });
+
+	if (item == _observers.end())
+	{
+		return false;
+	}
+
+	auto response = client->GetResponse();
+
+	// Set default headers
+	response->SetHeader("Server", "OvenMediaEngine");
+	response->SetHeader("Content-Type", "text/html");
+
+	_cors_manager.SetupHttpCorsHeader(vhost_app_name, request, response);
+
+	// Once the request is accepted by CanProcessInline(), it is answered here even if it fails
+	// (e.g. the segment has expired in the meantime), because ProcessStreamRequest() has already sent the error response
+	if (ProcessStreamRequest(client, request_info, file_ext) == false)
+	{
+		logtd("Segment inline process handler fail - target(%s)", request->ToString().CStr());
+	}
+
+	return true;
+}
+
 void SegmentStreamServer::SetCrossDomains(const info::VHostAppName &vhost_app_name, const std::vector<ov::String> &url_list)
 {
 	_cors_manager.SetCrossDomains(vhost_app_name, url_list);
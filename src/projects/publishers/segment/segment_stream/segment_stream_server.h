@@ -58,8 +58,12 @@ protected:
 		int thread_count, const SegmentProcessHandler &process_handler);
 
 	bool ProcessRequest(const std::shared_ptr<http::svr::HttpExchange> &client);
+	// Called in the socket pool thread. Returns false if the request must be processed in the SegmentWorker
+	bool ProcessRequestInline(const std::shared_ptr<http::svr::HttpExchange> &client);
 
 	// Interfaces
+	virtual bool IsPlayListRequest(const SegmentStreamRequestInfo &request_info, const ov::String &file_ext) const = 0;
+
 	virtual bool ProcessStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &client,
 															 const SegmentStreamRequestInfo &request_info,
 															 const ov::String &file_ext) = 0;
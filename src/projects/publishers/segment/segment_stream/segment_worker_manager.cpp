@@ -66,6 +66,7 @@ bool SegmentWorker::PushConnection(const std::shared_ptr<http::svr::HttpExchange
 {
 	std::unique_lock<std::mutex> lock(_work_info_guard);
 	_http_exchange_list_to_process.push(exchange);
+	_pending_count_map[exchange->GetConnection()->GetId()]++;
 
 	_queue_event.Notify();
 
@@ -88,6 +89,33 @@ std::shared_ptr<http::svr::HttpExchange> SegmentWorker::PopExchange()
 	return work_info;
 }
 
+//====================================================================================================
+// check pending exchanges of the connection
+//====================================================================================================
+bool SegmentWorker::HasPendingExchange(uint32_t connection_id)
+{
+	std::unique_lock<std::mutex> lock(_work_info_guard);
+
+	return _pending_count_map.find(connection_id) != _pending_count_map.end();
+}
+
+void SegmentWorker::DecreasePendingCount(uint32_t connection_id)
+{
+	std::unique_lock<std::mutex> lock(_work_info_guard);
+
+	auto item = _pending_count_map.find(connection_id);
+
+	if (item != _pending_count_map.end())
+	{
+		item->second--;
+
+		if (item->second == 0)
+		{
+			_pending_count_map.erase(item);
+		}
+	}
+}
+
 //====================================================================================================
 // WokrThread main loop
 //====================================================================================================
@@ -111,10 +139,14 @@ void SegmentWorker::WorkerThread()
 			continue;
 		}
 
+		auto connection_id = exchange->GetConnection()->GetId();
+
 		if (_process_handler(exchange) == false)
 		{
 			logtd("Segment process handler fail - target(%s)", exchange->GetRequest()->ToString().CStr());
 		}
+
+		DecreasePendingCount(connection_id);
 	}
 }
 
@@ -156,6 +188,36 @@ bool SegmentWorkerManager::Stop()
 #define MAX_WORKER_INDEX 100000000
 bool SegmentWorkerManager::PushConnection(const std::shared_ptr<http::svr::HttpExchange> &exchange)
 {
+	auto worker = GetWorker(exchange);
+
+	if (worker == nullptr)
+	{
+		return false;
+	}
+
+	worker->PushConnection(exchange);
+
+	return true;
+}
+
+//====================================================================================================
+// Check pending exchanges
+//====================================================================================================
+bool SegmentWorkerManager::HasPendingExchange(const std::shared_ptr<http::svr::HttpExchange> &exchange)
+{
+	auto worker = GetWorker(exchange);
+
+	// If the worker is not found, the exchange will be rejected by PushConnection()
+	return (worker == nullptr) || worker->HasPendingExchange(exchange->GetConnection()->GetId());
+}
+
+std::shared_ptr<SegmentWorker> SegmentWorkerManager::GetWorker(const std::shared_ptr<http::svr::HttpExchange> &exchange)
+{
+	if (_workers.empty())
+	{
+		return nullptr;
+	}
+
 	int place = 0;
 	if (exchange->GetConnection()->GetConnectionType() == http::ConnectionType::Http10 || 
 		exchange->GetConnection()->GetConnectionType() == http::ConnectionType::Http11)
@@ -181,10 +243,8 @@ bool SegmentWorkerManager::PushConnection(const std::shared_ptr<http::svr::HttpE
 	{
 		logte("Invalid connection type of exchange (%s) - target(%s)", exchange->GetRequest()->ToString(), 
 		StringFromConnectionType(exchange->GetConnection()->GetConnectionType()));
-		return false;
+		return nullptr;
 	}
-	
-	_workers[place]->PushConnection(exchange);
 
-	return true;
+	return _workers[place];
 }
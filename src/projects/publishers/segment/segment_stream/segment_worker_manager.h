@@ -14,6 +14,7 @@
 
 #include <queue>
 #include <string>
+#include <unordered_map>
 
 using SegmentProcessHandler = std::function<bool(const std::shared_ptr<http::svr::HttpExchange> &exchange)>;
 //====================================================================================================
@@ -31,11 +32,17 @@ public:
 	bool PushConnection(const std::shared_ptr<http::svr::HttpExchange> &exchange);
 	std::shared_ptr<http::svr::HttpExchange> PopExchange();
 
+	// Whether there are exchanges of the connection that are waiting or being processed
+	bool HasPendingExchange(uint32_t connection_id);
+
 private:
 	void WorkerThread();
+	void DecreasePendingCount(uint32_t connection_id);
 
 private:
 	std::queue<std::shared_ptr<http::svr::HttpExchange>> _http_exchange_list_to_process;
+	// Key: Connection ID, Value: The number of exchanges that are pushed but not yet processed
+	std::unordered_map<uint32_t, size_t> _pending_count_map;
 	std::mutex _work_info_guard;
 	ov::Semaphore _queue_event;
 
@@ -59,7 +66,12 @@ public:
 	bool Stop();
 	bool PushConnection(const std::shared_ptr<http::svr::HttpExchange> &exchange);
 
+	// If it returns true, a new exchange of the connection must be pushed to keep the order of the responses
+	bool HasPendingExchange(const std::shared_ptr<http::svr::HttpExchange> &exchange);
+
 private:
+	std::shared_ptr<SegmentWorker> GetWorker(const std::shared_ptr<http::svr::HttpExchange> &exchange);
+
 	int _worker_index = 0;
 
 	std::vector<std::shared_ptr<SegmentWorker>> _workers;
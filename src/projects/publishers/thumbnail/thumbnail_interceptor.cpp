@@ -34,3 +34,8 @@ bool ThumbnailInterceptor::IsInterceptorForRequest(const std::shared_ptr<const h
 
 	return false;
 }
+
+std::vector<ov::String> ThumbnailInterceptor::GetRoutingExtensions() const
+{
+	return {"jpg", "png"};
+}
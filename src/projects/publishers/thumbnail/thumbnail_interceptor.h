@@ -26,4 +26,5 @@ protected:
 	// Implementation of HttpRequestInterceptorInterface
 	//--------------------------------------------------------------------
 	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &client) override;
+	std::vector<ov::String> GetRoutingExtensions() const override;
 };
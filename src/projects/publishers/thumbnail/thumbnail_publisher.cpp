@@ -178,8 +178,7 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 	http_interceptor->Register(http::Method::Get, R"(.+thumb\.(jpg|png)$)", [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) -> http::svr::NextHandler {
 		auto request = exchange->GetRequest();
 
-		auto uri = request->GetUri();
-		auto parsed_url = ov::Url::Parse(uri);
+		auto &parsed_url = request->GetParsedUri();
 		if(parsed_url == nullptr)
 		{
 			logtw("Failed to parse url: %s", request->GetRequestTarget().CStr());
@@ -188,7 +187,7 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 
 		if (parsed_url->App().IsEmpty() == true || parsed_url->Stream().IsEmpty() == true || parsed_url->File().IsEmpty() == true)
 		{
-			logtw("Invalid request url: %s",uri.CStr());
+			logtw("Invalid request url: %s",request->GetUri().CStr());
 			return http::svr::NextHandler::Call;
 		}
 
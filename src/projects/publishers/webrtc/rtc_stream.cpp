@@ -618,7 +618,8 @@ std::shared_ptr<PayloadAttr> RtcStream::MakeRtxPayloadAttr(const std::shared_ptr
 bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 {
 	auto stream_packet = std::make_any<std::shared_ptr<RtpPacket>>(packet);
-	BroadcastPacket(stream_packet);
+	BroadcastPacket(stream_packet, _packetizing_ingest_time_us);
+	_packetizing_ingest_time_us = 0;
 
 	if (_rtx_enabled == true)
 	{
@@ -719,6 +720,8 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 	auto data = media_packet->GetData();
 	auto fragmentation = media_packet->GetFragHeader();
 
+	_packetizing_ingest_time_us = media_packet->GetIngestTime();
+
 	packetizer->Packetize(frame_type,
 						  timestamp,
 						  ntp_timestamp,
@@ -726,6 +729,8 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 						  data->GetLength(),
 						  fragmentation,
 						  &rtp_video_header);
+
+	MonitorInstance->RecordLatency(*this, mon::LatencyStage::RtpPacketized, media_packet->GetIngestTime());
 }
 
 void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
@@ -745,6 +750,8 @@ void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_pa
 	auto data = media_packet->GetData();
 	auto fragmentation = media_packet->GetFragHeader();
 
+	_packetizing_ingest_time_us = media_packet->GetIngestTime();
+
 	packetizer->Packetize(frame_type,
 						  timestamp,
 						  ntp_timestamp,
@@ -752,6 +759,8 @@ void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_pa
 						  data->GetLength(),
 						  fragmentation,
 						  nullptr);
+
+	MonitorInstance->RecordLatency(*this, mon::LatencyStage::RtpPacketized, media_packet->GetIngestTime());
 }
 
 uint16_t RtcStream::AllocateVP8PictureID()
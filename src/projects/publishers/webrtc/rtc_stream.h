@@ -89,6 +89,9 @@ private:
 	// VP8 Picture ID
 	uint16_t _vp8_picture_id;
 
+	// Ingest time of the frame being packetized (only the first RTP packet of the frame records the latency)
+	int64_t _packetizing_ingest_time_us = 0;
+
 	std::shared_ptr<Certificate> _certificate;
 
 	// Track ID, Packetizer
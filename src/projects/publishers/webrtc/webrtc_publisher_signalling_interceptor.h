@@ -24,8 +24,7 @@ public:
 		}
 
 		auto request = exchange->GetRequest();
-		auto uri = request->GetUri();
-		auto parsed_url = ov::Url::Parse(uri);
+		auto &parsed_url = request->GetParsedUri();
 		if(parsed_url == nullptr)
 		{
 			return false;
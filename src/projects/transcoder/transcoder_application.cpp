@@ -160,3 +160,26 @@ bool TranscodeApplication::OnSendFrame(const std::shared_ptr<info::Stream> &stre
 
 	return stream->Push(packet);
 }
+
+bool TranscodeApplication::OnSendFrames(const std::shared_ptr<info::Stream> &stream_info, const std::vector<std::shared_ptr<MediaPacket>> &packets)
+{
+	// The lock is held while pushing the packets like OnSendFrame() so the stream is not deleted in the meantime
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	auto stream_bucket = _streams.find(stream_info->GetId());
+
+	if (stream_bucket == _streams.end())
+	{
+		return false;
+	}
+
+	auto stream = stream_bucket->second;
+	bool result = true;
+
+	for (const auto &packet : packets)
+	{
+		result = stream->Push(packet) && result;
+	}
+
+	return result;
+}
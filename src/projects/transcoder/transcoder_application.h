@@ -53,6 +53,7 @@ public:
 	bool OnStreamUpdated(const std::shared_ptr<info::Stream> &stream) override;
 
 	bool OnSendFrame(const std::shared_ptr<info::Stream> &stream, const std::shared_ptr<MediaPacket> &packet) override;
+	bool OnSendFrames(const std::shared_ptr<info::Stream> &stream, const std::vector<std::shared_ptr<MediaPacket>> &packets) override;
 
 private:
 	const info::Application _application_info;
@@ -10,6 +10,7 @@
 #include "transcoder_stream.h"
 
 #include <config/config_manager.h>
+#include <monitoring/monitoring.h>
 
 #include "transcoder_application.h"
 #include "transcoder_private.h"
@@ -1084,6 +1085,11 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 	{
 		return;
 	}
+
+	if (packet->GetIngestTime() > 0)
+	{
+		StoreIngestTime(packet);
+	}
 	auto decoder_id = stage_item_decoder->second;
 
 	auto decoder_item = _decoders.find(decoder_id);
@@ -1341,6 +1347,19 @@ void TranscoderStream::OnEncodedPacket(int32_t encoder_id, std::shared_ptr<Media
 		auto &output_stream = iter.first;
 		auto output_track_id = iter.second;
 
+		if ((encoded_packet->GetIngestTime() == 0) && (MonitorInstance->IsLatencyTracingOn()))
+		{
+			// The encoded packet has the timebase of the output track
+			auto output_track = output_stream->GetTrack(output_track_id);
+			if (output_track != nullptr)
+			{
+				auto pts_us = static_cast<int64_t>(encoded_packet->GetPts() * output_track->GetTimeBase().GetExpr() * 1000000.0);
+				encoded_packet->SetIngestTime(FindIngestTime(encoded_packet->GetMediaType(), pts_us));
+			}
+		}
+
+		MonitorInstance->RecordLatency(*output_stream, mon::LatencyStage::TranscoderOutput, encoded_packet->GetIngestTime());
+
 		auto clone_packet = encoded_packet->ClonePacket();
 		clone_packet->SetTrackId(output_track_id);
 
@@ -1413,6 +1432,48 @@ void TranscoderStream::SendFrame(std::shared_ptr<info::Stream> &stream, std::sha
 	}
 }
 
+void TranscoderStream::StoreIngestTime(const std::shared_ptr<MediaPacket> &packet)
+{
+	auto input_track = _input_stream->GetTrack(packet->GetTrackId());
+	if (input_track == nullptr)
+	{
+		return;
+	}
+
+	auto pts_us = static_cast<int64_t>(packet->GetPts() * input_track->GetTimeBase().GetExpr() * 1000000.0);
+
+	std::lock_guard<std::mutex> lock_guard(_ingest_time_mutex);
+
+	auto &ingest_times = _ingest_time_map[packet->GetMediaType()];
+	ingest_times[pts_us] = packet->GetIngestTime();
+
+	// Remove the entries that are too old to be used
+	while ((ingest_times.empty() == false) && (ingest_times.begin()->first < (pts_us - TRANSCODER_INGEST_TIME_WINDOW_USEC)))
+	{
+		ingest_times.erase(ingest_times.begin());
+	}
+}
+
+int64_t TranscoderStream::FindIngestTime(cmn::MediaType media_type, int64_t pts_us)
+{
+	std::lock_guard<std::mutex> lock_guard(_ingest_time_mutex);
+
+	auto ingest_times = _ingest_time_map.find(media_type);
+	if (ingest_times == _ingest_time_map.end())
+	{
+		return 0;
+	}
+
+	// Allow the error of the timestamp conversion (1 millisecond)
+	auto item = ingest_times->second.upper_bound(pts_us + 1000);
+	if (item == ingest_times->second.begin())
+	{
+		return 0;
+	}
+
+	return std::prev(item)->second;
+}
+
 void TranscoderStream::CreateFilters(MediaFrame *buffer)
 {
 	MediaTrackId track_id = buffer->GetTrackId();
@@ -24,6 +24,9 @@
 #include "transcoder_filter.h"
 #include "transcoder_stream_internal.h"
 
+// Ingest times of the input packets are kept for this duration (in presentation time) to find the ingest time of the encoded packets
+#define TRANSCODER_INGEST_TIME_WINDOW_USEC (10 * 1000 * 1000)
+
 class TranscodeApplication;
 
 class TranscoderStream : public ov::EnableSharedFromThis<TranscoderStream>, public TranscoderStreamInternal
@@ -203,6 +206,15 @@ private:
 	// Send encoded packet to mediarouter via transcoder application
 	void SendFrame(std::shared_ptr<info::Stream> &stream, std::shared_ptr<MediaPacket> packet);
 
+	// Latency tracing: the encoded packet inherits the ingest time of the input packet
+	// that has the closest preceding presentation time
+	void StoreIngestTime(const std::shared_ptr<MediaPacket> &packet);
+	int64_t FindIngestTime(cmn::MediaType media_type, int64_t pts_us);
+
+	std::mutex _ingest_time_mutex;
+	// [MEDIA_TYPE, [PTS(microseconds), INGEST_TIME(microseconds)]]
+	std::map<cmn::MediaType, std::map<int64_t, int64_t>> _ingest_time_map;
+
 	void RemoveAllComponents();
 	void RemoveDecoders();
 	void RemoveFilters();